@@ -0,0 +1,127 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "Benchmark.h"
+
+#include <memory>
+
+namespace
+{
+  size_t constexpr nrOfElems{4096};
+  size_t constexpr nrOfConstructions{20};
+  size_t constexpr nrOfSteps{200};
+
+  // Each element has to be set next and made current within the macro step.
+  template<class A, class SetAllNxt>
+  void
+  measureSteps(string const & what, SetAllNxt const & setAllNxt)
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    auto const array{make_unique<A>("array", top)};
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP(idle, idle, Trigger(go), Action([&array, &setAllNxt]{setAllNxt(*array);}));
+
+    top.init();
+    top.step();
+    benchmark::measure
+    (
+      what
+    , nrOfSteps * nrOfElems
+    , [&]
+      {
+        for (size_t step{0}; step < nrOfSteps; ++step)
+        {
+          top.step(go);
+        }
+      }
+    );
+  }
+}
+
+BENCHMARK(ArrayConstruction)
+{
+  benchmark::measure
+  (
+    "array of variables construction per element"
+  , nrOfConstructions * nrOfElems
+  , []
+    {
+      for (size_t construction{0}; construction < nrOfConstructions; ++construction)
+      {
+        FSM_TOP(top);
+        auto const array{make_unique<ExternalArray<int, nrOfElems>>("array", top)};
+        benchmark::consume(reinterpret_cast<size_t>(array.get()));
+      }
+    }
+  );
+  benchmark::measure
+  (
+    "dense array construction per element"
+  , nrOfConstructions * nrOfElems
+  , []
+    {
+      for (size_t construction{0}; construction < nrOfConstructions; ++construction)
+      {
+        FSM_TOP(top);
+        auto const array{make_unique<ExternalDenseArray<int, nrOfElems>>("array", top)};
+        benchmark::consume(reinterpret_cast<size_t>(array.get()));
+      }
+    }
+  );
+}
+
+BENCHMARK(ArraySteps)
+{
+  measureSteps<ExternalArray<int, nrOfElems>>
+  (
+    "array of variables set next per element"
+  , [](ExternalArray<int, nrOfElems> & array)
+    {
+      for (size_t idx{0}; idx < nrOfElems; ++idx)
+      {
+        array[idx].nxt << static_cast<int>(idx);
+      }
+    }
+  );
+  measureSteps<ExternalDenseArray<int, nrOfElems>>
+  (
+    "dense array set next per element"
+  , [](ExternalDenseArray<int, nrOfElems> & array)
+    {
+      for (size_t idx{0}; idx < nrOfElems; ++idx)
+      {
+        array[idx].nxt << static_cast<int>(idx);
+      }
+    }
+  );
+  measureSteps<ExternalDenseArray<int, nrOfElems>>
+  (
+    "dense array set next in bulk per element"
+  , [](ExternalDenseArray<int, nrOfElems> & array)
+    {
+      int * const nxt{array.nxtData()};
+      for (size_t idx{0}; idx < nrOfElems; ++idx)
+      {
+        nxt[idx] = static_cast<int>(idx);
+      }
+    }
+  );
+}
@@ -0,0 +1,109 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  size_t constexpr maxNrOfStates{1000000};
+
+  // Builds groups of states, each group a state of its own, where every state steps to its successor, and the last
+  // state of a group steps to the next group.
+  void
+  build(Top const & top, size_t const nrOfStates, size_t const nrOfStatesPerGroup)
+  {
+    ExternalSignal<void> const go{"go", top};
+    Init const top_INIT{top};
+
+    vector<unique_ptr<State>> groups;
+    vector<unique_ptr<Init>> inits;
+    vector<unique_ptr<State>> states;
+    vector<unique_ptr<Auto>> autoTransitions;
+    vector<unique_ptr<Step>> stepTransitions;
+    states.reserve(nrOfStates);
+    stepTransitions.reserve(nrOfStates);
+
+    for (size_t idx{0}; idx < nrOfStates; ++idx)
+    {
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        groups.emplace_back(make_unique<State>("group" + to_string(groups.size()), top));
+        inits.emplace_back(make_unique<Init>(*groups.back()));
+        if (groups.size() == 1)
+        {
+          autoTransitions.emplace_back(make_unique<Auto>(top_INIT, *groups.back()));
+        }
+        else
+        {
+          stepTransitions.emplace_back(make_unique<Step>(*states.back(), *groups.back(), Trigger(go)));
+        }
+      }
+      states.emplace_back(make_unique<State>("state" + to_string(idx % nrOfStatesPerGroup), *groups.back()));
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        autoTransitions.emplace_back(make_unique<Auto>(*inits.back(), *states.back()));
+      }
+      else
+      {
+        stepTransitions.emplace_back(make_unique<Step>(*states[idx - 1], *states.back(), Trigger(go)));
+      }
+    }
+    top.init();
+    top.step();
+    top.step(go);
+    benchmark::consume(states.back()->isCurrent() ? 1 : 0);
+  }
+}
+
+BENCHMARK(Construction)
+{
+  for (auto const nrOfStatesPerGroup : {size_t{1000}, maxNrOfStates})
+  {
+    for (size_t nrOfStates{1000}; nrOfStates <= maxNrOfStates; nrOfStates *= 10)
+    {
+      // Smaller diagrams are built repeatedly, so that every measurement covers as many states.
+      size_t const nrOfBuilds{maxNrOfStates / nrOfStates};
+      benchmark::measure
+      (
+        string() + ((nrOfStatesPerGroup < maxNrOfStates) ? "grouped" : "flat") + " construction per state, "
+          + to_string(nrOfStates) + " states"
+      , nrOfBuilds * nrOfStates
+      , [&]
+        {
+          for (size_t idx{0}; idx < nrOfBuilds; ++idx)
+          {
+            FSM_TOP(top);
+            build(top, nrOfStates, min(nrOfStatesPerGroup, nrOfStates));
+          }
+        }
+      );
+    }
+  }
+  benchmark::measure
+  (
+    "flat construction per state in an arena, " + to_string(maxNrOfStates) + " states"
+  , maxNrOfStates
+  , []
+    {
+      FSM_TOP(top);
+      ArenaScope const arenaScope{top};
+      build(top, maxNrOfStates, maxNrOfStates);
+    }
+  );
+}
@@ -0,0 +1,171 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "Util/SmallVector.hpp"
+
+namespace
+{
+  size_t constexpr nrOfRounds{1000000};
+
+  // The singly linked list that component children used to be held in, whose size had to be counted.
+  template<typename Item>
+  class LinkedList
+  {
+  public:
+    void
+    emplace_front(Item const item)
+    {
+      m_first = make_unique<Node>(Node{item, move(m_first)});
+    }
+
+    size_t
+    size()
+    const
+    {
+      size_t size{0};
+      for (Node const * node{m_first.get()}; node != nullptr; node = node->next.get())
+      {
+        ++size;
+      }
+      return size;
+    }
+
+    template<class F>
+    void
+    forEach(F const & f)
+    const
+    {
+      for (Node const * node{m_first.get()}; node != nullptr; node = node->next.get())
+      {
+        f(node->item);
+      }
+    }
+
+  private:
+    struct Node
+    {
+      Item item;
+      unique_ptr<Node> next;
+    };
+
+    unique_ptr<Node> m_first;
+  };
+
+  // A micro step sizes the children of a component and then visits them.
+  template<size_t nrOfChildren>
+  void
+  measureChildren()
+  {
+    vector<size_t> children(nrOfChildren);
+    LinkedList<size_t *> linkedList;
+    SmallVector<size_t *> smallVector;
+    for (auto & child : children)
+    {
+      linkedList.emplace_front(&child);
+      smallVector.emplace_front(&child);
+    }
+
+    string const suffix{" with " + to_string(nrOfChildren) + " children"};
+    benchmark::measure
+    (
+      "linked list" + suffix
+    , nrOfRounds
+    , [&]
+      {
+        size_t sum{0};
+        for (size_t round{0}; round < nrOfRounds; ++round)
+        {
+          sum += linkedList.size();
+          linkedList.forEach([&](size_t * const child){sum += *child;});
+        }
+        benchmark::consume(sum);
+      }
+    );
+    benchmark::measure
+    (
+      "small vector" + suffix
+    , nrOfRounds
+    , [&]
+      {
+        size_t sum{0};
+        for (size_t round{0}; round < nrOfRounds; ++round)
+        {
+          sum += smallVector.size();
+          for (auto const & child : smallVector)
+          {
+            sum += *child;
+          }
+        }
+        benchmark::consume(sum);
+      }
+    );
+  }
+}
+
+BENCHMARK(ChildContainers)
+{
+  measureChildren<1>();
+  measureChildren<2>();
+  measureChildren<4>();
+  measureChildren<8>();
+}
+
+BENCHMARK(MicroStepsOverOrthogonalRegions)
+{
+  size_t constexpr nrOfRegions{64};
+  size_t constexpr nrOfSteps{10000};
+
+  FSM_TOP(top);
+  vector<unique_ptr<Region const>> regions;
+  vector<unique_ptr<Init const>> inits;
+  vector<unique_ptr<State const>> states;
+  vector<unique_ptr<Auto const>> transitions;
+  for (size_t regionIdx{0}; regionIdx < nrOfRegions; ++regionIdx)
+  {
+    string const name{"region" + to_string(regionIdx)};
+    regions.push_back(make_unique<Region const>(STATE_DIAGRAM_STRING_ARG_COMMA(name) top));
+    Region const & region{*regions.back()};
+    inits.push_back(make_unique<Init const>(region));
+    states.push_back(make_unique<State const>(STATE_DIAGRAM_STRING_ARG_COMMA("on") region));
+    State const & on{*states.back()};
+    states.push_back(make_unique<State const>(STATE_DIAGRAM_STRING_ARG_COMMA("off") region));
+    State const & off{*states.back()};
+    transitions.push_back(make_unique<Auto const>(*inits.back(), on));
+    transitions.push_back(make_unique<Auto const>(on, off));
+    transitions.push_back(make_unique<Auto const>(off, on));
+  }
+  top.init();
+
+  // Every macro step fires exactly one transition per region.
+  benchmark::measure
+  (
+    "micro step"
+  , nrOfSteps * nrOfRegions
+  , [&]
+    {
+      for (size_t step{0}; step < nrOfSteps; ++step)
+      {
+        top.step();
+      }
+    }
+  );
+}
@@ -0,0 +1,151 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace
+{
+  size_t constexpr nrOfStates{100000};
+  size_t constexpr nrOfStatesPerGroup{1000};
+
+  // The same diagram as built by hand below: groups of states, where every state steps to its successor, and the
+  // last state of a group steps to the next group.
+  void
+  write(char const * const path)
+  {
+    ImageWriter const writer{"top"};
+    Image::Idx const go{writer.addExternalSignal("go")};
+    Image::Idx const top_INIT{writer.addInit(Image::topIdx)};
+    Image::Idx group{0};
+    Image::Idx state{0};
+    for (size_t idx{0}; idx < nrOfStates; ++idx)
+    {
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        Image::Idx const nextGroup{writer.addState("group" + to_string(idx / nrOfStatesPerGroup), Image::topIdx)};
+        if (idx == 0)
+        {
+          writer.addAuto(top_INIT, nextGroup);
+        }
+        else
+        {
+          writer.addTrigger(writer.addStep(state, nextGroup), go);
+        }
+        group = nextGroup;
+        Image::Idx const init{writer.addInit(group)};
+        state = writer.addState("state0", group);
+        writer.addAuto(init, state);
+      }
+      else
+      {
+        Image::Idx const nextState{writer.addState("state" + to_string(idx % nrOfStatesPerGroup), group)};
+        writer.addTrigger(writer.addStep(state, nextState), go);
+        state = nextState;
+      }
+    }
+    writer.write(path);
+  }
+
+  void
+  build(Top const & top)
+  {
+    ExternalSignal<void> const go{"go", top};
+    Init const top_INIT{top};
+
+    vector<unique_ptr<State>> groups;
+    vector<unique_ptr<Init>> inits;
+    vector<unique_ptr<State>> states;
+    vector<unique_ptr<Auto>> autoTransitions;
+    vector<unique_ptr<Step>> stepTransitions;
+    states.reserve(nrOfStates);
+    stepTransitions.reserve(nrOfStates);
+
+    for (size_t idx{0}; idx < nrOfStates; ++idx)
+    {
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        groups.emplace_back(make_unique<State>("group" + to_string(groups.size()), top));
+        inits.emplace_back(make_unique<Init>(*groups.back()));
+        if (groups.size() == 1)
+        {
+          autoTransitions.emplace_back(make_unique<Auto>(top_INIT, *groups.back()));
+        }
+        else
+        {
+          stepTransitions.emplace_back(make_unique<Step>(*states.back(), *groups.back(), Trigger(go)));
+        }
+      }
+      states.emplace_back(make_unique<State>("state" + to_string(idx % nrOfStatesPerGroup), *groups.back()));
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        autoTransitions.emplace_back(make_unique<Auto>(*inits.back(), *states.back()));
+      }
+      else
+      {
+        stepTransitions.emplace_back(make_unique<Step>(*states[idx - 1], *states.back(), Trigger(go)));
+      }
+    }
+    top.init();
+    benchmark::consume(states.size());
+  }
+}
+
+BENCHMARK(ImageLoading)
+{
+  char const * const path{"BenchImage.sdim"};
+  write(path);
+
+  benchmark::measure
+  (
+    "hand-written construction per state in an arena, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , []
+    {
+      FSM_TOP(top);
+      ArenaScope const arenaScope{top};
+      build(top);
+    }
+  );
+  benchmark::measure
+  (
+    "image mapping per state, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , [&]
+    {
+      Image const image{path};
+      benchmark::consume(image.nrOfComponents());
+    }
+  );
+  ImageBindings const bindings;
+  benchmark::measure
+  (
+    "image mapping and loading per state, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , [&]
+    {
+      Image const image{path};
+      ImageTop const loaded{image, bindings};
+      loaded.top().init();
+      benchmark::consume(image.nrOfComponents());
+    }
+  );
+
+  remove(path);
+}
@@ -0,0 +1,100 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Benchmark.h"
+
+namespace
+{
+  size_t constexpr nrOfAccesses{10000000};
+  size_t constexpr nrOfLargeAccesses{100000};
+  size_t constexpr largePayloadSize{4096};
+}
+
+BENCHMARK(TriggerPayloadAccess)
+{
+  FSM_TOP(top);
+  ExternalSignal<size_t> signal("signal", top);
+  signal.set(size_t{1});
+  Event const & trigger{signal};
+
+  // How payloads used to be found: by casting across the signal hierarchy.
+  benchmark::measure
+  (
+    "payload access by dynamic_cast"
+  , nrOfAccesses
+  , [&]
+    {
+      size_t sum{0};
+      for (size_t access{0}; access < nrOfAccesses; ++access)
+      {
+        sum += dynamic_cast<Signal<size_t> const &>(trigger).get();
+      }
+      benchmark::consume(sum);
+    }
+  );
+  benchmark::measure
+  (
+    "payload access by type tag"
+  , nrOfAccesses
+  , [&]
+    {
+      size_t sum{0};
+      for (size_t access{0}; access < nrOfAccesses; ++access)
+      {
+        sum += trigger.get<size_t>();
+      }
+      benchmark::consume(sum);
+    }
+  );
+}
+
+BENCHMARK(LargePayloadAccess)
+{
+  FSM_TOP(top);
+  ExternalSignal<vector<size_t>> signal("signal", top);
+  signal.set(vector<size_t>(largePayloadSize, 1));
+  Event const & trigger{signal};
+
+  benchmark::measure
+  (
+    "large payload access by copy"
+  , nrOfLargeAccesses
+  , [&]
+    {
+      size_t sum{0};
+      for (size_t access{0}; access < nrOfLargeAccesses; ++access)
+      {
+        sum += trigger.get<vector<size_t>>().back();
+      }
+      benchmark::consume(sum);
+    }
+  );
+  benchmark::measure
+  (
+    "large payload access by reference"
+  , nrOfLargeAccesses
+  , [&]
+    {
+      size_t sum{0};
+      for (size_t access{0}; access < nrOfLargeAccesses; ++access)
+      {
+        sum += trigger.cref<vector<size_t>>().back();
+      }
+      benchmark::consume(sum);
+    }
+  );
+}
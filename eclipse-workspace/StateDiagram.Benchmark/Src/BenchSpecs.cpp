@@ -0,0 +1,181 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Benchmark.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace
+{
+  size_t constexpr nrOfCalls{10000000};
+}
+
+namespace
+{
+  template<class Guard>
+  void
+  measureGuardCalls(string const & suffix, Guard const & guard)
+  {
+    // How guards used to be held: behind a shared pointer to std::function.
+    auto const erased{make_shared<function<bool ()> const>(guard)};
+    benchmark::measure
+    (
+      "std::function guard call" + suffix
+    , nrOfCalls
+    , [&]
+      {
+        size_t nrOfTrues{0};
+        for (size_t call{0}; call < nrOfCalls; ++call)
+        {
+          nrOfTrues += (*erased)();
+        }
+        benchmark::consume(nrOfTrues);
+      }
+    );
+
+    auto const inPlace{makeSpecFunction<bool ()>(guard)};
+    benchmark::measure
+    (
+      "spec function guard call" + suffix
+    , nrOfCalls
+    , [&]
+      {
+        size_t nrOfTrues{0};
+        for (size_t call{0}; call < nrOfCalls; ++call)
+        {
+          nrOfTrues += (*inPlace)();
+        }
+        benchmark::consume(nrOfTrues);
+      }
+    );
+  }
+}
+
+BENCHMARK(GuardCalls)
+{
+  size_t counter{0};
+  measureGuardCalls(" with small capture", [&counter]{return (++counter & 1) == 0;});
+
+  // Captures beyond the small buffer of std::function end up on the heap behind one more indirection.
+  size_t const bounds[4]{1, 2, 3, 4};
+  measureGuardCalls
+  (
+    " with large capture"
+  , [&counter, bounds]{return (++counter & bounds[0]) == 0 && bounds[3] > bounds[2];}
+  );
+}
+
+BENCHMARK(GuardedMicroSteps)
+{
+  size_t constexpr nrOfGuards{8};
+  size_t constexpr nrOfSteps{1000000};
+
+  FSM_TOP(top);
+  FSM_INIT(top);
+  FSM_STATE(on, top);
+  FSM_STATE(off, top);
+  FSM_AUTO(top_INIT, on);
+  size_t nrOfActions{0};
+  vector<unique_ptr<Auto const>> transitions;
+  for (auto const & sourceAndTarget : {pair<State const &, State const &>{on, off}, {off, on}})
+  {
+    transitions.push_back(make_unique<Auto const>(sourceAndTarget.first, sourceAndTarget.second));
+    for (size_t guardIdx{0}; guardIdx < nrOfGuards; ++guardIdx)
+    {
+      transitions.back()->add(Guard([&nrOfActions, guardIdx]{return nrOfActions + guardIdx != SIZE_MAX;}));
+    }
+    transitions.back()->add(Action([&nrOfActions]{++nrOfActions;}));
+  }
+  top.init();
+
+  // Every macro step evaluates all guards of one transition and then executes its action.
+  benchmark::measure
+  (
+    "guarded micro step"
+  , nrOfSteps
+  , [&]
+    {
+      for (size_t step{0}; step < nrOfSteps; ++step)
+      {
+        top.step();
+      }
+    }
+  );
+  benchmark::consume(nrOfActions);
+}
+
+namespace
+{
+  // Every macro step fires one transition, which activates two local signals that nothing is triggered by.
+  template<class OutputFactory>
+  void
+  measureOutputs(string const & what, OutputFactory const & outputFactory)
+  {
+    size_t constexpr nrOfSteps{1000000};
+
+    FSM_TOP(top);
+    FSM_LOCAL_SIGNAL(void, first, top);
+    FSM_LOCAL_SIGNAL(void, second, top);
+    FSM_INIT(top);
+    FSM_STATE(on, top);
+    FSM_STATE(off, top);
+    FSM_AUTO(top_INIT, on);
+    FSM_AUTO(on, off, outputFactory(first, second));
+    FSM_AUTO(off, on);
+    top.init();
+
+    benchmark::measure
+    (
+      what
+    , nrOfSteps
+    , [&]
+      {
+        for (size_t step{0}; step < nrOfSteps; ++step)
+        {
+          top.step();
+        }
+      }
+    );
+  }
+}
+
+BENCHMARK(OutputMicroSteps)
+{
+  measureOutputs
+  (
+    "static output list"
+  , [](LocalEvent const & first, LocalEvent const & second){return Output(FSM_LEV{first, second});}
+  );
+  measureOutputs
+  (
+    "output list function"
+  , [](LocalEvent const & first, LocalEvent const & second)
+    {
+      return Output([first = &first, second = &second]{return FSM_LEV{*first, *second};});
+    }
+  );
+  measureOutputs
+  (
+    "emitting output function"
+  , [](LocalEvent const & first, LocalEvent const & second)
+    {
+      return Output([first = &first, second = &second](Output::Emitter const & emit){emit(*first); emit(*second);});
+    }
+  );
+}
@@ -0,0 +1,146 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+  size_t constexpr nrOfStates{100000};
+  size_t constexpr nrOfStatesPerGroup{1000};
+
+  // The same diagram as built by hand below: groups of states, where every state steps to its successor, and the
+  // last state of a group steps to the next group, which is entered when the action bound to "count" allows it.
+  string
+  text()
+  {
+    string text{R"({"name": "top", "signals": [{"name": "go"}], "states": [{"name": "init", "kind": "init"})"};
+    string transitions;
+    for (size_t groupIdx{0}; groupIdx < nrOfStates / nrOfStatesPerGroup; ++groupIdx)
+    {
+      string const group{"group" + to_string(groupIdx)};
+      text += R"(, {"name": ")" + group + R"(", "states": [{"name": "init", "kind": "init"})";
+      string groupTransitions{R"({"kind": "auto", "source": "init", "target": "state0"})"};
+      for (size_t stateIdx{0}; stateIdx < nrOfStatesPerGroup; ++stateIdx)
+      {
+        text += R"(, {"name": "state)" + to_string(stateIdx) + R"("})";
+        if (stateIdx != 0)
+        {
+          groupTransitions +=
+            R"(, {"kind": "step", "source": "state)" + to_string(stateIdx - 1) + R"(", "target": "state)"
+          + to_string(stateIdx) + R"(", "trigger": "go", "action": "count"})";
+        }
+      }
+      text += "], \"transitions\": [" + groupTransitions + "]}";
+      transitions +=
+        (groupIdx == 0)
+        ? string{R"({"kind": "auto", "source": "init", "target": "group0"})"}
+        : R"(, {"kind": "step", "source": "group)" + to_string(groupIdx - 1) + ".state" + to_string(nrOfStatesPerGroup - 1)
+          + R"(", "target": ")" + group + R"(", "trigger": "go", "action": "count"})";
+    }
+    return text + "], \"transitions\": [" + transitions + "]}";
+  }
+
+  void
+  build(Top const & top, Action const & count)
+  {
+    ExternalSignal<void> const go{"go", top};
+    Init const top_INIT{top};
+
+    vector<unique_ptr<State>> groups;
+    vector<unique_ptr<Init>> inits;
+    vector<unique_ptr<State>> states;
+    vector<unique_ptr<Auto>> autoTransitions;
+    vector<unique_ptr<Step>> stepTransitions;
+    states.reserve(nrOfStates);
+    stepTransitions.reserve(nrOfStates);
+
+    for (size_t idx{0}; idx < nrOfStates; ++idx)
+    {
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        groups.emplace_back(make_unique<State>("group" + to_string(groups.size()), top));
+        inits.emplace_back(make_unique<Init>(*groups.back()));
+        if (groups.size() == 1)
+        {
+          autoTransitions.emplace_back(make_unique<Auto>(top_INIT, *groups.back()));
+        }
+        else
+        {
+          stepTransitions.emplace_back(make_unique<Step>(*states.back(), *groups.back(), Trigger(go), count));
+        }
+      }
+      states.emplace_back(make_unique<State>("state" + to_string(idx % nrOfStatesPerGroup), *groups.back()));
+      if ((idx % nrOfStatesPerGroup) == 0)
+      {
+        autoTransitions.emplace_back(make_unique<Auto>(*inits.back(), *states.back()));
+      }
+      else
+      {
+        stepTransitions.emplace_back(make_unique<Step>(*states[idx - 1], *states.back(), Trigger(go), count));
+      }
+    }
+    top.init();
+    benchmark::consume(states.size());
+  }
+}
+
+BENCHMARK(TextLoading)
+{
+  size_t nrOfCounts{0};
+  Action const count{[&]{++nrOfCounts;}};
+  string const diagram{text()};
+
+  benchmark::measure
+  (
+    "hand-written construction per state, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , [&]
+    {
+      FSM_TOP(top);
+      build(top, count);
+    }
+  );
+  benchmark::measure
+  (
+    "hand-written construction per state in an arena, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , [&]
+    {
+      FSM_TOP(top);
+      ArenaScope const arenaScope{top};
+      build(top, count);
+    }
+  );
+  TextBindings const bindings;
+  bindings.bind("count", count);
+  benchmark::measure
+  (
+    "text loading per state, " + to_string(nrOfStates) + " states"
+  , nrOfStates
+  , [&]
+    {
+      TextTop const loaded{diagram, bindings};
+      loaded.top().init();
+      benchmark::consume(diagram.size());
+    }
+  );
+  benchmark::consume(nrOfCounts);
+}
@@ -0,0 +1,155 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "Benchmark.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+  size_t constexpr nrOfSteps{10000};
+  size_t constexpr largeDataSize{4096};
+  size_t constexpr nrOfLocalVars{64};
+  size_t constexpr nrOfGetsPerStep{16};
+}
+
+BENCHMARK(LargeVarCommit)
+{
+  FSM_TOP(top);
+  FSM_SIGNAL(void, go, top);
+  FSM_VAR(vector<int>, samples, top, vector<int>{});
+
+  FSM_INIT(top);
+  FSM_STATE(idle, top);
+
+  vector<vector<int>> nxtSamples(nrOfSteps, vector<int>(largeDataSize, 1));
+  size_t step{0};
+
+  FSM_AUTO(top_INIT, idle);
+  FSM_STEP(idle, idle, Trigger(go), Action([&]{samples.nxt << move(nxtSamples[step++]);}));
+
+  top.init();
+  top.step();
+  benchmark::measure
+  (
+    "macro step committing a large next value"
+  , nrOfSteps
+  , [&]
+    {
+      while (step < nrOfSteps)
+      {
+        top.step(go);
+      }
+    }
+  );
+}
+
+BENCHMARK(ScopeEntry)
+{
+  FSM_TOP(top);
+  FSM_SIGNAL(void, go, top);
+
+  FSM_INIT(top);
+  FSM_STATE(ping, top);
+  FSM_STATE(pong, top);
+
+  vector<unique_ptr<LocalVar<int>>> pingVars;
+  vector<unique_ptr<LocalVar<int>>> pongVars;
+  for (size_t idx{0}; idx < nrOfLocalVars; ++idx)
+  {
+    pingVars.emplace_back(make_unique<LocalVar<int>>("var" + to_string(idx), ping));
+    pongVars.emplace_back(make_unique<LocalVar<int>>("var" + to_string(idx), pong));
+  }
+
+  FSM_AUTO(top_INIT, ping);
+  FSM_STEP(ping, pong, Trigger(go));
+  FSM_STEP(pong, ping, Trigger(go));
+
+  top.init();
+  top.step();
+  benchmark::measure
+  (
+    "macro step entering a state with untouched local variables"
+  , nrOfSteps
+  , [&]
+    {
+      for (size_t step{0}; step < nrOfSteps; ++step)
+      {
+        top.step(go);
+      }
+    }
+  );
+}
+
+BENCHMARK(NestedLocalVarAccess)
+{
+  FSM_TOP(top);
+  FSM_SIGNAL(void, go, top);
+
+  FSM_INIT(top);
+  FSM_STATE(outer, top);
+  FSM_INIT(outer);
+  FSM_STATE(middle, outer);
+  FSM_INIT(middle);
+  FSM_STATE(inner, middle);
+
+  FSM_LOCAL_VAR(int, var, outer, 1);
+
+  // Fill the scopes in between, so that every access is checked against a deep scope with many local variables.
+  vector<unique_ptr<LocalVar<int>>> fillerVars;
+  for (size_t idx{0}; idx < nrOfLocalVars; ++idx)
+  {
+    fillerVars.emplace_back(make_unique<LocalVar<int>>("var" + to_string(idx), middle));
+    fillerVars.emplace_back(make_unique<LocalVar<int>>("var" + to_string(idx), inner));
+  }
+
+  FSM_AUTO(top_INIT, outer);
+  FSM_AUTO(outer_INIT, middle);
+  FSM_AUTO(middle_INIT, inner);
+  FSM_STEP
+  (
+    inner, inner
+  , Trigger(go)
+  , Action
+    (
+      [&]
+      {
+        size_t sum{0};
+        for (size_t idx{0}; idx < nrOfGetsPerStep; ++idx)
+        {
+          sum += static_cast<size_t>(var.get());
+        }
+        benchmark::consume(sum);
+      }
+    )
+  );
+
+  top.init();
+  top.step();
+  benchmark::measure
+  (
+    "checked access to a local variable from a deeply nested scope"
+  , nrOfSteps * nrOfGetsPerStep
+  , [&]
+    {
+      for (size_t step{0}; step < nrOfSteps; ++step)
+      {
+        top.step(go);
+      }
+    }
+  );
+}
@@ -0,0 +1,75 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Benchmark.h"
+
+#include <cstdio>
+
+namespace benchmark
+{
+
+Benchmark * Benchmark::s_first{nullptr};
+
+namespace
+{
+  size_t volatile sink;
+}
+
+Benchmark
+::Benchmark(string const & name, BenchmarkFun const benchmarkFun)
+:
+  m_name{name}
+, m_benchmarkFun{benchmarkFun}
+, m_next{s_first}
+{
+  s_first = this;
+}
+
+int
+Benchmark
+::runAll()
+{
+  for (Benchmark const * benchmark{s_first}; benchmark != nullptr; benchmark = benchmark->m_next)
+  {
+    printf("%s\n", benchmark->m_name.c_str());
+    try
+    {
+      benchmark->m_benchmarkFun();
+    }
+    catch (Error const & err)
+    {
+      printf("  failed: %s\n", err.msg().c_str());
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void
+consume(size_t const value)
+{
+  sink = value;
+}
+
+void
+report(string const & what, chrono::steady_clock::duration const elapsed, size_t const nrOfOps)
+{
+  double const ns{static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(elapsed).count())};
+  printf("  %-48s %10.2f ns/op\n", what.c_str(), ns / static_cast<double>(nrOfOps));
+}
+
+} // namespace benchmark
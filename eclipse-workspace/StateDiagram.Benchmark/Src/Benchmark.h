@@ -0,0 +1,78 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_BENCHMARK_H_
+#define STATE_DIAGRAM_BENCHMARK_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include "state_diagram/state_diagram.h"
+
+using namespace std;
+using namespace state_diagram;
+
+namespace benchmark
+{
+
+using BenchmarkFun = void (* const)();
+
+class Benchmark
+{
+public:
+  Benchmark(string const & name, BenchmarkFun const benchmarkFun);
+  Benchmark(Benchmark const &) = delete;
+
+  void operator=(Benchmark const &) = delete;
+
+  static int runAll();
+
+private:
+  static Benchmark * s_first;
+
+  string const m_name;
+  BenchmarkFun const m_benchmarkFun;
+  Benchmark * const m_next;
+};
+
+// Keeps the compiler from optimizing away computations whose results are not used otherwise.
+void consume(size_t const value);
+
+// Reports the time per operation for a measurement consisting of nrOfOps operations.
+void report(string const & what, chrono::steady_clock::duration const elapsed, size_t const nrOfOps);
+
+template<class F>
+void
+measure(string const & what, size_t const nrOfOps, F const & f)
+{
+  auto const start{chrono::steady_clock::now()};
+  f();
+  report(what, chrono::steady_clock::now() - start, nrOfOps);
+}
+
+} // namespace benchmark
+
+#define BENCHMARK(name) \
+  void name(); \
+  \
+  ::benchmark::Benchmark const name##_asBenchmark{#name, name}; \
+  \
+  void \
+  name()
+
+#endif // STATE_DIAGRAM_BENCHMARK_H_
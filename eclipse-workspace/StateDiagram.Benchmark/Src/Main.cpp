@@ -14,21 +14,11 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
 
-namespace state_diagram
-{
+#include "Benchmark.h"
 
-UnwindCmd
-StackSeq::Unwind
-::accept
-(
-  function<UnwindCmd (StackSeq::Construct const * const)> const
-, function<UnwindCmd (StackSeq::Unwind const * const)> const onUnwind
-)
-const
+int
+main(int, char **)
 {
-  return onUnwind(this);
+  return benchmark::Benchmark::runAll();
 }
-
-} // namespace state_diagram
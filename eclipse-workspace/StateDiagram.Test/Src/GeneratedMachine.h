@@ -0,0 +1,1875 @@
+// Generated from the diagram image of top state "machine". Do not edit.
+
+#ifndef STATE_DIAGRAM_GENERATED_GENERATEDMACHINE_H_
+#define STATE_DIAGRAM_GENERATED_GENERATEDMACHINE_H_
+
+#include <cstdint>
+#include <cstring>
+
+template<class Bindings>
+class GeneratedMachine
+{
+public:
+  enum class State : std::uint32_t
+  {
+    INIT = 5 // machine::REGION::INIT
+  , idle = 6 // machine::REGION::idle
+  , fork = 7 // machine::REGION::fork
+  , busy = 8 // machine::REGION::busy
+  , busy_left_INIT = 11 // machine::REGION::busy::left::INIT
+  , busy_left_l1 = 12 // machine::REGION::busy::left::l1
+  , busy_left_l2 = 13 // machine::REGION::busy::left::l2
+  , busy_left_FINAL = 14 // machine::REGION::busy::left::FINAL
+  , busy_right_INIT = 16 // machine::REGION::busy::right::INIT
+  , busy_right_r1 = 17 // machine::REGION::busy::right::r1
+  , busy_right_r2 = 18 // machine::REGION::busy::right::r2
+  , busy_right_FINAL = 19 // machine::REGION::busy::right::FINAL
+  , parked = 20 // machine::REGION::parked
+  , parked_INIT = 22 // machine::REGION::parked::REGION::INIT
+  , parked_p1 = 23 // machine::REGION::parked::REGION::p1
+  , parked_p2 = 24 // machine::REGION::parked::REGION::p2
+  };
+
+  enum class Region : std::uint32_t
+  {
+    REGION = 0 // machine::REGION
+  , busy_left = 10 // machine::REGION::busy::left
+  , busy_right = 15 // machine::REGION::busy::right
+  , parked_REGION = 20 // machine::REGION::parked::REGION
+  };
+
+  enum class Signal : std::uint32_t
+  {
+    go = 1 // go
+  , stop = 2 // stop
+  , tick = 3 // tick
+  , poke = 4 // poke
+  , busy_ping = 9 // machine::REGION::busy::ping
+  , parked_nudge = 21 // machine::REGION::parked::nudge
+  };
+
+  GeneratedMachine(Bindings & bindings)
+  :
+    m_bindings{bindings}
+  , m_current_REGION{}
+  , m_current_busy_left{}
+  , m_current_busy_right{}
+  , m_current_parked_REGION{}
+  , m_isActive{}
+  , m_isPaused{}
+  , m_isFrozen{}
+  , m_isFrozenShallowly{}
+  , m_haveExecuted{}
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  init()
+  {
+    initRegion0();
+  }
+
+  void
+  activate(Signal const signal)
+  {
+    switch (signal)
+    {
+    case Signal::go:
+      m_isActive[0] |= UINT64_C(0x1);
+      break;
+
+    case Signal::stop:
+      m_isActive[0] |= UINT64_C(0x2);
+      break;
+
+    case Signal::tick:
+      m_isActive[0] |= UINT64_C(0x4);
+      break;
+
+    case Signal::poke:
+      m_isActive[0] |= UINT64_C(0x8);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  bool
+  step()
+  {
+    bool haveAllRegionsTerminated;
+    for (;;)
+    {
+      bool isSomeRegionActive{false};
+      haveAllRegionsTerminated = true;
+      isSomeRegionActive |= execRegion0().stat;
+      haveAllRegionsTerminated &= false;
+      if ((!isSomeRegionActive) || haveAllRegionsTerminated)
+      {
+        break;
+      }
+    }
+    reload();
+    return haveAllRegionsTerminated;
+  }
+
+  State
+  current(Region const region)
+  const
+  {
+    switch (region)
+    {
+    case Region::REGION:
+      return m_current_REGION;
+
+    case Region::busy_left:
+      return m_current_busy_left;
+
+    case Region::busy_right:
+      return m_current_busy_right;
+
+    case Region::parked_REGION:
+      return m_current_parked_REGION;
+
+    default:
+      return State{};
+    }
+  }
+
+private:
+  struct ExecStat
+  {
+    bool stat;
+    std::uint32_t unwindTo;
+  };
+
+  static std::uint32_t constexpr noRegion{UINT32_MAX};
+
+  // Region machine::REGION.
+  void
+  initRegion0()
+  {
+    m_current_REGION = State::INIT;
+  }
+
+  void
+  shallowInitRegion0()
+  {
+    switch (m_current_REGION)
+    {
+    case State::idle:
+      initState6();
+      break;
+
+    case State::busy:
+      initState8();
+      break;
+
+    case State::parked:
+      initState20();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void
+  finalizeRegion0()
+  {
+    switch (m_current_REGION)
+    {
+    case State::idle:
+      finalizeState6();
+      break;
+
+    case State::busy:
+      finalizeState8();
+      break;
+
+    case State::parked:
+      finalizeState20();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  ExecStat
+  execRegion0()
+  {
+    ExecStat stat{false, noRegion};
+    switch (m_current_REGION)
+    {
+    case State::INIT:
+      stat = execSource5();
+      break;
+
+    case State::idle:
+      stat = execState6();
+      break;
+
+    case State::fork:
+      stat = execSource7();
+      break;
+
+    case State::busy:
+      stat = execState8();
+      break;
+
+    case State::parked:
+      stat = execState20();
+      break;
+
+    default:
+      break;
+    }
+    if (stat.stat && (stat.unwindTo == 0))
+    {
+      return ExecStat{true, noRegion};
+    }
+    return stat;
+  }
+
+  // Region machine::REGION::busy::left.
+  void
+  initRegion10()
+  {
+    m_current_busy_left = State::busy_left_INIT;
+  }
+
+  void
+  shallowInitRegion10()
+  {
+    switch (m_current_busy_left)
+    {
+    case State::busy_left_l1:
+      initState12();
+      break;
+
+    case State::busy_left_l2:
+      initState13();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void
+  finalizeRegion10()
+  {
+    switch (m_current_busy_left)
+    {
+    case State::busy_left_l1:
+      finalizeState12();
+      break;
+
+    case State::busy_left_l2:
+      finalizeState13();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  ExecStat
+  execRegion10()
+  {
+    ExecStat stat{false, noRegion};
+    switch (m_current_busy_left)
+    {
+    case State::busy_left_INIT:
+      stat = execSource11();
+      break;
+
+    case State::busy_left_l1:
+      stat = execState12();
+      break;
+
+    case State::busy_left_l2:
+      stat = execState13();
+      break;
+
+    default:
+      break;
+    }
+    if (stat.stat && (stat.unwindTo == 10))
+    {
+      return ExecStat{true, noRegion};
+    }
+    return stat;
+  }
+
+  // Region machine::REGION::busy::right.
+  void
+  initRegion15()
+  {
+    m_current_busy_right = State::busy_right_INIT;
+  }
+
+  void
+  shallowInitRegion15()
+  {
+    switch (m_current_busy_right)
+    {
+    case State::busy_right_r1:
+      initState17();
+      break;
+
+    case State::busy_right_r2:
+      initState18();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void
+  finalizeRegion15()
+  {
+    switch (m_current_busy_right)
+    {
+    case State::busy_right_r1:
+      finalizeState17();
+      break;
+
+    case State::busy_right_r2:
+      finalizeState18();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  ExecStat
+  execRegion15()
+  {
+    ExecStat stat{false, noRegion};
+    switch (m_current_busy_right)
+    {
+    case State::busy_right_INIT:
+      stat = execSource16();
+      break;
+
+    case State::busy_right_r1:
+      stat = execState17();
+      break;
+
+    case State::busy_right_r2:
+      stat = execState18();
+      break;
+
+    default:
+      break;
+    }
+    if (stat.stat && (stat.unwindTo == 15))
+    {
+      return ExecStat{true, noRegion};
+    }
+    return stat;
+  }
+
+  // Region machine::REGION::parked::REGION.
+  void
+  initRegion20()
+  {
+    m_current_parked_REGION = State::parked_INIT;
+  }
+
+  void
+  shallowInitRegion20()
+  {
+    switch (m_current_parked_REGION)
+    {
+    case State::parked_p1:
+      initState23();
+      break;
+
+    case State::parked_p2:
+      initState24();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void
+  finalizeRegion20()
+  {
+    switch (m_current_parked_REGION)
+    {
+    case State::parked_p1:
+      finalizeState23();
+      break;
+
+    case State::parked_p2:
+      finalizeState24();
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  ExecStat
+  execRegion20()
+  {
+    ExecStat stat{false, noRegion};
+    switch (m_current_parked_REGION)
+    {
+    case State::parked_INIT:
+      stat = execSource22();
+      break;
+
+    case State::parked_p1:
+      stat = execState23();
+      break;
+
+    case State::parked_p2:
+      stat = execState24();
+      break;
+
+    default:
+      break;
+    }
+    if (stat.stat && (stat.unwindTo == 20))
+    {
+      return ExecStat{true, noRegion};
+    }
+    return stat;
+  }
+
+  // Sub-state machine::REGION::INIT.
+  ExecStat
+  execSource5()
+  {
+    {
+      ExecStat const stat{transition0()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::idle.
+  void
+  initState6()
+  {
+    m_isPaused[0] |= UINT64_C(0x1);
+    if ((m_isFrozen[0] & UINT64_C(0x1)) == 0)
+    {
+      enterState6();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x1)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState6()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState6()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState6()
+  {
+    exitState6();
+  }
+
+  bool
+  execInternalTransitions6()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState6()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions6();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource6()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions6(), noRegion};
+  }
+
+  ExecStat
+  execSource6()
+  {
+    {
+      ExecStat const stat{transition1()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition2()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition5()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // Sub-state machine::REGION::fork.
+  ExecStat
+  execSource7()
+  {
+    {
+      ExecStat const stat{transition3()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition4()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::busy.
+  void
+  initState8()
+  {
+    m_isPaused[0] |= UINT64_C(0x2);
+    if ((m_isFrozen[0] & UINT64_C(0x2)) == 0)
+    {
+      enterState8();
+      initRegion10();
+      initRegion15();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x2)) != 0)
+    {
+      shallowInitRegion10();
+      shallowInitRegion15();
+    }
+  }
+
+  void
+  enterState8()
+  {
+    // Enter transition 6.
+    if (m_bindings.guard(1))
+    {
+      m_bindings.action(2);
+    }
+    // Enter transition 7.
+    {
+      m_bindings.action(3);
+    }
+  }
+
+  void
+  exitState8()
+  {
+    // Exit transition 8.
+    {
+      m_bindings.action(4);
+    }
+  }
+
+  void
+  finalizeState8()
+  {
+    finalizeRegion10();
+    finalizeRegion15();
+    exitState8();
+  }
+
+  bool
+  execInternalTransitions8()
+  {
+    bool isSomeTransitionActive{false};
+    isSomeTransitionActive |= transition9();
+    isSomeTransitionActive |= transition10();
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState8()
+  {
+    bool isSomeRegionActive{false};
+    {
+      ExecStat const stat{execRegion10()};
+      if (stat.stat)
+      {
+        if (stat.unwindTo != noRegion)
+        {
+          return stat;
+        }
+        isSomeRegionActive = true;
+      }
+    }
+    {
+      ExecStat const stat{execRegion15()};
+      if (stat.stat)
+      {
+        if (stat.unwindTo != noRegion)
+        {
+          return stat;
+        }
+        isSomeRegionActive = true;
+      }
+    }
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions8();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource8()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions8(), noRegion};
+  }
+
+  ExecStat
+  execSource8()
+  {
+    {
+      ExecStat const stat{transition23()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition20()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition21()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition22()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // Sub-state machine::REGION::busy::left::INIT.
+  ExecStat
+  execSource11()
+  {
+    {
+      ExecStat const stat{transition11()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::busy::left::l1.
+  void
+  initState12()
+  {
+    m_isPaused[0] |= UINT64_C(0x4);
+    if ((m_isFrozen[0] & UINT64_C(0x4)) == 0)
+    {
+      enterState12();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x4)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState12()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState12()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState12()
+  {
+    exitState12();
+  }
+
+  bool
+  execInternalTransitions12()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState12()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions12();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource12()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions12(), noRegion};
+  }
+
+  ExecStat
+  execSource12()
+  {
+    {
+      ExecStat const stat{transition12()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::busy::left::l2.
+  void
+  initState13()
+  {
+    m_isPaused[0] |= UINT64_C(0x8);
+    if ((m_isFrozen[0] & UINT64_C(0x8)) == 0)
+    {
+      enterState13();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x8)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState13()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState13()
+  {
+    // Exit transition 14.
+    {
+      m_bindings.action(6);
+    }
+  }
+
+  void
+  finalizeState13()
+  {
+    exitState13();
+  }
+
+  bool
+  execInternalTransitions13()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState13()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions13();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource13()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions13(), noRegion};
+  }
+
+  ExecStat
+  execSource13()
+  {
+    {
+      ExecStat const stat{transition13()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // Sub-state machine::REGION::busy::right::INIT.
+  ExecStat
+  execSource16()
+  {
+    {
+      ExecStat const stat{transition15()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::busy::right::r1.
+  void
+  initState17()
+  {
+    m_isPaused[0] |= UINT64_C(0x10);
+    if ((m_isFrozen[0] & UINT64_C(0x10)) == 0)
+    {
+      enterState17();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x10)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState17()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState17()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState17()
+  {
+    exitState17();
+  }
+
+  bool
+  execInternalTransitions17()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState17()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions17();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource17()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions17(), noRegion};
+  }
+
+  ExecStat
+  execSource17()
+  {
+    {
+      ExecStat const stat{transition16()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::busy::right::r2.
+  void
+  initState18()
+  {
+    m_isPaused[0] |= UINT64_C(0x20);
+    if ((m_isFrozen[0] & UINT64_C(0x20)) == 0)
+    {
+      enterState18();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x20)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState18()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState18()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState18()
+  {
+    exitState18();
+  }
+
+  bool
+  execInternalTransitions18()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState18()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions18();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource18()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions18(), noRegion};
+  }
+
+  ExecStat
+  execSource18()
+  {
+    {
+      ExecStat const stat{transition17()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition18()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition19()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::parked.
+  void
+  initState20()
+  {
+    m_isPaused[0] |= UINT64_C(0x40);
+    if ((m_isFrozen[0] & UINT64_C(0x40)) == 0)
+    {
+      enterState20();
+      initRegion20();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x40)) != 0)
+    {
+      shallowInitRegion20();
+    }
+  }
+
+  void
+  enterState20()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState20()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState20()
+  {
+    finalizeRegion20();
+    exitState20();
+  }
+
+  bool
+  execInternalTransitions20()
+  {
+    bool isSomeTransitionActive{false};
+    isSomeTransitionActive |= transition29();
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState20()
+  {
+    bool isSomeRegionActive{false};
+    {
+      ExecStat const stat{execRegion20()};
+      if (stat.stat)
+      {
+        if (stat.unwindTo != noRegion)
+        {
+          return stat;
+        }
+        isSomeRegionActive = true;
+      }
+    }
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions20();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource20()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions20(), noRegion};
+  }
+
+  ExecStat
+  execSource20()
+  {
+    {
+      ExecStat const stat{transition30()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition32()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // Sub-state machine::REGION::parked::REGION::INIT.
+  ExecStat
+  execSource22()
+  {
+    {
+      ExecStat const stat{transition24()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::parked::REGION::p1.
+  void
+  initState23()
+  {
+    m_isPaused[0] |= UINT64_C(0x80);
+    if ((m_isFrozen[0] & UINT64_C(0x80)) == 0)
+    {
+      enterState23();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x80)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState23()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState23()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState23()
+  {
+    exitState23();
+  }
+
+  bool
+  execInternalTransitions23()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState23()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions23();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource23()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions23(), noRegion};
+  }
+
+  ExecStat
+  execSource23()
+  {
+    {
+      ExecStat const stat{transition28()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition25()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition26()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // State machine::REGION::parked::REGION::p2.
+  void
+  initState24()
+  {
+    m_isPaused[0] |= UINT64_C(0x100);
+    if ((m_isFrozen[0] & UINT64_C(0x100)) == 0)
+    {
+      enterState24();
+    }
+    else if ((m_isFrozenShallowly[0] & UINT64_C(0x100)) != 0)
+    {
+    }
+  }
+
+  void
+  enterState24()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  exitState24()
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  finalizeState24()
+  {
+    exitState24();
+  }
+
+  bool
+  execInternalTransitions24()
+  {
+    bool isSomeTransitionActive{false};
+    return isSomeTransitionActive;
+  }
+
+  ExecStat
+  execState24()
+  {
+    bool isSomeRegionActive{false};
+    if (isSomeRegionActive)
+    {
+      execInternalTransitions24();
+      return ExecStat{true, noRegion};
+    }
+    ExecStat const stat{execSource24()};
+    if (stat.stat)
+    {
+      return stat;
+    }
+    return ExecStat{execInternalTransitions24(), noRegion};
+  }
+
+  ExecStat
+  execSource24()
+  {
+    {
+      ExecStat const stat{transition27()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    {
+      ExecStat const stat{transition31()};
+      if (stat.stat)
+      {
+        return stat;
+      }
+    }
+    return ExecStat{false, noRegion};
+  }
+
+  // Auto transition 0 from machine::REGION::INIT to machine::REGION::idle.
+  ExecStat
+  transition0()
+  {
+    m_bindings.action(0);
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 1 from machine::REGION::idle to machine::REGION::busy.
+  ExecStat
+  transition1()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x1)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if (((m_isActive[0] & UINT64_C(0x1)) != 0) && m_bindings.guard(10, Signal::go))
+    {
+      trigger = Signal::go;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(10, trigger);
+    finalizeState6();
+    m_isFrozen[0] &= ~UINT64_C(0x1);
+    m_current_REGION = State::busy;
+    initState8();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 2 from machine::REGION::idle to machine::REGION::fork.
+  ExecStat
+  transition2()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x1)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x8)) != 0)
+    {
+      trigger = Signal::poke;
+    }
+    else if ((m_isActive[0] & UINT64_C(0x4)) != 0)
+    {
+      trigger = Signal::tick;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(11, trigger);
+    finalizeState6();
+    m_isFrozen[0] &= ~UINT64_C(0x1);
+    m_current_REGION = State::fork;
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 3 from machine::REGION::fork to machine::REGION::busy.
+  ExecStat
+  transition3()
+  {
+    if (!(m_bindings.guard(0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_current_REGION = State::busy;
+    initState8();
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 4 from machine::REGION::fork to machine::REGION::parked.
+  ExecStat
+  transition4()
+  {
+    m_bindings.action(1);
+    m_current_REGION = State::parked;
+    initState20();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 5 from machine::REGION::idle to machine::REGION::busy::right::r2.
+  ExecStat
+  transition5()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x1)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if (((m_isActive[0] & UINT64_C(0x2)) != 0) && m_bindings.guard(11, Signal::stop))
+    {
+      trigger = Signal::stop;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(12, trigger);
+    finalizeState6();
+    m_isFrozen[0] &= ~UINT64_C(0x1);
+    m_current_REGION = State::busy;
+    enterState8();
+    initRegion10();
+    m_current_busy_right = State::busy_right_r2;
+    initState18();
+    return ExecStat{true, noRegion};
+  }
+
+  // Internal step transition 9 of machine::REGION::busy.
+  bool
+  transition9()
+  {
+    if ((m_haveExecuted[0] & UINT64_C(0x1)) != 0)
+    {
+      return false;
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x4)) != 0)
+    {
+      trigger = Signal::tick;
+    }
+    else
+    {
+      return false;
+    }
+    m_haveExecuted[0] |= UINT64_C(0x1);
+    m_isActive[0] |= UINT64_C(0x10);
+    m_bindings.action(13, trigger);
+    return true;
+  }
+
+  // Internal auto transition 10 of machine::REGION::busy.
+  bool
+  transition10()
+  {
+    if ((m_haveExecuted[0] & UINT64_C(0x2)) != 0)
+    {
+      return false;
+    }
+    m_haveExecuted[0] |= UINT64_C(0x2);
+    if (!(m_bindings.guard(2)))
+    {
+      return false;
+    }
+    m_bindings.action(5);
+    return true;
+  }
+
+  // Auto transition 11 from machine::REGION::busy::left::INIT to machine::REGION::busy::left::l1.
+  ExecStat
+  transition11()
+  {
+    m_current_busy_left = State::busy_left_l1;
+    initState12();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 12 from machine::REGION::busy::left::l1 to machine::REGION::busy::left::l2.
+  ExecStat
+  transition12()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x4)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x4)) != 0)
+    {
+      trigger = Signal::tick;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(14, trigger);
+    finalizeState12();
+    m_isFrozen[0] &= ~UINT64_C(0x4);
+    m_current_busy_left = State::busy_left_l2;
+    initState13();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 13 from machine::REGION::busy::left::l2 to machine::REGION::busy::left::FINAL.
+  ExecStat
+  transition13()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x8)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(((m_isActive[0] & UINT64_C(0x8)) != 0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState13();
+    m_isFrozen[0] &= ~UINT64_C(0x8);
+    m_current_busy_left = State::busy_left_FINAL;
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 15 from machine::REGION::busy::right::INIT to machine::REGION::busy::right::r1.
+  ExecStat
+  transition15()
+  {
+    m_current_busy_right = State::busy_right_r1;
+    initState17();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 16 from machine::REGION::busy::right::r1 to machine::REGION::busy::right::r2.
+  ExecStat
+  transition16()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x10)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x10)) != 0)
+    {
+      trigger = Signal::busy_ping;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(15, trigger);
+    finalizeState17();
+    m_isFrozen[0] &= ~UINT64_C(0x10);
+    m_current_busy_right = State::busy_right_r2;
+    initState18();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 17 from machine::REGION::busy::right::r2 to machine::REGION::busy::right::r1.
+  ExecStat
+  transition17()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x20)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_isActive[0] & UINT64_C(0x1)) != 0) && m_bindings.guard(12, Signal::go))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState18();
+    m_isFrozen[0] &= ~UINT64_C(0x20);
+    m_current_busy_right = State::busy_right_r1;
+    initState17();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 18 from machine::REGION::busy::right::r2 to machine::REGION::busy::right::FINAL.
+  ExecStat
+  transition18()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x20)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(((m_isActive[0] & UINT64_C(0x8)) != 0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState18();
+    m_isFrozen[0] &= ~UINT64_C(0x20);
+    m_current_busy_right = State::busy_right_FINAL;
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 19 from machine::REGION::busy::right::r2 to machine::REGION::idle.
+  ExecStat
+  transition19()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x20)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if ((m_haveExecuted[0] & UINT64_C(0x4)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x2)) != 0)
+    {
+      trigger = Signal::stop;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_haveExecuted[0] |= UINT64_C(0x4);
+    m_bindings.action(16, trigger);
+    finalizeState18();
+    m_isFrozen[0] &= ~UINT64_C(0x20);
+    finalizeRegion10();
+    exitState8();
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, 0};
+  }
+
+  // Step transition 20 from machine::REGION::busy to machine::REGION::idle.
+  ExecStat
+  transition20()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x2)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if (((m_isActive[0] & UINT64_C(0x2)) != 0) && (((m_current_busy_left == State::busy_left_FINAL)) && ((m_current_busy_right == State::busy_right_FINAL))))
+    {
+      trigger = Signal::stop;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(17, trigger);
+    finalizeState8();
+    m_isFrozen[0] &= ~UINT64_C(0x2);
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 21 from machine::REGION::busy to machine::REGION::parked.
+  ExecStat
+  transition21()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x2)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_isActive[0] & UINT64_C(0x1)) != 0) && m_bindings.guard(13, Signal::go))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeRegion10();
+    finalizeRegion15();
+    m_isFrozen[0] |= UINT64_C(0x2);
+    m_isFrozenShallowly[0] |= UINT64_C(0x2);
+    m_current_REGION = State::parked;
+    initState20();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 22 from machine::REGION::busy to machine::REGION::idle.
+  ExecStat
+  transition22()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x2)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_isActive[0] & UINT64_C(0x8)) != 0) && m_bindings.guard(14, Signal::poke))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_isFrozen[0] |= UINT64_C(0x2);
+    m_isFrozenShallowly[0] &= ~UINT64_C(0x2);
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 23 from machine::REGION::busy to machine::REGION::idle.
+  ExecStat
+  transition23()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x2)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_current_busy_left == State::busy_left_FINAL)) && ((m_current_busy_right == State::busy_right_FINAL)))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(7);
+    finalizeState8();
+    m_isFrozen[0] &= ~UINT64_C(0x2);
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 24 from machine::REGION::parked::REGION::INIT to machine::REGION::parked::REGION::p1.
+  ExecStat
+  transition24()
+  {
+    m_current_parked_REGION = State::parked_p1;
+    initState23();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 25 from machine::REGION::parked::REGION::p1 to machine::REGION::parked::REGION::p2.
+  ExecStat
+  transition25()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x80)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(((m_isActive[0] & UINT64_C(0x4)) != 0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState23();
+    m_isFrozen[0] &= ~UINT64_C(0x80);
+    m_current_parked_REGION = State::parked_p2;
+    initState24();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 26 from machine::REGION::parked::REGION::p1 to machine::REGION::parked::REGION::p2.
+  ExecStat
+  transition26()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x80)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(((m_isActive[0] & UINT64_C(0x20)) != 0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState23();
+    m_isFrozen[0] &= ~UINT64_C(0x80);
+    m_current_parked_REGION = State::parked_p2;
+    initState24();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 27 from machine::REGION::parked::REGION::p2 to machine::REGION::parked::REGION::p1.
+  ExecStat
+  transition27()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x100)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_isActive[0] & UINT64_C(0x4)) != 0) && m_bindings.guard(15, Signal::tick))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState24();
+    m_isFrozen[0] &= ~UINT64_C(0x100);
+    m_current_parked_REGION = State::parked_p1;
+    initState23();
+    return ExecStat{true, noRegion};
+  }
+
+  // Auto transition 28 from machine::REGION::parked::REGION::p1 to machine::REGION::parked::REGION::p2.
+  ExecStat
+  transition28()
+  {
+    if ((m_haveExecuted[0] & UINT64_C(0x8)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if ((m_isPaused[0] & UINT64_C(0x80)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(m_bindings.guard(3)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_haveExecuted[0] |= UINT64_C(0x8);
+    finalizeState23();
+    m_isFrozen[0] &= ~UINT64_C(0x80);
+    m_current_parked_REGION = State::parked_p2;
+    initState24();
+    return ExecStat{true, noRegion};
+  }
+
+  // Internal step transition 29 of machine::REGION::parked.
+  bool
+  transition29()
+  {
+    if ((m_haveExecuted[0] & UINT64_C(0x10)) != 0)
+    {
+      return false;
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x8)) != 0)
+    {
+      trigger = Signal::poke;
+    }
+    else
+    {
+      return false;
+    }
+    m_haveExecuted[0] |= UINT64_C(0x10);
+    m_isActive[0] |= UINT64_C(0x20);
+    m_bindings.action(18, trigger);
+    return true;
+  }
+
+  // Step transition 30 from machine::REGION::parked to machine::REGION::busy.
+  ExecStat
+  transition30()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x40)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!(((m_isActive[0] & UINT64_C(0x1)) != 0)))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState20();
+    m_isFrozen[0] &= ~UINT64_C(0x40);
+    m_current_REGION = State::busy;
+    initState8();
+    return ExecStat{true, noRegion};
+  }
+
+  // Step transition 31 from machine::REGION::parked::REGION::p2 to machine::REGION::idle.
+  ExecStat
+  transition31()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x100)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    Signal trigger{};
+    if ((m_isActive[0] & UINT64_C(0x2)) != 0)
+    {
+      trigger = Signal::stop;
+    }
+    else
+    {
+      return ExecStat{false, noRegion};
+    }
+    m_bindings.action(19, trigger);
+    finalizeState24();
+    m_isFrozen[0] &= ~UINT64_C(0x100);
+    exitState20();
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, 0};
+  }
+
+  // Step transition 32 from machine::REGION::parked to machine::REGION::idle.
+  ExecStat
+  transition32()
+  {
+    if ((m_isPaused[0] & UINT64_C(0x40)) != 0)
+    {
+      return ExecStat{false, noRegion};
+    }
+    if (!((((m_isActive[0] & UINT64_C(0x2)) != 0) && m_bindings.guard(16, Signal::stop))))
+    {
+      return ExecStat{false, noRegion};
+    }
+    finalizeState20();
+    m_isFrozen[0] &= ~UINT64_C(0x40);
+    m_current_REGION = State::idle;
+    initState6();
+    return ExecStat{true, noRegion};
+  }
+
+  void
+  reload()
+  {
+    std::memset(m_isActive, 0, sizeof(m_isActive));
+    std::memset(m_isPaused, 0, sizeof(m_isPaused));
+    std::memset(m_haveExecuted, 0, sizeof(m_haveExecuted));
+  }
+
+  Bindings & m_bindings;
+  State m_current_REGION;
+  State m_current_busy_left;
+  State m_current_busy_right;
+  State m_current_parked_REGION;
+  std::uint64_t m_isActive[1];
+  std::uint64_t m_isPaused[1];
+  std::uint64_t m_isFrozen[1];
+  std::uint64_t m_isFrozenShallowly[1];
+  std::uint64_t m_haveExecuted[1];
+};
+
+#endif // STATE_DIAGRAM_GENERATED_GENERATEDMACHINE_H_
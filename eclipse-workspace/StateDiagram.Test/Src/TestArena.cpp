@@ -0,0 +1,121 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(DiagramBuiltInArena)
+{
+  try
+  {
+    FSM_TOP(top);
+    ArenaScope const arena{top};
+
+    FSM_SIGNAL(int, go, top);
+    FSM_VAR(int, total, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+    FSM_STATE(busy, top);
+
+    FSM_LOCAL_SIGNAL(void, done, top);
+    FSM_INIT(busy);
+    FSM_STATE(working, busy);
+    FSM_FINAL(busy);
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP
+    (
+      idle, busy
+    , Trigger(go)
+    , Guard([&](Event const & trigger){return trigger.get<int>() > 0;})
+    , Action([&](Event const & trigger){total.nxt << total.get() + trigger.get<int>();})
+    );
+    FSM_AUTO(busy_INIT, working);
+    FSM_AUTO(working, busy_FINAL, Output(done));
+    FSM_STEP(busy, idle, Trigger(done));
+    Step const timeout{idle, busy, After(chrono::seconds{1})};
+
+    top.init();
+    top.step();
+    ASSERT(idle.isCurrent());
+
+    top.step(go(-1));
+    ASSERT(idle.isCurrent());
+    ASSERT_EQ(total.get(), 0);
+
+    top.step(go(3));
+    ASSERT(working.isCurrent());
+    ASSERT_EQ(total.get(), 3);
+
+    top.step();
+    ASSERT(idle.isCurrent());
+
+    // The timer has been armed when idle has been re-entered.
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{2}}));
+    ASSERT(working.isCurrent());
+    ASSERT_EQ(total.get(), 3);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(NestedArenaScopes)
+{
+  try
+  {
+    FSM_TOP(top1);
+    FSM_TOP(top2);
+    ArenaScope const arena1{top1};
+
+    FSM_SIGNAL(void, go, top1);
+    FSM_INIT(top1);
+    FSM_STATE(s1, top1);
+
+    {
+      ArenaScope const arena2{top2};
+
+      FSM_INIT(top2);
+      FSM_STATE(t1, top2);
+      FSM_STATE(t2, top2);
+      FSM_AUTO(top2_INIT, t1);
+      FSM_AUTO(t1, t2);
+
+      top2.init();
+      top2.step();
+      top2.step();
+      ASSERT(t2.isCurrent());
+    }
+
+    // Closing the inner scope reverts to the arena of the first top state.
+    FSM_STATE(s2, top1);
+    FSM_AUTO(top1_INIT, s1);
+    FSM_STEP(s1, s2, Trigger(go));
+
+    top1.init();
+    top1.step();
+    ASSERT(s1.isCurrent());
+    top1.step(go);
+    ASSERT(s2.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
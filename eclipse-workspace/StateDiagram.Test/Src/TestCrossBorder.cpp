@@ -465,3 +465,70 @@ TEST(UpwardToAncestorWithImplicitLeaveEnterTest)
   }
 }
 
+
+TEST(DeepCrossBorderExitEntryOrder)
+{
+  try
+  {
+    size_t constexpr depth{10};
+
+    string trace{};
+
+    FSM_TOP(top);
+
+    FSM_SIGNAL(void, up, top);
+    FSM_SIGNAL(void, down, top);
+
+    FSM_INIT(top);
+    FSM_STATE(shallow, top);
+
+    vector<unique_ptr<State>> nesters{};
+    vector<unique_ptr<Enter>> enters{};
+    vector<unique_ptr<Exit>> exits{};
+    for (size_t idx{0}; idx < depth; ++idx)
+    {
+      string const name{"nester" + to_string(idx)};
+      if (idx == 0)
+      {
+        nesters.push_back(make_unique<State>(name, top));
+      }
+      else
+      {
+        nesters.push_back(make_unique<State>(name, *nesters.back()));
+      }
+      char const tag{static_cast<char>('0' + idx)};
+      enters.push_back(make_unique<Enter>(*nesters.back(), Action([&trace, tag]{trace += '+'; trace += tag;})));
+      exits.push_back(make_unique<Exit>(*nesters.back(), Action([&trace, tag]{trace += '-'; trace += tag;})));
+    }
+
+    State const & deepest{*nesters.back()};
+    Auto t1(top_INIT, deepest);
+    Step t2(deepest, shallow, Trigger(up));
+    Step t3(shallow, deepest, Trigger(down));
+
+    top.init();
+    top.step();
+    ASSERT_EQ(trace, "+0+1+2+3+4+5+6+7+8+9");
+    for (auto const & nester : nesters)
+    {
+      ASSERT(nester->isCurrent());
+    }
+
+    trace.clear();
+    ASSERT(!top.step(up));
+    ASSERT_EQ(trace, "-9-8-7-6-5-4-3-2-1-0");
+    ASSERT(shallow.isCurrent());
+    ASSERT(!nesters.front()->isCurrent());
+
+    trace.clear();
+    ASSERT(!top.step(down));
+    ASSERT_EQ(trace, "+0+1+2+3+4+5+6+7+8+9");
+    ASSERT(!shallow.isCurrent());
+    ASSERT(nesters.back()->isCurrent());
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
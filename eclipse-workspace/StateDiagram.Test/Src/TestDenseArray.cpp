@@ -0,0 +1,335 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#include <numeric>
+
+TEST(ExternalDenseArraySetGet)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_DENSE_ARRAY(int, array, 4096, top);
+    array[4095].set(1);
+    array.set(0, 2);
+    ASSERT_EQ(array[4095].get(), 1);
+    ASSERT_EQ(array.get(0), 2);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(ExternalDenseArrayInit)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_DENSE_ARRAY(int, array, 2, top, {3, 4});
+    ASSERT_EQ(array[0].get(), 3);
+    ASSERT_EQ(array[1].cref(), 4);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArrayCommitsSetNxtElementsOnly)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(size_t, go, top);
+    FSM_DENSE_ARRAY(int, array, 130, top);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    FSM_AUTO(top_INIT, idle, Action([&]{for (size_t idx = 0; idx < 130; ++idx) {array[idx] << static_cast<int>(idx);}}));
+    FSM_STEP(idle, idle, Trigger(go), Action([&](Event const & trigger){auto const idx{trigger.get<size_t>()}; array[idx].nxt << array[idx].get() + 1000;}));
+
+    top.init();
+    top.step();
+
+    top.step(go(129));
+    top.step(go(64));
+    top.step(go(64));
+
+    ASSERT_EQ(array.get(0), 0);
+    ASSERT_EQ(array.get(63), 63);
+    ASSERT_EQ(array.get(64), 2064);
+    ASSERT_EQ(array.get(128), 128);
+    ASSERT_EQ(array.get(129), 1129);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArrayBulkAccess)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_DENSE_ARRAY(int, array, 100, top);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    int sum{0};
+    int window[30];
+
+    FSM_AUTO
+    (
+      top_INIT, idle
+    , Action
+      (
+        [&]
+        {
+          int * const nxt{array.nxtData()};
+          iota(nxt, nxt + 100, 0);
+        }
+      )
+    );
+    FSM_STEP
+    (
+      idle, idle
+    , Trigger(go)
+    , Action
+      (
+        [&]
+        {
+          int const * const cur{array.cdata()};
+          sum = accumulate(cur, cur + 100, 0);
+          array.get(60, 30, window);
+          for (auto & item : window)
+          {
+            item = -item;
+          }
+          array.setNxt(60, 30, window);
+        }
+      )
+    );
+
+    top.init();
+    top.step();
+
+    top.step(go);
+    ASSERT_EQ(sum, 4950);
+    ASSERT_EQ(array.get(59), 59);
+    ASSERT_EQ(array.get(60), -60);
+    ASSERT_EQ(array.get(89), -89);
+    ASSERT_EQ(array.get(90), 90);
+
+    top.step(go);
+    ASSERT_EQ(sum, 4950 - 2 * (60 + 89) * 30 / 2);
+    ASSERT_EQ(array.get(60), 60);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(LocalDenseArrayRegionInit)
+{
+  try
+  {
+    int val0;
+    int val1;
+
+    FSM_TOP(top);
+    FSM_REGION(region, top);
+    FSM_LOCAL_DENSE_ARRAY(int, array, 2, region, {3, 4});
+    FSM_INIT(region);
+    FSM_FINAL(region);
+    FSM_AUTO(region_INIT, region_FINAL, Action([&](){val0 = array[0].get(); val1 = array[1].get();}));
+
+    top.init();
+    top.step();
+
+    ASSERT_EQ(val0, 3);
+    ASSERT_EQ(val1, 4);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArrayInMachines)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_DENSE_ARRAY(string, array, 3, top, {"", "", ""});
+
+    FSM_INIT(top);
+    FSM_STATE(state, top);
+
+    FSM_AUTO(top_INIT, state);
+    Step t(state, state, Trigger(go), Action([&]{array[1].nxt << array[1].get() + "a";}));
+
+    top.init();
+
+    Machine const m1{top};
+    Machine const m2{top};
+
+    m1.step();
+    m2.step();
+    m1.step(go);
+    m1.step(go);
+    m2.step(go);
+
+    ASSERT_EQ(m1.get(array, 1), "aa");
+    ASSERT_EQ(m2.get(array, 1), "a");
+    ASSERT_EQ(m1.get(array, 0), "");
+    ASSERT_EQ(array.get(1), "");
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArrayIdxError)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_DENSE_ARRAY(int, array, 2, top);
+    array[2].get();
+    ASSERT(false);
+  }
+  catch (Array::IdxOutOfBoundsError const & err)
+  {
+    ASSERT_EQ(err.path, "array");
+    ASSERT_EQ(err.capacity, 2);
+    ASSERT_EQ(err.idx, 2);
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+TEST(DenseArrayGetOnNotValid)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_DENSE_ARRAY(int, array, 70, top);
+
+    FSM_INIT(top);
+    FSM_FINAL(top);
+    FSM_AUTO(top_INIT, top_FINAL, Action([&](){array[0] << 1; int to[70]; array.get(0, 70, to);}));
+
+    top.init();
+    top.step();
+
+    ASSERT(false);
+  }
+  catch (VarDelegate::GetOnNotValidError const & err)
+  {
+    ASSERT_EQ(err.path, "array[1]");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArraySetNxtOnAlreadySetNxt)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_DENSE_ARRAY(int, array, 70, top);
+
+    FSM_INIT(top);
+    FSM_FINAL(top);
+    FSM_AUTO(top_INIT, top_FINAL, Action([&](){array[65].nxt << 1; array.nxtData();}));
+
+    top.init();
+    top.step();
+
+    ASSERT(false);
+  }
+  catch (VarDelegate::SetNxtOnAlreadySetNxtError const & err)
+  {
+    ASSERT_EQ(err.path, "array[65]");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(DenseArraySetAfterGet)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_DENSE_ARRAY(int, array, 2, top);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+    FSM_FINAL(top);
+    FSM_AUTO(top_INIT, idle, Action([&](){array.set(1, 2);}));
+    FSM_STEP(idle, top_FINAL, Trigger(go), Action([&](){array[0].set(array[1].get()); array[1].set(0);}));
+
+    top.init();
+    top.step();
+    top.step(go);
+
+    ASSERT(false);
+  }
+  catch (VarDelegate::SetAfterGetError const & err)
+  {
+    ASSERT_EQ(err.path, "array[1]");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+#endif
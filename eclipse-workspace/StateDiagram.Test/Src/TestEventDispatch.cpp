@@ -0,0 +1,191 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(OnlyTriggeredStepFires)
+{
+  try
+  {
+    int nrOfGuardEvaluations{0};
+    bool sawT1{false};
+    bool sawT2{false};
+    bool sawT3{false};
+
+    FSM_TOP(topState);
+
+    FSM_SIGNAL(void, signal1, topState);
+    FSM_SIGNAL(void, signal2, topState);
+    FSM_SIGNAL(void, signal3, topState);
+
+    FSM_INIT(topState);
+    FSM_STATE(state, topState);
+    FSM_STATE(state1, topState);
+    FSM_STATE(state2, topState);
+    FSM_STATE(state3, topState);
+
+    Auto t(topState_INIT, state);
+    Step t1(state, state1, Trigger(signal1), Guard([&]{++nrOfGuardEvaluations; return true;}), Action([&]{sawT1 = true;}));
+    Step t2(state, state2, Trigger(signal2), Guard([&]{++nrOfGuardEvaluations; return true;}), Action([&]{sawT2 = true;}));
+    Step t3(state, state3, Trigger(signal3), Guard([&]{++nrOfGuardEvaluations; return true;}), Action([&]{sawT3 = true;}));
+
+    topState.init();
+    topState.step();
+
+    ASSERT(!topState.step(signal2));
+    ASSERT(!sawT1);
+    ASSERT(sawT2);
+    ASSERT(!sawT3);
+    ASSERT_EQ(nrOfGuardEvaluations, 1);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(ArmingDoesNotOutliveMacroStep)
+{
+  try
+  {
+    bool sawT1{false};
+    bool sawT2{false};
+
+    FSM_TOP(topState);
+
+    FSM_SIGNAL(void, signal1, topState);
+    FSM_SIGNAL(void, signal2, topState);
+
+    FSM_INIT(topState);
+    FSM_STATE(state1, topState);
+    FSM_STATE(state2, topState);
+    FSM_STATE(state3, topState);
+
+    Auto t(topState_INIT, state1);
+    Step t1(state1, state2, Trigger(signal1), Action([&]{sawT1 = true;}));
+    Step t2(state2, state3, Trigger(signal1), Trigger(signal2), Action([&]{sawT2 = true;}));
+
+    topState.init();
+    topState.step();
+
+    // The source state is paused after having been entered, so t2 must not fire within the same macro step.
+    topState.step(signal1);
+    ASSERT(sawT1);
+    ASSERT(!sawT2);
+
+    sawT1 = false;
+    topState.step();
+    ASSERT(!sawT1);
+    ASSERT(!sawT2);
+
+    topState.step(signal1, signal2);
+    ASSERT(!sawT1);
+    ASSERT(sawT2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(OutputArmsStepInOtherRegion)
+{
+  try
+  {
+    bool sawT1{false};
+    bool sawT2{false};
+
+    FSM_TOP(topState);
+
+    FSM_SIGNAL(void, signal, topState);
+    FSM_LOCAL_SIGNAL(void, local, topState);
+
+    FSM_REGION(region1, topState);
+    FSM_REGION(region2, topState);
+
+    FSM_INIT(region1);
+    FSM_STATE(state11, region1);
+    FSM_STATE(state12, region1);
+
+    FSM_INIT(region2);
+    FSM_STATE(state21, region2);
+    FSM_STATE(state22, region2);
+
+    Auto t11(region1_INIT, state11);
+    Auto t21(region2_INIT, state21);
+    Step t1(state11, state12, Trigger(signal), Output(local), Action([&]{sawT1 = true;}));
+    Step t2(state21, state22, Trigger(local), Action([&]{sawT2 = true;}));
+
+    topState.init();
+    topState.step();
+
+    topState.step(signal);
+    ASSERT(sawT1);
+    ASSERT(sawT2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(OutputArmsInternalStep)
+{
+  try
+  {
+    int nrOfInternalSteps{0};
+
+    FSM_TOP(topState);
+
+    FSM_SIGNAL(void, signal, topState);
+
+    FSM_INIT(topState);
+    FSM_STATE(outer, topState);
+    FSM_LOCAL_SIGNAL(void, local, outer);
+
+    FSM_INIT(outer);
+    FSM_STATE(state, outer);
+
+    FSM_REGION(region, state);
+    FSM_INIT(region);
+    FSM_STATE(subState1, region);
+    FSM_STATE(subState2, region);
+
+    Auto t(topState_INIT, outer);
+    Auto t0(outer_INIT, state);
+    Auto t1(region_INIT, subState1);
+    Step t2(subState1, subState2, Trigger(signal), Output(local));
+    InternalStep t3(state, Trigger(local), Max1Flag(), Action([&]{++nrOfInternalSteps;}));
+
+    topState.init();
+    topState.step();
+    ASSERT_EQ(nrOfInternalSteps, 0);
+
+    topState.step(signal);
+    ASSERT_EQ(nrOfInternalSteps, 1);
+
+    topState.step(signal);
+    ASSERT_EQ(nrOfInternalSteps, 1);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
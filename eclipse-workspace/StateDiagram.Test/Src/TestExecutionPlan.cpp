@@ -0,0 +1,82 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(TransitionAddedAfterInitIsPlanned)
+{
+  try
+  {
+    bool sawAction{false};
+
+    FSM_TOP(top);
+
+    FSM_INIT(top);
+    FSM_STATE(state1, top);
+    FSM_STATE(state2, top);
+
+    Auto t1(top_INIT, state1);
+
+    top.init();
+    top.step();
+
+    Auto t2(state1, state2, Guard([]{return true;}), Action([&]{sawAction = true;}));
+
+    top.step();
+    ASSERT(sawAction);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(NestedSpecsArePlannedPerTransition)
+{
+  try
+  {
+    int nrOfOuterActions{0};
+    int nrOfInnerActions{0};
+
+    FSM_TOP(top);
+
+    FSM_SIGNAL(void, signal, top);
+
+    FSM_INIT(top);
+    FSM_STATE(outer, top);
+    FSM_INIT(outer);
+    FSM_STATE(inner, outer);
+
+    Auto t1(top_INIT, outer, Action([&]{++nrOfOuterActions;}), Action([&]{++nrOfOuterActions;}));
+    Auto t2(outer_INIT, inner, Guard([]{return true;}), Action([&]{++nrOfInnerActions;}));
+    InternalStep t3(inner, Trigger(signal), Action([&]{++nrOfInnerActions;}), Max1Flag());
+
+    top.init();
+    top.step();
+    ASSERT_EQ(nrOfOuterActions, 2);
+    ASSERT_EQ(nrOfInnerActions, 1);
+
+    top.step(signal);
+    ASSERT_EQ(nrOfOuterActions, 2);
+    ASSERT_EQ(nrOfInnerActions, 2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
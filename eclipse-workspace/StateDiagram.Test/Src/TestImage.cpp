@@ -0,0 +1,232 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+  uint32_t constexpr intTypeId{1};
+  uint32_t constexpr isEvenSlot{0};
+  uint32_t constexpr countSlot{0};
+
+  // A top state with an initial state and two regular states, the second one of which activates a local signal
+  // that its region reacts to.
+  struct Diagram
+  {
+    ImageWriter writer{"top"};
+    Image::Idx go{writer.addExternalSignal("go", intTypeId)};
+    Image::Idx total{writer.addExternalVar("total", intTypeId)};
+    Image::Idx init{writer.addInit(Image::topIdx)};
+    Image::Idx idle{writer.addState("idle", Image::topIdx)};
+    Image::Idx busy{writer.addState("busy", Image::topIdx)};
+    Image::Idx ping{writer.addLocalSignal("ping", busy)};
+    Image::Idx inner{writer.addRegion("inner", busy)};
+    Image::Idx innerInit{writer.addInit(inner)};
+    Image::Idx waiting{writer.addState("waiting", inner)};
+    Image::Idx pinged{writer.addState("pinged", inner)};
+
+    Diagram()
+    {
+      writer.addAuto(init, idle);
+      Image::Idx const start{writer.addStep(idle, busy)};
+      writer.addTrigger(start, go);
+      writer.addGuard(start, isEvenSlot);
+      writer.addAction(start, countSlot);
+      writer.addAuto(innerInit, waiting);
+      Image::Idx const emit{writer.addInternalStep(busy)};
+      writer.addTrigger(emit, go);
+      writer.addOutput(emit, ping);
+      writer.addMax1Flag(emit);
+      writer.addTrigger(writer.addStep(waiting, pinged), ping);
+    }
+  };
+}
+
+TEST(ImageRoundTrip)
+{
+  try
+  {
+    Diagram const diagram;
+    vector<char> const bytes{diagram.writer.bytes()};
+    Image const image{bytes.data(), bytes.size()};
+    ASSERT_EQ(image.size(), bytes.size());
+    ASSERT_EQ(image.nrOfComponents(), 11);
+    ASSERT_EQ(image.nrOfTransitions(), 5);
+
+    int nrOfStarts{0};
+    ImageBindings const bindings;
+    bindings.bindSignalType<int>(intTypeId);
+    bindings.bindVarType<int>(intTypeId);
+    bindings.bind(isEvenSlot, Guard([](Event const & trigger){return trigger.get<int>() % 2 == 0;}));
+    bindings.bind(countSlot, Action([&]{++nrOfStarts;}));
+
+    ImageTop const loaded{image, bindings};
+    Top const & top{loaded.top()};
+    ExternalSignal<int> & go{loaded.externalSignal<int>(diagram.go)};
+    top.init();
+    top.step();
+    ASSERT(loaded.subState(diagram.idle).isCurrent());
+    ASSERT_EQ(loaded.externalVar<int>(diagram.total).get(), 0);
+
+    top.step(go(1));
+    ASSERT(loaded.subState(diagram.idle).isCurrent());
+    ASSERT_EQ(nrOfStarts, 0);
+
+    top.step(go(2));
+    ASSERT(loaded.subState(diagram.busy).isCurrent());
+    ASSERT(loaded.subState(diagram.waiting).isCurrent());
+    ASSERT_EQ(nrOfStarts, 1);
+
+    top.step(go(3));
+    ASSERT(loaded.subState(diagram.busy).isCurrent());
+    ASSERT(loaded.subState(diagram.pinged).isCurrent());
+    ASSERT_EQ(nrOfStarts, 1);
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+    ASSERT_EQ(loaded.subState(diagram.pinged).path(), "top::REGION::busy::inner::pinged");
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(ImageMappedFromFile)
+{
+  char const * const path{"TestImage.sdim"};
+  try
+  {
+    Diagram const diagram;
+    diagram.writer.write(path);
+
+    ImageBindings const bindings;
+    bindings.bindSignalType<int>(intTypeId);
+    bindings.bindVarType<int>(intTypeId);
+    bindings.bind(isEvenSlot, Guard([]{return true;}));
+    bindings.bind(countSlot, Action([]{}));
+
+    unique_ptr<ImageTop const> loaded;
+    {
+      // The image is no longer referred to once the top state has been loaded from it.
+      Image const image{path};
+      loaded = make_unique<ImageTop const>(image, bindings);
+    }
+    remove(path);
+
+    Top const & top{loaded->top()};
+    top.init();
+    Machine const machine{top};
+    machine.step();
+    machine.step(loaded->externalSignal<int>(diagram.go)(4));
+    ASSERT(machine.isCurrent(loaded->subState(diagram.busy)));
+    ASSERT(loaded->subState(diagram.init).isCurrent());
+  }
+  catch (Error const & err)
+  {
+    remove(path);
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(MalformedImageIsRejected)
+{
+  vector<char> bytes{Diagram{}.writer.bytes()};
+  bytes[0] = 'X';
+  try
+  {
+    Image const image{bytes.data(), bytes.size()};
+    ASSERT(false);
+  }
+  catch (Image::FormatError const & err)
+  {
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    Image const image{bytes.data(), 16};
+    ASSERT(false);
+  }
+  catch (Image::FormatError const & err)
+  {
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    ImageWriter const writer{"top"};
+    writer.addState("orphan", 5);
+    writer.bytes();
+    ASSERT(false);
+  }
+  catch (Image::FormatError const & err)
+  {
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    Image const image{"NonExistent.sdim"};
+    ASSERT(false);
+  }
+  catch (Image::FileError const & err)
+  {
+    ASSERT_EQ(err.path, "NonExistent.sdim");
+    cout << err.msg(); cout.flush();
+  }
+}
+
+TEST(UnboundImageIdIsRejected)
+{
+  Diagram const diagram;
+  vector<char> const bytes{diagram.writer.bytes()};
+  Image const image{bytes.data(), bytes.size()};
+  ImageBindings const bindings;
+  bindings.bindSignalType<int>(intTypeId);
+  bindings.bindVarType<int>(intTypeId);
+  bindings.bind(isEvenSlot, Guard([]{return true;}));
+  try
+  {
+    ImageTop const loaded{image, bindings};
+    ASSERT(false);
+  }
+  catch (ImageTop::UnboundError const & err)
+  {
+    ASSERT_EQ(err.idKind, "action slot");
+    ASSERT_EQ(err.id, countSlot);
+    cout << err.msg(); cout.flush();
+  }
+
+  bindings.bind(countSlot, Action([]{}));
+  try
+  {
+    ImageTop const loaded{image, bindings};
+    loaded.externalSignal<string>(diagram.go);
+    ASSERT(false);
+  }
+  catch (ImageTop::ComponentError const & err)
+  {
+    ASSERT_EQ(err.idx, diagram.go);
+    cout << err.msg(); cout.flush();
+  }
+}
@@ -0,0 +1,361 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "GeneratedMachine.h"
+
+// GeneratedMachine.h has been generated by ImageCodeGenerator from the image of the diagram below, with the class
+// name GeneratedMachine, so it is to be generated anew whenever the diagram is changed.
+
+namespace
+{
+  // Guards and actions of triggerless transitions have slot IDs below this one, those of triggered ones from here on.
+  uint32_t constexpr firstTriggeredSlot{10};
+  uint32_t constexpr nrOfSlots{20};
+
+  // A top state whose default region holds a connector and three regular states, one of which has two regions
+  // with final states and a local signal, another one a default region of its own and a local signal.
+  struct Diagram
+  {
+    ImageWriter writer{"machine"};
+    Image::Idx go{writer.addExternalSignal("go")};
+    Image::Idx stop{writer.addExternalSignal("stop")};
+    Image::Idx tick{writer.addExternalSignal("tick")};
+    Image::Idx poke{writer.addExternalSignal("poke")};
+    Image::Idx init{writer.addInit(Image::topIdx)};
+    Image::Idx idle{writer.addState("idle", Image::topIdx)};
+    Image::Idx fork{writer.addConnector("fork", Image::topIdx)};
+    Image::Idx busy{writer.addState("busy", Image::topIdx)};
+    Image::Idx ping{writer.addLocalSignal("ping", busy)};
+    Image::Idx left{writer.addRegion("left", busy)};
+    Image::Idx leftInit{writer.addInit(left)};
+    Image::Idx l1{writer.addState("l1", left)};
+    Image::Idx l2{writer.addState("l2", left)};
+    Image::Idx leftFinal{writer.addFinal(left)};
+    Image::Idx right{writer.addRegion("right", busy)};
+    Image::Idx rightInit{writer.addInit(right)};
+    Image::Idx r1{writer.addState("r1", right)};
+    Image::Idx r2{writer.addState("r2", right)};
+    Image::Idx rightFinal{writer.addFinal(right)};
+    Image::Idx parked{writer.addState("parked", Image::topIdx)};
+    Image::Idx nudge{writer.addLocalSignal("nudge", parked)};
+    Image::Idx parkedInit{writer.addInit(parked)};
+    Image::Idx p1{writer.addState("p1", parked)};
+    Image::Idx p2{writer.addState("p2", parked)};
+
+    Diagram()
+    {
+      writer.addAction(writer.addAuto(init, idle), 0);
+      add(writer.addStep(idle, busy), {go}, {10}, {10});
+      add(writer.addStep(idle, fork), {tick, poke, tick}, {}, {11});
+      add(writer.addAuto(fork, busy), {}, {0}, {});
+      add(writer.addAuto(fork, parked), {}, {}, {1});
+      add(writer.addStep(idle, r2), {stop}, {11}, {12});
+
+      add(writer.addEnter(busy), {}, {1}, {2});
+      add(writer.addEnter(busy), {}, {}, {3});
+      add(writer.addExit(busy), {}, {}, {4});
+      Image::Idx const emit{writer.addInternalStep(busy)};
+      add(emit, {tick}, {}, {13});
+      writer.addOutput(emit, ping);
+      writer.addMax1Flag(emit);
+      Image::Idx const recheck{writer.addInternalAuto(busy)};
+      writer.addMax1Flag(recheck);
+      add(recheck, {}, {2}, {5});
+
+      writer.addAuto(leftInit, l1);
+      add(writer.addStep(l1, l2), {tick}, {}, {14});
+      add(writer.addStep(l2, leftFinal), {poke}, {}, {});
+      add(writer.addExit(l2), {}, {}, {6});
+      writer.addAuto(rightInit, r1);
+      add(writer.addStep(r1, r2), {ping}, {}, {15});
+      add(writer.addStep(r2, r1), {go}, {12}, {});
+      add(writer.addStep(r2, rightFinal), {poke}, {}, {});
+      Image::Idx const escape{writer.addStep(r2, idle)};
+      add(escape, {stop}, {}, {16});
+      writer.addMax1Flag(escape);
+
+      Image::Idx const complete{writer.addStep(busy, idle)};
+      add(complete, {stop}, {}, {17});
+      writer.addCompletionFlag(complete);
+      Image::Idx const park{writer.addStep(busy, parked)};
+      add(park, {go}, {13}, {});
+      writer.addFreezeFlag(park, FreezeDepth::SHALLOW);
+      Image::Idx const suspend{writer.addStep(busy, idle)};
+      add(suspend, {poke}, {14}, {});
+      writer.addFreezeFlag(suspend, FreezeDepth::FULL);
+      Image::Idx const finish{writer.addAuto(busy, idle)};
+      writer.addCompletionFlag(finish);
+      writer.addAction(finish, 7);
+
+      writer.addAuto(parkedInit, p1);
+      add(writer.addStep(p1, p2), {tick}, {}, {});
+      add(writer.addStep(p1, p2), {nudge}, {}, {});
+      add(writer.addStep(p2, p1), {tick}, {15}, {});
+      Image::Idx const hop{writer.addAuto(p1, p2)};
+      writer.addMax1Flag(hop);
+      writer.addGuard(hop, 3);
+      Image::Idx const prod{writer.addInternalStep(parked)};
+      add(prod, {poke}, {}, {18});
+      writer.addOutput(prod, nudge);
+      writer.addMax1Flag(prod);
+      add(writer.addStep(parked, busy), {go}, {}, {});
+      add(writer.addStep(p2, idle), {stop}, {}, {19});
+      add(writer.addStep(parked, idle), {stop}, {16}, {});
+    }
+
+    void
+    add
+    (
+      Image::Idx const transition
+    , initializer_list<Image::Idx> const triggers
+    , initializer_list<uint32_t> const guards
+    , initializer_list<uint32_t> const actions
+    )
+    {
+      for (auto const trigger : triggers)
+      {
+        writer.addTrigger(transition, trigger);
+      }
+      for (auto const guard : guards)
+      {
+        writer.addGuard(transition, guard);
+      }
+      for (auto const action : actions)
+      {
+        writer.addAction(transition, action);
+      }
+    }
+  };
+
+  // Guards yield pseudo-random results that only depend on the number of guards called so far, so that two machines
+  // calling the same guards in the same order see the same results. Calls are traced along with their triggers.
+  class Recorder
+  {
+  public:
+    bool
+    guard(uint32_t const slotId, string const & trigger)
+    {
+      m_random = m_random * 6364136223846793005u + 1442695040888963407u;
+      bool const result{(m_random >> 62) != 0};
+      trace += "g" + to_string(slotId) + trigger + (result ? "+ " : "- ");
+      return result;
+    }
+
+    void
+    action(uint32_t const slotId, string const & trigger)
+    {
+      trace += "a" + to_string(slotId) + trigger + " ";
+    }
+
+    string trace{};
+
+  private:
+    uint64_t m_random{0};
+  };
+
+  // Bindings of the generated machine, which name triggers just like the engine does.
+  class Bindings
+  {
+  public:
+    Recorder & recorder;
+    vector<string> const & triggers;
+
+    bool
+    guard(uint32_t const slotId)
+    {
+      return recorder.guard(slotId, "");
+    }
+
+    template<class Signal>
+    bool
+    guard(uint32_t const slotId, Signal const trigger)
+    {
+      return recorder.guard(slotId, triggers[static_cast<uint32_t>(trigger)]);
+    }
+
+    void
+    action(uint32_t const slotId)
+    {
+      recorder.action(slotId, "");
+    }
+
+    template<class Signal>
+    void
+    action(uint32_t const slotId, Signal const trigger)
+    {
+      recorder.action(slotId, triggers[static_cast<uint32_t>(trigger)]);
+    }
+  };
+
+  string
+  triggerOf(Event const & trigger)
+  {
+    return "(" + trigger.path() + ")";
+  }
+}
+
+TEST(GeneratedMachineMatchesEngine)
+{
+  try
+  {
+    Diagram const diagram;
+    vector<char> const bytes{diagram.writer.bytes()};
+    Image const image{bytes.data(), bytes.size()};
+
+    Recorder interpreted;
+    ImageBindings const bindings;
+    for (uint32_t slotId{0}; slotId < firstTriggeredSlot; ++slotId)
+    {
+      bindings.bind(slotId, Guard([&, slotId]{return interpreted.guard(slotId, "");}));
+      bindings.bind(slotId, Action([&, slotId]{interpreted.action(slotId, "");}));
+    }
+    for (uint32_t slotId{firstTriggeredSlot}; slotId < nrOfSlots; ++slotId)
+    {
+      auto const guard{[&, slotId](Event const & trigger){return interpreted.guard(slotId, triggerOf(trigger));}};
+      auto const action{[&, slotId](Event const & trigger){interpreted.action(slotId, triggerOf(trigger));}};
+      bindings.bind(slotId, Guard(guard));
+      bindings.bind(slotId, Action(action));
+    }
+    ImageTop const loaded{image, bindings};
+    Top const & top{loaded.top()};
+    top.setSchedulingPolicy(Top::SchedulingPolicy::DECLARATION_ORDER);
+
+    Recorder generated;
+    vector<string> triggers(image.nrOfComponents());
+    Image::Idx const externalSignals[]{diagram.go, diagram.stop, diagram.tick, diagram.poke};
+    for (auto const signal : externalSignals)
+    {
+      triggers[signal] = triggerOf(loaded.externalEvent(signal));
+    }
+    triggers[diagram.ping] = "(machine::REGION::busy::ping)";
+    triggers[diagram.nudge] = "(machine::REGION::parked::nudge)";
+    Bindings generatedBindings{generated, triggers};
+    using Machine = GeneratedMachine<Bindings>;
+    Machine machine{generatedBindings};
+
+    struct Member
+    {
+      Image::Idx subState;
+      Machine::Region region;
+    };
+    Member const members[]
+    {
+      {diagram.init, Machine::Region::REGION}
+    , {diagram.idle, Machine::Region::REGION}
+    , {diagram.fork, Machine::Region::REGION}
+    , {diagram.busy, Machine::Region::REGION}
+    , {diagram.parked, Machine::Region::REGION}
+    , {diagram.leftInit, Machine::Region::busy_left}
+    , {diagram.l1, Machine::Region::busy_left}
+    , {diagram.l2, Machine::Region::busy_left}
+    , {diagram.leftFinal, Machine::Region::busy_left}
+    , {diagram.rightInit, Machine::Region::busy_right}
+    , {diagram.r1, Machine::Region::busy_right}
+    , {diagram.r2, Machine::Region::busy_right}
+    , {diagram.rightFinal, Machine::Region::busy_right}
+    , {diagram.parkedInit, Machine::Region::parked_REGION}
+    , {diagram.p1, Machine::Region::parked_REGION}
+    , {diagram.p2, Machine::Region::parked_REGION}
+    };
+    auto const assertSameCurrents
+    {
+      [&]
+      {
+        for (auto const & member : members)
+        {
+          bool const isGeneratedCurrent{machine.current(member.region) == static_cast<Machine::State>(member.subState)};
+          ASSERT_EQ(loaded.subState(member.subState).isCurrent(), isGeneratedCurrent);
+        }
+      }
+    };
+
+    top.init();
+    machine.init();
+    assertSameCurrents();
+
+    minstd_rand random{2020};
+    for (int stepNr{0}; stepNr < 5000; ++stepNr)
+    {
+      for (auto const signal : externalSignals)
+      {
+        if (random() % 3 == 0)
+        {
+          ASSERT(top.post(loaded.externalSignal<void>(signal)));
+          machine.activate(static_cast<Machine::Signal>(signal));
+          interpreted.trace += triggers[signal];
+          generated.trace += triggers[signal];
+        }
+      }
+      ASSERT_EQ(top.step(), machine.step());
+      ASSERT_EQ(interpreted.trace, generated.trace);
+      assertSameCurrents();
+      interpreted.trace.clear();
+      generated.trace.clear();
+    }
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(UnsupportedImageIsRejected)
+{
+  try
+  {
+    ImageWriter const writer{"top"};
+    writer.addExternalVar("total", 1);
+    vector<char> const bytes{writer.bytes()};
+    Image const image{bytes.data(), bytes.size()};
+    ImageCodeGenerator const generator{image, "Machine"};
+    ASSERT(false);
+  }
+  catch (ImageCodeGenerator::UnsupportedError const & err)
+  {
+    ASSERT_EQ(err.itemKind, "component");
+    ASSERT_EQ(err.idx, 1);
+  }
+
+  try
+  {
+    ImageWriter const writer{"top"};
+    Image::Idx const init{writer.addInit(Image::topIdx)};
+    Image::Idx const idle{writer.addState("idle", Image::topIdx)};
+    writer.addAuto(init, idle);
+    writer.addAfter(writer.addStep(idle, idle), Top::Duration{1000});
+    vector<char> const bytes{writer.bytes()};
+    Image const image{bytes.data(), bytes.size()};
+    ImageCodeGenerator const generator{image, "Machine"};
+    ASSERT(false);
+  }
+  catch (ImageCodeGenerator::UnsupportedError const & err)
+  {
+    ASSERT_EQ(err.itemKind, "transition");
+    ASSERT_EQ(err.idx, 1);
+    ASSERT_EQ(err.reason, "timer specs rest on the engine");
+  }
+}
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
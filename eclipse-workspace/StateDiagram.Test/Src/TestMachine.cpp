@@ -0,0 +1,104 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(MachinesStepIndependently)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_VAR(int, count, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+    FSM_STATE(busy, top);
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP(idle, busy, Trigger(go), Action([&]{count.nxt << count.get() + 1;}));
+    FSM_STEP(busy, idle, Trigger(go));
+
+    top.init();
+
+    Machine const m1{top};
+    Machine const m2{top};
+
+    m1.step();
+    ASSERT(m1.isCurrent(idle));
+    ASSERT(m2.isCurrent(top_INIT));
+
+    m1.step(go);
+    m2.step();
+    ASSERT(m1.isCurrent(busy));
+    ASSERT(m2.isCurrent(idle));
+    ASSERT_EQ(m1.get(count), 1);
+    ASSERT_EQ(m2.get(count), 0);
+
+    m1.step(go);
+    m1.step(go);
+    m2.step(go);
+    ASSERT(m1.isCurrent(busy));
+    ASSERT(m2.isCurrent(busy));
+    ASSERT_EQ(m1.get(count), 2);
+    ASSERT_EQ(m2.get(count), 1);
+
+    // The runtime state of the top state itself is left as it was.
+    ASSERT(top_INIT.isCurrent());
+    ASSERT_EQ(count.get(), 0);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(MachineCopy)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_VAR(string, trace, top, string{});
+
+    FSM_INIT(top);
+    FSM_STATE(state, top);
+
+    FSM_AUTO(top_INIT, state);
+    Step t(state, state, Trigger(go), Action([&]{trace.nxt << trace.get() + "a";}));
+
+    top.init();
+
+    Machine const original{top};
+    original.step();
+    original.step(go);
+
+    Machine const copy{original};
+    copy.step(go);
+    copy.step(go);
+    original.step(go);
+
+    ASSERT_EQ(original.get(trace), "aa");
+    ASSERT_EQ(copy.get(trace), "aaa");
+    ASSERT_EQ(trace.get(), "");
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -0,0 +1,103 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+namespace
+{
+  class Counter
+  {
+  public:
+    Counter()
+    {
+      top.init();
+    }
+
+    FSM_TOP(top);
+    FSM_SIGNAL(void, tick, top);
+    FSM_SIGNAL(void, reset, top);
+    FSM_VAR(int, count, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(counting, top);
+    FSM_FINAL(top);
+
+    FSM_AUTO(top_INIT, counting);
+    Step const t1{counting, counting, Trigger(tick), Action([this]{count.nxt << count.get() + 1;})};
+    Step const t2{counting, top_FINAL, Trigger(reset)};
+  };
+}
+
+TEST(MachinePoolStepsAllMachines)
+{
+  try
+  {
+    Counter const counter0{};
+    Counter const counter1{};
+    Counter const counter2{};
+    Counter const counter3{};
+
+    MachinePool const pool{{counter0.top, counter1.top, counter2.top, counter3.top}};
+    ASSERT_EQ(pool.nrOfWorkers(), 4u);
+
+    size_t constexpr nrOfMachines{200};
+    for (size_t idx{0}; idx < nrOfMachines; ++idx)
+    {
+      ASSERT_EQ(pool.add(), idx);
+      pool.submit(idx);
+      for (size_t nrOfTicks{0}; nrOfTicks < idx % 5; ++nrOfTicks)
+      {
+        pool.submit(idx, counter0.tick);
+      }
+    }
+    pool.run();
+
+    for (size_t idx{0}; idx < nrOfMachines; ++idx)
+    {
+      ASSERT(pool[idx].isCurrent(counter0.counting));
+      ASSERT_EQ(pool[idx].get(counter0.count), static_cast<int>(idx % 5));
+    }
+
+    for (size_t idx{0}; idx < nrOfMachines; idx += 2)
+    {
+      pool.submit(idx, counter0.tick);
+      pool.submit(idx, counter0.reset);
+    }
+    pool.run();
+
+    for (size_t idx{0}; idx < nrOfMachines; ++idx)
+    {
+      bool const isEven{idx % 2 == 0};
+      ASSERT_EQ(pool[idx].isCurrent(counter0.top_FINAL), isEven);
+      ASSERT_EQ(pool[idx].get(counter0.count), static_cast<int>(idx % 5 + (isEven ? 1 : 0)));
+    }
+
+    for (size_t workerIdx{0}; workerIdx < pool.nrOfWorkers(); ++workerIdx)
+    {
+      ASSERT(pool.utilization(workerIdx) >= 0.0);
+      ASSERT(pool.utilization(workerIdx) <= 1.0);
+    }
+
+    // The top states themselves are left as they were.
+    ASSERT(counter0.top_INIT.isCurrent());
+    ASSERT(counter3.top_INIT.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -402,3 +402,74 @@ TEST(OutputScopeErrorOnTriggeredMultipleOutputStep)
   }
 }
 #endif
+
+TEST(MultipleEmittedOutputOnAuto)
+{
+  try
+  {
+    bool sawFinalStep{false};
+
+    FSM_TOP(top);
+
+    FSM_LOCAL_SIGNAL(void, signal1, top);
+    FSM_LOCAL_SIGNAL(void, signal2, top);
+
+    FSM_INIT(top);
+    FSM_CONNECTOR(connector1, top);
+    FSM_CONNECTOR(connector2, top);
+    FSM_FINAL(top);
+
+    FSM_AUTO(top_INIT, connector1, Output([&](Output::Emitter const & emit){emit(signal1); emit(signal2);}));
+    FSM_STEP(connector1, connector2, Trigger(signal1));
+    FSM_STEP(connector2, top_FINAL, Trigger(signal2), Action([&](){sawFinalStep = true;}));
+
+    top.init();
+    top.step();
+
+    ASSERT(sawFinalStep);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(MultipleTriggeredEmittedOutputOnStep)
+{
+  try
+  {
+    int testVar{0};
+
+    FSM_TOP(top);
+
+    FSM_SIGNAL(int, signal, top);
+
+    FSM_LOCAL_SIGNAL(void, signal1, top);
+    FSM_LOCAL_SIGNAL(int, signal2, top);
+
+    FSM_INIT(top);
+    FSM_CONNECTOR(connector1, top);
+    FSM_CONNECTOR(connector2, top);
+    FSM_FINAL(top);
+
+    FSM_STEP
+    (
+      top_INIT, connector1
+    , Trigger(signal)
+    , Output([&](Event const & trigger, Output::Emitter const & emit){emit(signal1); emit(signal2(trigger.get<int>()));})
+    );
+    FSM_STEP(connector1, connector2, Trigger(signal1));
+    FSM_STEP(connector2, top_FINAL, Trigger(signal2), Action([&](Event const & trigger){testVar = trigger.get<int>();}));
+
+    top.init();
+    top.step(signal(2));
+
+    ASSERT_EQ(testVar, 2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -0,0 +1,66 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(PathsOfNestedComponents)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_REGION(left, top);
+    FSM_REGION(right, top);
+    FSM_STATE(outer, left);
+    FSM_STATE(inner, outer);
+    FSM_LOCAL_SIGNAL(void, signal, outer);
+
+    ASSERT_EQ(top.path(), "top");
+    ASSERT_EQ(left.path(), "top::left");
+    ASSERT_EQ(inner.path(), "top::left::outer::REGION::inner");
+    ASSERT_EQ(signal.path(), "top::left::outer::signal");
+
+    // Paths are built once and handed out by reference from then on.
+    ASSERT(&inner.path() == &inner.path());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(EqualNamesShareStorage)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_REGION(left, top);
+    FSM_REGION(right, top);
+    Region const & leftRegion{left};
+    Region const & rightRegion{right};
+    State const leftIdle{"idle", leftRegion};
+    State const rightIdle{"idle", rightRegion};
+
+    ASSERT_EQ(leftIdle.path(), "top::left::idle");
+    ASSERT_EQ(rightIdle.path(), "top::right::idle");
+    ASSERT(&leftIdle.name() == &rightIdle.name());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -326,3 +326,34 @@ TEST(TupleTypedSignal2TTLocal)
 }
 
 
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+TEST(TriggerTypeMismatchError)
+{
+  try
+  {
+    FSM_TOP(top);
+    ExternalSignal<int> signal("signal", top);
+
+    FSM_INIT(top);
+    FSM_FINAL(top);
+    FSM_STEP(top_INIT, top_FINAL, Trigger(signal), Action([&](Event const & trigger){trigger.get<unsigned>();}));
+
+    top.init();
+    top.step(signal(1));
+
+    ASSERT(false);
+  }
+  catch (SignalDelegate::TypeMismatchOnSetError const & err)
+  {
+    ASSERT_EQ(err.path, "signal");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -0,0 +1,204 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#include <thread>
+
+TEST(PostedSignalCarriesPayload)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(string, word, top);
+    FSM_SIGNAL(void, stop, top);
+    FSM_VAR(string, trace, top, string{});
+
+    FSM_INIT(top);
+    FSM_STATE(listening, top);
+    FSM_FINAL(top);
+
+    FSM_AUTO(top_INIT, listening);
+    Step const t1{listening, listening, Trigger(word), Action([&]{trace.nxt << trace.get() + word.get();})};
+    Step const t2{listening, top_FINAL, Trigger(stop)};
+
+    top.init();
+    top.step();
+
+    string text{"abc"};
+    ASSERT(top.post(word, move(text)));
+    ASSERT(!top.step());
+    ASSERT_EQ(trace.get(), "abc");
+    ASSERT(listening.isCurrent());
+
+    ASSERT(top.post(word, "de"));
+    ASSERT(!top.step());
+    ASSERT_EQ(trace.get(), "abcde");
+
+    ASSERT(top.post(stop));
+    ASSERT(top.step());
+    ASSERT(top_FINAL.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(RepeatedPostEndsBatch)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(int, add, top);
+    FSM_SIGNAL(void, tick, top);
+    FSM_VAR(int, sum, top, 0);
+    FSM_VAR(int, ticks, top, 0);
+
+    FSM_REGION(r1, top);
+    FSM_REGION(r2, top);
+    FSM_INIT(r1);
+    FSM_INIT(r2);
+    FSM_STATE(adding, r1);
+    FSM_STATE(ticking, r2);
+
+    FSM_AUTO(r1_INIT, adding);
+    FSM_AUTO(r2_INIT, ticking);
+    Step const t1{adding, adding, Trigger(add), Action([&]{sum.nxt << sum.get() + add.get();})};
+    Step const t2{ticking, ticking, Trigger(tick), Action([&]{ticks.nxt << ticks.get() + 1;})};
+
+    top.init();
+    top.step();
+
+    ASSERT(top.post(add, 1));
+    ASSERT(top.post(tick));
+    ASSERT(top.post(add, 2));
+    ASSERT(top.post(tick));
+
+    top.step();
+    ASSERT_EQ(sum.get(), 1);
+    ASSERT_EQ(ticks.get(), 1);
+
+    // A signal activated explicitly counts as already activated for the posts as well.
+    top.step(add(10));
+    ASSERT_EQ(sum.get(), 11);
+    ASSERT_EQ(ticks.get(), 1);
+
+    top.step();
+    ASSERT_EQ(sum.get(), 13);
+    ASSERT_EQ(ticks.get(), 2);
+
+    top.step();
+    ASSERT_EQ(sum.get(), 13);
+    ASSERT_EQ(ticks.get(), 2);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(PostOnFullQueue)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(int, add, top);
+    FSM_VAR(int, sum, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(adding, top);
+
+    FSM_AUTO(top_INIT, adding);
+    Step const t{adding, adding, Trigger(add), Action([&]{sum.nxt << sum.get() + add.get();})};
+
+    top.init();
+    top.step();
+
+    for (size_t idx{0}; idx < Top::postCapacity; ++idx)
+    {
+      ASSERT(top.post(add, 1));
+    }
+    ASSERT(!top.post(add, 1));
+
+    top.step();
+    ASSERT(top.post(add, 1));
+    ASSERT_EQ(sum.get(), 1);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(PostFromManyThreads)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(int, add, top);
+    FSM_VAR(int, sum, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(adding, top);
+
+    FSM_AUTO(top_INIT, adding);
+    Step const t{adding, adding, Trigger(add), Action([&]{sum.nxt << sum.get() + add.get();})};
+
+    top.init();
+    top.step();
+
+    int constexpr nrOfProducers{4};
+    int constexpr nrOfPostsPerProducer{2000};
+    vector<thread> producers{};
+    for (int producerIdx{0}; producerIdx < nrOfProducers; ++producerIdx)
+    {
+      producers.emplace_back
+      (
+        [&top, &add, producerIdx]
+        {
+          for (int postIdx{0}; postIdx < nrOfPostsPerProducer; ++postIdx)
+          {
+            while (!top.post(add, producerIdx + 1))
+            {
+              this_thread::yield();
+            }
+          }
+        }
+      );
+    }
+
+    int constexpr expectedSum{nrOfPostsPerProducer * nrOfProducers * (nrOfProducers + 1) / 2};
+    while (sum.get() != expectedSum)
+    {
+      top.step();
+    }
+    for (auto & producer : producers)
+    {
+      producer.join();
+    }
+    top.step();
+    ASSERT_EQ(sum.get(), expectedSum);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -0,0 +1,119 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+namespace
+{
+  int
+  nrOfIdleGuardEvaluations(Top::RegionScheduling const regionScheduling)
+  {
+    int nrOfIdleGuardEvaluations{0};
+    bool sawSubState{false};
+
+    FSM_TOP(top);
+
+    FSM_SIGNAL(void, signal, top);
+
+    FSM_REGION(region1, top);
+    FSM_INIT(region1);
+    FSM_STATE(state1, region1);
+    FSM_STATE(state2, region1);
+    FSM_INIT(state2);
+    FSM_STATE(subState, state2);
+
+    FSM_REGION(region2, top);
+    FSM_INIT(region2);
+    FSM_STATE(idle, region2);
+    FSM_STATE(busy, region2);
+
+    Auto t1(region1_INIT, state1);
+    Step t2(state1, state2, Trigger(signal));
+    Auto t3(state2_INIT, subState, Action([&]{sawSubState = true;}));
+
+    Auto t4(region2_INIT, idle);
+    Auto t5(idle, busy, Guard([&]{++nrOfIdleGuardEvaluations; return false;}));
+
+    top.setRegionScheduling(regionScheduling);
+    top.init();
+    top.step();
+    nrOfIdleGuardEvaluations = 0;
+
+    top.step(signal);
+    ASSERT(sawSubState);
+
+    return nrOfIdleGuardEvaluations;
+  }
+}
+
+TEST(RescanRevisitsIdleRegion)
+{
+  try
+  {
+    ASSERT_EQ(nrOfIdleGuardEvaluations(Top::RegionScheduling::RESCAN), 3);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(WorklistSkipsIdleRegion)
+{
+  try
+  {
+    ASSERT_EQ(nrOfIdleGuardEvaluations(Top::RegionScheduling::WORKLIST), 1);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(WorklistTerminates)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_SIGNAL(void, signal, top);
+
+    FSM_REGION(region1, top);
+    FSM_INIT(region1);
+    FSM_STATE(state, region1);
+    FSM_FINAL(region1);
+
+    FSM_REGION(region2, top);
+    FSM_INIT(region2);
+    FSM_FINAL(region2);
+
+    Auto t1(region1_INIT, state);
+    Step t2(state, region1_FINAL, Trigger(signal));
+    Auto t3(region2_INIT, region2_FINAL);
+
+    top.setRegionScheduling(Top::RegionScheduling::WORKLIST);
+    top.init();
+    ASSERT(!top.step());
+    ASSERT(top.step(signal));
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -0,0 +1,119 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(Max1TransitionReenabledEachStep)
+{
+  try
+  {
+    int nrOfInternalAutos{0};
+
+    FSM_TOP(top);
+
+    FSM_INIT(top);
+    FSM_STATE(state, top);
+
+    Auto t1(top_INIT, state);
+    InternalAuto t2(state, Max1Flag(), Action([&]{++nrOfInternalAutos;}));
+
+    top.init();
+    top.step();
+    int const nrOfInternalAutosAfterFirstStep{nrOfInternalAutos};
+
+    top.step();
+    ASSERT_EQ(nrOfInternalAutos, nrOfInternalAutosAfterFirstStep + 1);
+
+    top.step();
+    ASSERT_EQ(nrOfInternalAutos, nrOfInternalAutosAfterFirstStep + 2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(NxtValueCommittedOnReload)
+{
+  try
+  {
+    int valSeen{0};
+
+    FSM_TOP(top);
+
+    FSM_SIGNAL(void, signal, top);
+    FSM_VAR(int, var, top);
+
+    FSM_INIT(top);
+    FSM_STATE(state, top);
+
+    Auto t1(top_INIT, state, Action([&]{var.setNxt(1);}));
+    InternalStep t2(state, Trigger(signal), Max1Flag(), Action([&]{valSeen = var.get();}));
+
+    top.init();
+    top.step();
+    ASSERT_EQ(var.get(), 1);
+
+    top.step(signal);
+    ASSERT_EQ(valSeen, 1);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+TEST(CommittedVarRemainsSetDuringNextStep)
+{
+  FSM_TOP(top);
+
+  FSM_SIGNAL(void, signal, top);
+  FSM_VAR(int, var, top);
+
+  FSM_INIT(top);
+  FSM_STATE(state, top);
+
+  Auto t1(top_INIT, state, Action([&]{var.setNxt(1);}));
+  InternalStep t2(state, Trigger(signal), Max1Flag(), Action([&]{var.set(2);}));
+
+  top.init();
+  top.step();
+
+  try
+  {
+    top.step(signal);
+    ASSERT(false);
+  }
+  catch (VarDelegate::SetOnAlreadySetError const & err)
+  {
+    ASSERT_EQ(err.path, "var");
+  }
+
+  try
+  {
+    top.step(signal);
+    ASSERT_EQ(var.get(), 2);
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
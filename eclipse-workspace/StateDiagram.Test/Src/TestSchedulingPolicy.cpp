@@ -0,0 +1,100 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+namespace
+{
+  string
+  actionOrder(Top::SchedulingPolicy const schedulingPolicy, unsigned const seed)
+  {
+    string order{};
+
+    FSM_TOP(top);
+
+    FSM_INIT(top);
+    FSM_STATE(state, top);
+
+    Auto t
+    (
+      top_INIT
+    , state
+    , Action([&]{order += 'a';})
+    , Action([&]{order += 'b';})
+    , Action([&]{order += 'c';})
+    , Action([&]{order += 'd';})
+    , Action([&]{order += 'e';})
+    , Action([&]{order += 'f';})
+    , Action([&]{order += 'g';})
+    , Action([&]{order += 'h';})
+    );
+
+    top.setSchedulingPolicy(schedulingPolicy);
+    top.seedScheduling(seed);
+    top.init();
+    top.step();
+
+    return order;
+  }
+}
+
+TEST(DeclarationOrderScheduling)
+{
+  try
+  {
+    ASSERT_EQ(actionOrder(Top::SchedulingPolicy::DECLARATION_ORDER, 0), "abcdefgh");
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(ReverseOrderScheduling)
+{
+  try
+  {
+    ASSERT_EQ(actionOrder(Top::SchedulingPolicy::REVERSE_ORDER, 0), "hgfedcba");
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(SeededSchedulingIsReproducible)
+{
+  try
+  {
+    for (unsigned seed{1}; seed <= 10; ++seed)
+    {
+      string const order{actionOrder(Top::SchedulingPolicy::SHUFFLED, seed)};
+      ASSERT_EQ(order.size(), 8u);
+      ASSERT_EQ(actionOrder(Top::SchedulingPolicy::SHUFFLED, seed), order);
+    }
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -412,3 +412,128 @@ TEST(SignalDualSetGet)
     ASSERT(false);
   }
 }
+
+TEST(SignalCrefAndTake)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_SIGNAL(vector<int>, batch, top);
+    FSM_VAR(vector<int>, history, top, vector<int>{});
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    int sum{0};
+    bool isSameData{false};
+    vector<int> taken;
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP
+    (
+      idle, idle
+    , Trigger(batch)
+    , Action
+      (
+        [&](Event const & trigger)
+        {
+          auto const & items{trigger.cref<vector<int>>()};
+          isSameData = (&items == &batch.cref());
+          for (auto const item : items)
+          {
+            sum += item;
+          }
+          history.nxt << vector<int>(history.cref().size() + items.size(), 0);
+          taken = trigger.take<vector<int>>();
+        }
+      )
+    );
+
+    top.init();
+    top.step();
+    top.step(batch({1, 2, 3}));
+
+    ASSERT(isSameData);
+    ASSERT_EQ(sum, 6);
+    ASSERT(taken == (vector<int>{1, 2, 3}));
+    ASSERT_EQ(history.cref().size(), 3u);
+
+    // Taking is reset with the next macro step.
+    top.step(batch({4}));
+
+    ASSERT_EQ(sum, 10);
+    ASSERT(taken == vector<int>{4});
+    ASSERT_EQ(history.cref().size(), 4u);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+TEST(SignalGetOnTaken)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(string, signal, top);
+
+    FSM_INIT(top);
+    FSM_FINAL(top);
+    FSM_STEP(top_INIT, top_FINAL, Trigger(signal), Action([&](){signal.take(); signal.cref();}));
+
+    top.init();
+    top.step();
+    top.step(signal("abc"));
+
+    ASSERT(false);
+  }
+  catch (SignalDelegate::GetOnTakenError const & err)
+  {
+    ASSERT_EQ(err.path, "signal");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+#endif
+
+TEST(SignalMoveOnlyPayload)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_SIGNAL(unique_ptr<int>, box, top);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    unique_ptr<int> received;
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP(idle, idle, Trigger(box), Action([&](Event const & trigger){received = trigger.take<unique_ptr<int>>();}));
+
+    top.init();
+    top.step();
+
+    top.step(box(make_unique<int>(7)));
+    ASSERT_EQ(*received, 7);
+
+    ASSERT(top.post(box, make_unique<int>(5)));
+    top.step();
+    ASSERT_EQ(*received, 5);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -0,0 +1,79 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#include <array>
+
+namespace
+{
+  bool
+  isPositive(Event const & trigger)
+  {
+    return trigger.get<int>() > 0;
+  }
+}
+
+TEST(SpecCallablesKeepTheirState)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_SIGNAL(int, go, top);
+    FSM_VAR(int, total, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+
+    FSM_AUTO(top_INIT, idle);
+
+    // Captures larger than any small buffer are held in place, too.
+    array<int, 32> weights{};
+    weights.fill(2);
+    FSM_STEP
+    (
+      idle, idle
+    , Trigger(go)
+    , Guard(isPositive)
+    , Guard([nrOfChecks = 0]() mutable {return ++nrOfChecks <= 2;})
+    , Action([&total, weights](Event const & trigger){total.nxt << total.get() + weights.back() * trigger.get<int>();})
+    , Action(function<void ()>{[]{;}})
+    );
+
+    top.init();
+    top.step();
+    ASSERT(idle.isCurrent());
+
+    top.step(go(1));
+    ASSERT_EQ(total.get(), 2);
+
+    top.step(go(2));
+    ASSERT_EQ(total.get(), 6);
+
+    // The mutable guard counts its own evaluations, so the third one fails.
+    top.step(go(3));
+    ASSERT_EQ(total.get(), 6);
+
+    top.step(go(-1));
+    ASSERT_EQ(total.get(), 6);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
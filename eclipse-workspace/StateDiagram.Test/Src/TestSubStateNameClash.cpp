@@ -16,6 +16,9 @@
 
 #include "StateDiagramTestSetup.h"
 
+#include <memory>
+#include <vector>
+
 TEST(SubStateNameClash)
 {
   string const subStateName("subState");
@@ -44,3 +47,49 @@ TEST(SubStateNameClash)
     ASSERT(false);
   }
 }
+
+TEST(SubStateNameReusedAcrossScopes)
+{
+  string const name("name");
+
+  try
+  {
+    FSM_TOP(topState);
+
+    ExternalSignal<void> externalSignal(name, topState);
+    ExternalVar<int> externalVar(name, topState);
+
+    // Names only have to be unique among the sub-states of a region, the regions of a compound state, and the
+    // signals and the variables of a scope, respectively.
+    vector<unique_ptr<Region>> regions;
+    vector<unique_ptr<State>> subStates;
+    vector<unique_ptr<LocalSignal<void>>> localSignals;
+    vector<unique_ptr<LocalVar<int>>> localVars;
+    regions.emplace_back(make_unique<Region>(name, topState));
+    for (int depth = 0; depth < 100; ++depth)
+    {
+      subStates.emplace_back(make_unique<State>(name, *regions.back()));
+      localSignals.emplace_back(make_unique<LocalSignal<void>>(name, *regions.back()));
+      localVars.emplace_back(make_unique<LocalVar<int>>(name, *regions.back()));
+      localSignals.emplace_back(make_unique<LocalSignal<void>>(name, *subStates.back()));
+      localVars.emplace_back(make_unique<LocalVar<int>>(name, *subStates.back()));
+      regions.emplace_back(make_unique<Region>(name, *subStates.back()));
+    }
+
+    State subState(name, *regions.back());
+    State clashingSubState(name, *regions.back());
+
+    ASSERT(false);
+  }
+  catch (Region::Error::SubStateNameClash const & err)
+  {
+    ASSERT_EQ(err.subStateName, name);
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
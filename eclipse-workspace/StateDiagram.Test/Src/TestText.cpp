@@ -0,0 +1,184 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+#include <string>
+
+namespace
+{
+  // The same diagram as in the image tests: a top state with an initial state and two regular states, the second
+  // one of which activates a local signal that its region reacts to.
+  char const * const diagram{R"({
+    "name": "top",
+    "signals": [{"name": "go", "type": "int"}],
+    "vars": [{"name": "total", "type": "int"}],
+    "states":
+    [
+      {"name": "init", "kind": "init"},
+      {"name": "idle"},
+      {
+        "name": "busy",
+        "signals": [{"name": "ping"}],
+        "vars": [{"name": "count", "type": "int"}],
+        "regions":
+        [
+          {
+            "name": "inner",
+            "states": [{"name": "init", "kind": "init"}, {"name": "waiting"}, {"name": "pinged"}],
+            "transitions":
+            [
+              {"kind": "auto", "source": "init", "target": "waiting"},
+              {"kind": "step", "source": "waiting", "target": "pinged", "trigger": "ping"}
+            ]
+          }
+        ],
+        "transitions": [{"kind": "internalStep", "host": "busy", "trigger": "go", "output": "ping", "max1": true}]
+      }
+    ],
+    "transitions":
+    [
+      {"kind": "auto", "source": "init", "target": "idle"},
+      {"kind": "step", "source": "idle", "target": "busy", "trigger": "go", "guard": "isEven", "action": "count"}
+    ]
+  })"};
+}
+
+TEST(TextRoundTrip)
+{
+  try
+  {
+    int nrOfStarts{0};
+    TextBindings const bindings;
+    bindings.bindSignalType<int>("int");
+    bindings.bindVarType<int>("int");
+    bindings.bind("isEven", Guard([](Event const & trigger){return trigger.get<int>() % 2 == 0;}));
+    bindings.bind("count", Action([&]{++nrOfStarts;}));
+
+    TextTop const loaded{diagram, bindings};
+    Top const & top{loaded.top()};
+    ExternalSignal<int> & go{loaded.externalSignal<int>("go")};
+    top.init();
+    top.step();
+    ASSERT(loaded.subState("idle").isCurrent());
+    ASSERT_EQ(loaded.externalVar<int>("total").get(), 0);
+
+    top.step(go(1));
+    ASSERT(loaded.subState("idle").isCurrent());
+    ASSERT_EQ(nrOfStarts, 0);
+
+    top.step(go(2));
+    ASSERT(loaded.subState("busy").isCurrent());
+    ASSERT(loaded.subState("busy.inner.waiting").isCurrent());
+    ASSERT_EQ(loaded.localVar<int>("busy.count").get(), 0);
+    ASSERT_EQ(nrOfStarts, 1);
+
+    top.step(go(3));
+    ASSERT(loaded.subState("busy.inner.pinged").isCurrent());
+    ASSERT_EQ(loaded.subState("busy.inner.pinged").path(), "top::REGION::busy::inner::pinged");
+    ASSERT_EQ(&loaded.externalEvent("go"), &go);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(MalformedTextIsRejected)
+{
+  TextBindings const bindings;
+  try
+  {
+    TextTop const loaded{"{\n  \"name\": \"top\",\n  \"states\": [{\"name\": \"idle\"}\n}", bindings};
+    ASSERT(false);
+  }
+  catch (TextTop::SyntaxError const & err)
+  {
+    ASSERT_EQ(err.line, 4);
+    ASSERT_EQ(err.column, 1);
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    TextTop const loaded{R"({"name": "top", "states": [{"name": "idle", "knd": "init"}]})", bindings};
+    ASSERT(false);
+  }
+  catch (TextTop::SyntaxError const & err)
+  {
+    ASSERT_EQ(err.reason, "unknown member \"knd\"");
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    TextTop const loaded{R"({"name": "top", "states": [{"name": "idle"}, {"name": "idle"}]})", bindings};
+    ASSERT(false);
+  }
+  catch (TextTop::SyntaxError const & err)
+  {
+    cout << err.msg(); cout.flush();
+  }
+}
+
+TEST(UnknownTextNameIsRejected)
+{
+  TextBindings const bindings;
+  bindings.bindSignalType<int>("int");
+  bindings.bindVarType<int>("int");
+  bindings.bind("isEven", Guard([]{return true;}));
+  try
+  {
+    TextTop const loaded{diagram, bindings};
+    ASSERT(false);
+  }
+  catch (TextTop::NameError const & err)
+  {
+    ASSERT_EQ(err.nameKind, "action");
+    ASSERT_EQ(err.name, "count");
+    cout << err.msg(); cout.flush();
+  }
+
+  bindings.bind("count", Action([]{}));
+  try
+  {
+    TextTop const loaded{diagram, bindings};
+    // Paths are relative to the top state, and are not resolved in nested scopes.
+    loaded.subState("waiting");
+    ASSERT(false);
+  }
+  catch (TextTop::NameError const & err)
+  {
+    ASSERT_EQ(err.nameKind, "state");
+    cout << err.msg(); cout.flush();
+  }
+
+  try
+  {
+    TextTop const loaded
+    {
+      R"({"name": "top", "states": [{"name": "idle"}], "transitions": [{"kind": "enter", "host": "busy"}]})"
+    , bindings
+    };
+    ASSERT(false);
+  }
+  catch (TextTop::NameError const & err)
+  {
+    ASSERT_EQ(err.name, "busy");
+    cout << err.msg(); cout.flush();
+  }
+}
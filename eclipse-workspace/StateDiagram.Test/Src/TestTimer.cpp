@@ -0,0 +1,198 @@
+/*   
+   Copyright 2019-2020 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "StateDiagramTestSetup.h"
+
+TEST(AfterFiresOnceDelayHasPassed)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+    FSM_STATE(waiting, top);
+    FSM_STATE(timedOut, top);
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP(idle, waiting, Trigger(go));
+    FSM_STEP(waiting, timedOut, After(chrono::seconds{5}));
+
+    top.init();
+    top.step();
+
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{1}}));
+    top.step(go);
+    ASSERT(waiting.isCurrent());
+
+    // The delay is measured from the time point at which the state has been entered.
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::milliseconds{5999}}));
+    ASSERT(waiting.isCurrent());
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{6}}));
+    ASSERT(timedOut.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(TimerCancelledOnExit)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, go, top);
+    FSM_SIGNAL(void, cancel, top);
+    FSM_VAR(int, nrOfTimeouts, top, 0);
+
+    FSM_INIT(top);
+    FSM_STATE(idle, top);
+    FSM_STATE(waiting, top);
+
+    FSM_AUTO(top_INIT, idle);
+    FSM_STEP(idle, waiting, Trigger(go));
+    FSM_STEP(waiting, idle, Trigger(cancel));
+    Step const t{waiting, idle, After(chrono::seconds{5}), Action([&]{nrOfTimeouts.nxt << nrOfTimeouts.get() + 1;})};
+
+    top.init();
+    top.step();
+
+    top.step(go);
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{3}}));
+    top.step(cancel);
+    ASSERT(idle.isCurrent());
+
+    // Re-entering the state restarts the delay rather than resuming the cancelled timer.
+    top.step(go);
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{6}}));
+    ASSERT(waiting.isCurrent());
+    ASSERT_EQ(nrOfTimeouts.get(), 0);
+
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{8}}));
+    ASSERT(idle.isCurrent());
+    ASSERT_EQ(nrOfTimeouts.get(), 1);
+
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::hours{1}}));
+    ASSERT_EQ(nrOfTimeouts.get(), 1);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(TimerCancelledOnExitOfParent)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, leave, top);
+
+    FSM_INIT(top);
+    FSM_STATE(outer, top);
+    FSM_STATE(other, top);
+    FSM_INIT(outer);
+    FSM_STATE(inner, outer);
+    FSM_STATE(innerTimedOut, outer);
+
+    FSM_AUTO(top_INIT, outer);
+    FSM_AUTO(outer_INIT, inner);
+    FSM_STEP(outer, other, Trigger(leave));
+    FSM_STEP(inner, innerTimedOut, After(chrono::seconds{1}));
+
+    top.init();
+    top.step();
+    ASSERT(inner.isCurrent());
+
+    top.step(leave);
+    ASSERT(other.isCurrent());
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::seconds{2}}));
+    ASSERT(other.isCurrent());
+    ASSERT(inner.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(TimersExpiringTogether)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_REGION(r1, top);
+    FSM_REGION(r2, top);
+    FSM_INIT(r1);
+    FSM_INIT(r2);
+    FSM_STATE(a1, r1);
+    FSM_STATE(b1, r1);
+    FSM_STATE(a2, r2);
+    FSM_STATE(b2, r2);
+
+    FSM_AUTO(r1_INIT, a1);
+    FSM_AUTO(r2_INIT, a2);
+    FSM_STEP(a1, b1, After(chrono::minutes{10}));
+    FSM_STEP(a2, b2, At(Top::TimePoint{chrono::hours{3}}));
+
+    top.init();
+    top.step();
+
+    // Time may leap far ahead, past the range of the lower levels of the timer wheel.
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::hours{2}}));
+    ASSERT(b1.isCurrent());
+    ASSERT(a2.isCurrent());
+    ASSERT(!top.advanceTime(Top::TimePoint{chrono::hours{24 * 365}}));
+    ASSERT(b2.isCurrent());
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(AfterOnAutoTransitionError)
+{
+  try
+  {
+    FSM_TOP(top);
+
+    FSM_INIT(top);
+    FSM_FINAL(top);
+
+    FSM_AUTO(top_INIT, top_FINAL, After(chrono::seconds{1}));
+
+    ASSERT(false);
+  }
+  catch (Transition::Spec::TriggerSpecOnTriggerlessTransitionError const & err)
+  {
+    ASSERT_EQ(err.transitionTypeIndicator, "auto");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
@@ -740,3 +740,159 @@ TEST(VarLocalInitAtRegion)
     ASSERT(false);
   }
 }
+
+TEST(VarNxtKeptAcrossMacroSteps)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_VAR(vector<int>, var, top, vector<int>{});
+    FSM_SIGNAL(int, signal, top);
+
+    FSM_INIT(top);
+    FSM_STATE(top_STATE, top);
+
+    FSM_AUTO(top_INIT, top_STATE);
+    FSM_STEP
+    (
+      top_STATE, top_STATE
+    , Trigger(signal)
+    , Action
+      (
+        [&](Event const & trigger)
+        {
+          auto const item{trigger.get<int>()};
+          if (item != 0)
+          {
+            auto items{var.get()};
+            items.push_back(item);
+            var.nxt << move(items);
+          }
+        }
+      )
+    );
+
+    top.init();
+    top.step();
+
+    top.step(signal(1));
+    ASSERT(var.get() == vector<int>{1});
+
+    // Nothing is committed, so the data value stays as it is.
+    top.step(signal(0));
+    top.step(signal(0));
+    ASSERT(var.get() == vector<int>{1});
+
+    top.step(signal(2));
+    ASSERT(var.get() == (vector<int>{1, 2}));
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+TEST(LocalVarNxtOnReentry)
+{
+  try
+  {
+    FSM_TOP(top);
+    FSM_SIGNAL(void, leave, top);
+    FSM_SIGNAL(void, back, top);
+
+    FSM_INIT(top);
+    FSM_STATE(counting, top);
+    FSM_STATE(idle, top);
+
+    FSM_LOCAL_VAR(int, count, counting, 0);
+    FSM_LOCAL_VAR(int, untouched, counting, 7);
+
+    FSM_AUTO(top_INIT, counting);
+    FSM_ENTER(counting, Action([&](){count.nxt << count.get() + 1;}));
+    FSM_STEP(counting, idle, Trigger(leave));
+    FSM_STEP(idle, counting, Trigger(back));
+
+    top.init();
+    top.step();
+    ASSERT_EQ(count.get(), 1);
+
+    for (int round = 2; round < 5; ++round)
+    {
+      top.step(leave);
+      top.step(back);
+      ASSERT_EQ(count.get(), round);
+    }
+    ASSERT_EQ(untouched.get(), 7);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+TEST(VarScopeOnComponentsAddedAfterInit)
+{
+  FSM_TOP(top);
+  FSM_SIGNAL(void, signal, top);
+
+  FSM_REGION(region1, top);
+  FSM_REGION(region2, top);
+
+  FSM_INIT(region1);
+  FSM_STATE(region1_STATE, region1);
+  FSM_AUTO(region1_INIT, region1_STATE);
+
+  FSM_INIT(region2);
+  FSM_STATE(region2_STATE, region2);
+  FSM_AUTO(region2_INIT, region2_STATE);
+
+  try
+  {
+    top.init();
+    top.step();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+
+  // Both the variable and the transitions are added once scopes have already been numbered.
+  FSM_LOCAL_VAR(int, var, region2, 0);
+  FSM_STEP(region2_STATE, region2_STATE, Trigger(signal), Action([&](){var.nxt << var.get() + 1;}));
+
+  try
+  {
+    top.step(signal);
+    ASSERT_EQ(var.get(), 1);
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+
+  FSM_STEP(region1_STATE, region1_STATE, Trigger(signal), Action([&](){var.get();}));
+
+  try
+  {
+    top.step(signal);
+    ASSERT(false);
+  }
+  catch (VarDelegate::ScopeError const & err)
+  {
+    ASSERT_EQ(err.path, string() + "top" + pathComponentSeparator + "region2" + pathComponentSeparator + "var");
+    ASSERT_EQ(err.scopePath, string() + "top" + pathComponentSeparator + "region1");
+
+    cout << err.msg(); cout.flush();
+  }
+  catch (Error const & err)
+  {
+    cout << err.msg(); cout.flush();
+    ASSERT(false);
+  }
+}
+#endif
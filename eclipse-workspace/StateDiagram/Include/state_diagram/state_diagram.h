@@ -21,7 +21,11 @@
 
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 #include "state_diagram_internal.h"
 #include "state_diagram_payload.hpp"
@@ -71,12 +75,12 @@ public:
 
   //! Return the component's path as a string.
   /*!
-   * This function may be inefficient. It's mainly intended to be used
-   * for generating feedback to the user in case an error has occurred.
+   * The path is built on first request and kept by the top state from then on,
+   * so subsequent requests cost no more than a lookup.
    *
    * \return the component's path as a string.
    */
-  string path() const;
+  string const & path() const;
 
 #endif // STATE_DIAGRAM_STRINGLESS
 
@@ -245,6 +249,23 @@ public:
   static int constexpr getOnNotSetError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown when a signal's data value is to be retrieved after it has been taken.
+  class GetOnTakenError
+  :
+    public Error
+  {
+    template<typename Data, class Delegate> friend class ConcreteSignal;
+
+  private:
+    GetOnTakenError(string const & path, string const & scopePath);
+
+    string specific() const override;
+  };
+#else
+  static int constexpr getOnTakenError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+
 #ifndef STATE_DIAGRAM_STRINGLESS
   //! Error thrown whenever a local signal is used out of scope.
   class ScopeError
@@ -275,6 +296,8 @@ private:
   bool isActive() const;
   bool isSet() const;
   void markAsSet() const;
+  bool isTaken() const;
+  void markAsTaken() const;
 
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 };
@@ -390,8 +413,12 @@ private:
  */
 class Event
 {
+  template<typename Delegate, typename Data> friend class ConcreteSignal;
   friend class TriggeredTransitionImpl;
 
+protected:
+  Event();
+
 public:
   //! Destruct event.
   /*!
@@ -434,6 +461,25 @@ public:
   template<typename Data>
   Data get() const;
 
+  //! Retrieve a reference to the data payload.
+  /*!
+   * Unlike get, this does not copy the data payload. The reference stays valid for the remainder of the macro step.
+   *
+   * \param Data the data type.
+   */
+  template<typename Data>
+  Data const & cref() const;
+
+  //! Move the data payload out.
+  /*!
+   * This is intended for payloads that are expensive to copy or cannot be copied at all. Within a macro step,
+   * the data payload can be taken only once. Any attempt to retrieve it afterwards is an error.
+   *
+   * \param Data the data type.
+   */
+  template<typename Data>
+  Data take() const;
+
   //! Retrieve data payload from tuple.
   /*!
    * \param Data1 the first data type.
@@ -464,9 +510,16 @@ protected:
 private:
   virtual SignalDelegateImpl * implUpcast() const = 0;
 
+  // Bound by the concrete signal, so payloads are accessed without casting across the signal hierarchy.
+  PayloadTypeId m_payloadTypeId;
+  void * m_signal;
+  void * m_payload;
+
+  void bindPayload(PayloadTypeId const payloadTypeId, void * const signal, void * const payload);
+
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   template<typename Data>
-  void handleNullPtrError(Signal<Data> const * const signal) const;
+  void handleTypeMismatchError() const;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 };
 
@@ -476,9 +529,44 @@ class Signal
   public virtual Event
 {
 public:
-  virtual void set(Data && data) = 0;
-  virtual void set(Data const & data) = 0;
-  virtual Data get() const = 0;
+  void
+  set(Data && data)
+  {
+    payloadToSet() = move(data);
+  }
+
+  void
+  set(Data const & data)
+  {
+    payloadToSet() = data;
+  }
+
+  Data
+  get()
+  const
+  {
+    return payloadToGet();
+  }
+
+  Data const &
+  cref()
+  const
+  {
+    return payloadToGet();
+  }
+
+  Data
+  take()
+  {
+    return move(payloadToTake());
+  }
+
+protected:
+  // Access to the payload is checked here, while copying and moving is left to the members above, which are only
+  // instantiated when used, so move-only payloads are supported.
+  virtual Data & payloadToSet() = 0;
+  virtual Data const & payloadToGet() const = 0;
+  virtual Data & payloadToTake() = 0;
 };
 
 template<>
@@ -579,10 +667,10 @@ private:
 template<typename Data>
 void
 Event
-::handleNullPtrError(Signal<Data> const * const signal)
+::handleTypeMismatchError()
 const
 {
-  if (signal == nullptr)
+  if (m_payloadTypeId != &payloadTypeTag<Data>)
   {
     if (isUnderExecution())
     {
@@ -609,11 +697,15 @@ void
 Event
 ::set(Data && data)
 {
-  Signal<Data> * const signal{dynamic_cast<Signal<Data> *>(this)};
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  handleNullPtrError<Data>(signal);
+  handleTypeMismatchError<Data>();
+  static_cast<Signal<Data> *>(m_signal)->set(forward<Data>(data));
+#else
+  if constexpr (!is_void_v<Data>)
+  {
+    *static_cast<remove_reference_t<Data> *>(m_payload) = forward<Data>(data);
+  }
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  signal->set(forward<Data>(data));
 }
 
 template<typename Data>
@@ -621,11 +713,15 @@ void
 Event
 ::set(Data const & data)
 {
-  Signal<Data> * const signal{dynamic_cast<Signal<Data> *>(this)};
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  handleNullPtrError<Data>(signal);
+  handleTypeMismatchError<Data>();
+  static_cast<Signal<Data> *>(m_signal)->set(data);
+#else
+  if constexpr (!is_void_v<Data>)
+  {
+    *static_cast<Data *>(m_payload) = data;
+  }
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  signal->set(data);
 }
 
 template<typename Data>
@@ -634,11 +730,43 @@ Event
 ::get()
 const
 {
-  Signal<Data> const * const signal{dynamic_cast<Signal<Data> const *>(this)};
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  handleNullPtrError<Data>(signal);
+  handleTypeMismatchError<Data>();
+  return static_cast<Signal<Data> const *>(m_signal)->get();
+#else
+  if constexpr (!is_void_v<Data>)
+  {
+    return *static_cast<Data const *>(m_payload);
+  }
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+}
+
+template<typename Data>
+Data const &
+Event
+::cref()
+const
+{
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  handleTypeMismatchError<Data>();
+  return static_cast<Signal<Data> const *>(m_signal)->cref();
+#else
+  return *static_cast<Data const *>(m_payload);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+}
+
+template<typename Data>
+Data
+Event
+::take()
+const
+{
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  handleTypeMismatchError<Data>();
+  return static_cast<Signal<Data> *>(m_signal)->take();
+#else
+  return move(*static_cast<Data *>(m_payload));
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  return signal->get();
 }
 
 template<typename Data1, typename Data2, typename... RemainingData>
@@ -664,11 +792,12 @@ public:
     m_delegate{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent}
   , m_data{}
   {
-    // This space intentionally left empty
+    Event::bindPayload(&payloadTypeTag<Data>, static_cast<Signal<Data> *>(this), &m_data);
   }
 
-  void
-  set(Data && data)
+private:
+  Data &
+  payloadToSet()
   override
   {
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -699,57 +828,39 @@ public:
 #endif // STATE_DIAGRAM_STRINGLESS
       }
     }
+    m_delegate.markAsSet();
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    m_data = forward<Data>(data);
+    return m_data;
+  }
+
+  Data const &
+  payloadToGet()
+  const override
+  {
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    m_delegate.markAsSet();
+    checkGet();
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    return m_data;
   }
 
-  void
-  set(Data const & data)
+  Data &
+  payloadToTake()
   override
   {
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    if (m_delegate.isUnderExecution())
+    if (checkGet())
     {
-      if (!m_delegate.isInCurLocalScope())
-      {
-#ifndef STATE_DIAGRAM_STRINGLESS
-        throw typename Delegate::ScopeError(m_delegate.path(), m_delegate.curLocalScopePath());
-#else
-        STATE_DIAGRAM_HANDLE_ERROR(Delegate::scopeError);
-#endif // STATE_DIAGRAM_STRINGLESS
-      }
-      if (m_delegate.isActive())
-      {
-#ifndef STATE_DIAGRAM_STRINGLESS
-        throw typename Delegate::SetOnActivatedError(m_delegate.path(), m_delegate.curLocalScopePath());
-#else
-        STATE_DIAGRAM_HANDLE_ERROR(Delegate::setOnActivatedError);
-#endif // STATE_DIAGRAM_STRINGLESS
-      }
-      if (m_delegate.isSet())
-      {
-#ifndef STATE_DIAGRAM_STRINGLESS
-        throw typename Delegate::SetOnAlreadySetError(m_delegate.path(), m_delegate.curLocalScopePath());
-#else
-        STATE_DIAGRAM_HANDLE_ERROR(Delegate::setOnAlreadySetError);
-#endif // STATE_DIAGRAM_STRINGLESS
-      }
+      m_delegate.markAsTaken();
     }
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    m_data = data;
-#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    m_delegate.markAsSet();
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    return m_data;
   }
 
-  Data
-  get()
-  const override
-  {
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  bool
+  checkGet()
+  const
+  {
     if (m_delegate.isUnderExecution())
     {
       if (!m_delegate.isInCurLocalScope())
@@ -768,12 +879,20 @@ public:
         STATE_DIAGRAM_HANDLE_ERROR(Delegate::getOnNotSetError);
 #endif // STATE_DIAGRAM_STRINGLESS
       }
+      if (m_delegate.isTaken())
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        throw typename Delegate::GetOnTakenError(m_delegate.path(), m_delegate.curLocalScopePath());
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::getOnTakenError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+      return true;
     }
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-    return m_data;
+    return false;
   }
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
-private:
   SignalDelegateImpl *
   implUpcast()
   const override
@@ -828,7 +947,7 @@ public:
   :
     m_delegate{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent}
   {
-    // This space intentionally left empty
+    Event::bindPayload(&payloadTypeTag<void>, static_cast<Signal<void> *>(this), nullptr);
   }
 
 #ifndef STATE_DIAGRAM_STRINGLESS
@@ -882,6 +1001,8 @@ class ExternalEvent
 {
   friend class TriggerlessTransitionImpl;
   friend class Top;
+  friend class Machine;
+  friend class MachinePool;
 
 protected:
   virtual ExternalSignalDelegate::Impl * impl() const = 0;
@@ -1002,7 +1123,7 @@ public:
   ExternalSignal const &
   operator()(Data && data)
   {
-    this->set(data);
+    this->set(forward<Data>(data));
     return *this;
   }
 };
@@ -1027,6 +1148,46 @@ public:
   }
 };
 
+/* Payloads of posted external signals.
+ *
+ * A post carries the payload of an external signal from the thread that posts it to the thread
+ * that steps the top state, where it gets moved into the signal right before the signal is activated.
+ */
+class Post
+{
+public:
+  virtual ~Post();
+
+  virtual void deliver() = 0;
+};
+
+template<typename Data>
+class ConcretePost
+:
+  public Post
+{
+public:
+  template<typename... Items>
+  ConcretePost(Signal<Data> & signal, Items &&... items)
+  :
+    m_signal{signal}
+  , m_data(forward<Items>(items)...)
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  deliver()
+  override
+  {
+    m_signal.set(move(m_data));
+  }
+
+private:
+  Signal<Data> & m_signal;
+  Data m_data;
+};
+
 /* Local events.
  *
  * Local events are used to reference local signals that may trigger a transition.
@@ -1037,6 +1198,7 @@ class LocalEvent
   public virtual Event
 {
   friend class Top;
+  friend class OutputEmitter;
   friend class TriggeredTransitionImpl;
   friend class TriggerlessTransitionImpl;
 
@@ -1209,6 +1371,7 @@ class VarDelegate
   template<typename Data, size_t size> friend class LocalArray;
   friend class VarDelegateImpl;
   template<class Delegate, typename Data> friend class Var;
+  template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
 protected:
   class Delegator
@@ -1218,6 +1381,16 @@ protected:
 
   public:
     virtual void makeNxtCur() = 0;
+
+    // Delegators that keep flags of their own reset them here, after any next data value has been made current.
+    virtual void unset();
+
+    virtual size_t dataSize() const = 0;
+    virtual size_t dataAlignment() const = 0;
+    virtual bool hasTrivialData() const = 0;
+    virtual void copyData(void * const to, void const * const from) const = 0;
+    virtual void destroyData(void * const data) const = 0;
+    virtual void swapData(void * const data) = 0;
   };
 
   VarDelegate(VarDelegateImpl * const impl, Delegator * const delegator);
@@ -1272,6 +1445,7 @@ public:
     public Error
   {
     template<class Delegate, typename Data> friend class Var;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     GetOnNotValidError(string const & path);
@@ -1289,6 +1463,7 @@ public:
     public Error
   {
     template<class Delegate, typename Data> friend class Var;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     SetAfterGetError(string const & path);
@@ -1306,6 +1481,7 @@ public:
     public Error
   {
     template<class Delegate, typename Data> friend class Var;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     SetOnAlreadySetError(string const & path);
@@ -1323,6 +1499,7 @@ public:
     public Error
   {
     template<class Delegate, typename Data> friend class Var;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     SetNxtOnAlreadySetNxtError(string const & path);
@@ -1340,6 +1517,7 @@ public:
     public Error
   {
     template<class Delegate, typename Data> friend class Var;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     ScopeError(string const & varPath, string const & scopePath);
@@ -1361,6 +1539,14 @@ protected:
 
 private:
   void makeNxtCur() const;
+  void unset() const;
+
+  size_t dataSize() const;
+  size_t dataAlignment() const;
+  bool hasTrivialData() const;
+  void copyData(void * const to, void const * const from) const;
+  void destroyData(void * const data) const;
+  void swapData(void * const data) const;
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
@@ -1399,6 +1585,7 @@ class ExternalVarDelegate
 , public VarDelegate
 {
   template<class Delegate, typename Data> friend class Var;
+  template<class Delegate, typename Data, size_t size> friend class DenseArray;
   friend class Top;
 
 public:
@@ -1440,6 +1627,7 @@ class LocalVarDelegate
 , public VarDelegate
 {
   template<class Delegate, typename Data> friend class Var;
+  template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
 public:
   LocalVarDelegate(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & scope, Delegator * const delegator);
@@ -1488,6 +1676,7 @@ class Var
   template<typename _Data> friend class LocalVar;
   template<typename _Data, size_t size> friend class ExternalArray;
   template<typename _Data, size_t size> friend class LocalArray;
+  friend class Machine;
 
 protected:
   template<class Parent>
@@ -1748,6 +1937,41 @@ public:
     return m_data;
   }
 
+  //! Retrieve a reference to the variable's data value.
+  /*!
+   * Unlike get, this does not copy the data value. The reference stays valid for the remainder of the macro step.
+   *
+   * \return a reference to the variable's data value.
+   */
+  Data const &
+  cref()
+  const
+  {
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    if (m_delegate.isUnderExecution())
+    {
+      if (!m_delegate.isInCurLocalScope())
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        throw typename Delegate::ScopeError(path(), m_delegate.curLocalScopePath());
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::scopeError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+      if (!m_delegate.isValid())
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        throw typename Delegate::GetOnNotValidError(path());
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::getOnNotValidError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+      m_delegate.markAsRetrieved();
+    }
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    return m_data;
+  }
+
 protected:
   void
   forceSet(Data && data)
@@ -1775,7 +1999,7 @@ protected:
   }
 
 private:
-  SignalDelegateImpl *
+  VarDelegateImpl *
   implUpcast()
   const
   {
@@ -1829,11 +2053,74 @@ public:
   Nxt const nxt;
 
 private:
+  // Next data values are never retrieved, so swapping rather than copying is fine, and it spares copying large data
+  // values.
   void
   makeNxtCur()
   override
   {
-    m_data = m_dataNxt;
+    swap(m_data, m_dataNxt);
+  }
+
+  // A machine keeps both the current and the next data value of the variable, one after the other.
+  size_t
+  dataSize()
+  const
+  override
+  {
+    return 2 * sizeof(Data);
+  }
+
+  size_t
+  dataAlignment()
+  const
+  override
+  {
+    return alignof(Data);
+  }
+
+  bool
+  hasTrivialData()
+  const
+  override
+  {
+    return is_trivially_copyable<Data>::value;
+  }
+
+  void
+  copyData(void * const to, void const * const from)
+  const
+  override
+  {
+    Data * const dataTo{static_cast<Data *>(to)};
+    if (from == nullptr)
+    {
+      new (dataTo) Data(m_data);
+      new (dataTo + 1) Data(m_dataNxt);
+      return;
+    }
+    Data const * const dataFrom{static_cast<Data const *>(from)};
+    new (dataTo) Data(dataFrom[0]);
+    new (dataTo + 1) Data(dataFrom[1]);
+  }
+
+  void
+  destroyData(void * const data)
+  const
+  override
+  {
+    Data * const _data{static_cast<Data *>(data)};
+    _data[0].~Data();
+    _data[1].~Data();
+  }
+
+  void
+  swapData(void * const data)
+  override
+  {
+    Data * const _data{static_cast<Data *>(data)};
+    swap(m_data, _data[0]);
+    swap(m_dataNxt, _data[1]);
   }
 };
 
@@ -1960,6 +2247,7 @@ public:
   {
     template<typename Data, size_t size> friend class ExternalArray;
     template<typename Data, size_t size> friend class LocalArray;
+    template<class Delegate, typename Data, size_t size> friend class DenseArray;
 
   private:
     IdxOutOfBoundsError(string const & arrayPath, size_t const capacity, size_t const idx);
@@ -2166,1502 +2454,3834 @@ private:
   alignas(alignof(LocalVar<Data>[capacity])) char m_backing[capacity * sizeof(LocalVar<Data>)];
 };
 
-//! A concurrent region of a sub-divisible state.
+//! Dense arrays of data variables.
 /*!
- * Every sub-divisible state has at least one concurrent region.
- * Whenever sub-states are directly attached to a sub-divisible state,
- * then a default region is generated and attached to that state automatically.
- * The default region becomes the parent of all directly attached sub-states,
- * so direct attachment is form of syntactic sugar. Once a sub-divisible
- * state has a default region, attempting to attach any further
- * (non-default) region
- * leads to an exception being thrown.
+ * Unlike an array of variables, a dense array does not consist of a variable per element. It keeps the current and
+ * the next data values of its elements in two contiguous buffers, their flags in bit sets and has a single delegate,
+ * which makes even large dense arrays cheap to construct. Otherwise, each element behaves like a variable.
+ *
+ * \param Delegate the type of the delegate.
+ * \param Data the type of the data values.
+ * \param size the number of elements.
  */
-class Region
+template<class Delegate, typename Data, size_t size>
+class DenseArray
 :
-  private virtual PImpl<RegionImpl>
-, public NamePath
+  public Array
+, public VarDelegate::Delegator
+{
+  static_assert(size > 0, "A dense array needs at least one element.");
+
+  template<typename _Data, size_t _size> friend class ExternalDenseArray;
+  template<typename _Data, size_t capacity> friend class LocalDenseArray;
+  friend class Machine;
+
+protected:
+  template<class Parent>
+  DenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & parent)
+  :
+    m_delegate{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, this}
+  , m_state{}
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  , m_hasBeenRetrieved{}
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  {
+    // This space intentionally left empty
+  }
+
+  template<class Parent>
+  DenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & parent, array<Data, size> const & initVal)
+  :
+    DenseArray{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent}
+  {
+    copy(initVal.begin(), initVal.end(), m_state.data);
+    markAsSet(0, size);
+  }
+
+public:
+  //! Return the array's path as a string.
+  /*!
+   * This function may be inefficient. It's mainly intended to be used
+   * for generating feedback to the user in case an error has occurred.
+   *
+   * \return the array's path as a string.
+   */
+#ifndef STATE_DIAGRAM_STRINGLESS
+  string
+  path()
+  const
+  {
+    return m_delegate.path();
+  }
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  //! Set the data value of an element.
+  /*!
+   * \param idx the index of the element.
+   * \param data the data value.
+   */
+  void
+  set(size_t const idx, Data && data)
+  {
+    checkIdx(idx);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSet(idx);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.data[idx] = forward<Data>(data);
+    markAsSet(idx, 1);
+  }
+
+  //! Set the data value of an element.
+  /*!
+   * \param idx the index of the element.
+   * \param data the data value.
+   */
+  void
+  set(size_t const idx, Data const & data)
+  {
+    checkIdx(idx);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSet(idx);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.data[idx] = data;
+    markAsSet(idx, 1);
+  }
+
+  //! Set the next data value of an element.
+  /*!
+   * \param idx the index of the element.
+   * \param data the next data value.
+   */
+  void
+  setNxt(size_t const idx, Data && data)
+  {
+    checkIdx(idx);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSetNxt(idx, 1);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.dataNxt[idx] = forward<Data>(data);
+    markAsSetNxt(idx, 1);
+  }
+
+  //! Set the next data value of an element.
+  /*!
+   * \param idx the index of the element.
+   * \param data the next data value.
+   */
+  void
+  setNxt(size_t const idx, Data const & data)
+  {
+    checkIdx(idx);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSetNxt(idx, 1);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.dataNxt[idx] = data;
+    markAsSetNxt(idx, 1);
+  }
+
+  //! Retrieve the data value of an element.
+  /*!
+   * \param idx the index of the element.
+   *
+   * \return the element's data value.
+   */
+  Data
+  get(size_t const idx)
+  const
+  {
+    return cref(idx);
+  }
+
+  //! Retrieve a reference to the data value of an element.
+  /*!
+   * \param idx the index of the element.
+   *
+   * \return a reference to the element's data value.
+   */
+  Data const &
+  cref(size_t const idx)
+  const
+  {
+    checkIdx(idx);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkGet(idx, 1);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    return m_state.data[idx];
+  }
+
+  //! Retrieve the data values of a range of elements.
+  /*!
+   * \param first the index of the first element of the range.
+   * \param count the number of elements in the range.
+   * \param to where the data values are to be copied to.
+   */
+  void
+  get(size_t const first, size_t const count, Data * const to)
+  const
+  {
+    checkRange(first, count);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkGet(first, count);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    copy_n(m_state.data + first, count, to);
+  }
+
+  //! Set the next data values of a range of elements.
+  /*!
+   * \param first the index of the first element of the range.
+   * \param count the number of elements in the range.
+   * \param from where the next data values are to be copied from.
+   */
+  void
+  setNxt(size_t const first, size_t const count, Data const * const from)
+  {
+    checkRange(first, count);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSetNxt(first, count);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    copy_n(from, count, m_state.dataNxt + first);
+    markAsSetNxt(first, count);
+  }
+
+  //! Retrieve the contiguous buffer holding the data values of all elements.
+  /*!
+   * All elements count as retrieved.
+   *
+   * \return the buffer of size elements.
+   */
+  Data const *
+  cdata()
+  const
+  {
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkGet(0, size);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    return m_state.data;
+  }
+
+  //! Retrieve the contiguous buffer holding the next data values of all elements.
+  /*!
+   * All elements count as having their next data values set, so each of them is to be written to. Until then, the
+   * buffer holds stale data values.
+   *
+   * \return the buffer of size elements.
+   */
+  Data *
+  nxtData()
+  {
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    checkSetNxt(0, size);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    markAsSetNxt(0, size);
+    return m_state.dataNxt;
+  }
+
+  //! Elements of dense arrays, which can be used like variables.
+  class Elem
+  {
+    friend class DenseArray;
+
+  public:
+    //! Set the element's data value.
+    /*!
+     * \param data the data value.
+     */
+    void
+    set(Data && data)
+    const
+    {
+      m_array.set(m_idx, forward<Data>(data));
+    }
+
+    //! Set the element's data value.
+    /*!
+     * \param data the data value.
+     */
+    void
+    set(Data const & data)
+    const
+    {
+      m_array.set(m_idx, data);
+    }
+
+    //! Set the element's data value.
+    /*!
+     * \param data the data value.
+     */
+    void
+    operator<<(Data && data)
+    const
+    {
+      m_array.set(m_idx, forward<Data>(data));
+    }
+
+    //! Set the element's data value.
+    /*!
+     * \param data the data value.
+     */
+    void
+    operator<<(Data const & data)
+    const
+    {
+      m_array.set(m_idx, data);
+    }
+
+    //! Set the element's next data value.
+    /*!
+     * \param data the next data value.
+     */
+    void
+    setNxt(Data && data)
+    const
+    {
+      m_array.setNxt(m_idx, forward<Data>(data));
+    }
+
+    //! Set the element's next data value.
+    /*!
+     * \param data the next data value.
+     */
+    void
+    setNxt(Data const & data)
+    const
+    {
+      m_array.setNxt(m_idx, data);
+    }
+
+    //! Retrieve the element's data value.
+    /*!
+     * \return the element's data value.
+     */
+    Data
+    get()
+    const
+    {
+      return m_array.get(m_idx);
+    }
+
+    //! Retrieve a reference to the element's data value.
+    /*!
+     * \return a reference to the element's data value.
+     */
+    Data const &
+    cref()
+    const
+    {
+      return m_array.cref(m_idx);
+    }
+
+  private:
+    Elem(DenseArray & array, size_t const idx)
+    :
+      m_array{array}
+    , m_idx{idx}
+    , nxt{array, idx}
+    {
+      // This space intentionally left empty
+    }
+
+    DenseArray & m_array;
+    size_t const m_idx;
+
+  public:
+    class Nxt
+    {
+      friend class Elem;
+
+    public:
+      //! Set the element's next data value.
+      /*!
+       * \param data the next data value.
+       */
+      void
+      operator<<(Data && data)
+      const
+      {
+        m_array.setNxt(m_idx, forward<Data>(data));
+      }
+
+      //! Set the element's next data value.
+      /*!
+       * \param data the next data value.
+       */
+      void
+      operator<<(Data const & data)
+      const
+      {
+        m_array.setNxt(m_idx, data);
+      }
+
+    private:
+      Nxt(DenseArray & array, size_t const idx)
+      :
+        m_array{array}
+      , m_idx{idx}
+      {
+        // This space intentionally left empty
+      }
+
+      DenseArray & m_array;
+      size_t const m_idx;
+    };
+
+    //! A wrapper allowing to set the element's next data value via an operator.
+    Nxt const nxt;
+  };
+
+  //! Accessing an element.
+  /*!
+   * \param idx the index of the element.
+   */
+  Elem
+  operator[](size_t const idx)
+  {
+    checkIdx(idx);
+    return Elem{*this, idx};
+  }
+
+private:
+  // The state of a dense array as kept by a machine. Nothing is retrieved in between macro steps.
+  struct State
+  {
+    Data data[size];
+    Data dataNxt[size];
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    BitSet<size> isValid;
+    BitSet<size> isSet;
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    BitSet<size> isSetNxt;
+  };
+
+  void
+  checkIdx(size_t const idx)
+  const
+  {
+    if (idx >= size)
+    {
+#ifndef STATE_DIAGRAM_STRINGLESS
+      throw IdxOutOfBoundsError(path(), size, idx);
+#else
+      STATE_DIAGRAM_HANDLE_ERROR(idxOutOfBoundsError);
+#endif // STATE_DIAGRAM_STRINGLESS
+    }
+  }
+
+  void
+  checkRange(size_t const first, size_t const count)
+  const
+  {
+    if ((first > size) || (count > size - first))
+    {
+#ifndef STATE_DIAGRAM_STRINGLESS
+      throw IdxOutOfBoundsError(path(), size, max(first, size));
+#else
+      STATE_DIAGRAM_HANDLE_ERROR(idxOutOfBoundsError);
+#endif // STATE_DIAGRAM_STRINGLESS
+    }
+  }
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  string
+  elemPath(size_t const idx)
+  const
+  {
+    return path() + '[' + to_string(idx) + ']';
+  }
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  void
+  checkScope()
+  const
+  {
+    if (!m_delegate.isInCurLocalScope())
+    {
+#ifndef STATE_DIAGRAM_STRINGLESS
+      throw typename Delegate::ScopeError(path(), m_delegate.curLocalScopePath());
+#else
+      STATE_DIAGRAM_HANDLE_ERROR(Delegate::scopeError);
+#endif // STATE_DIAGRAM_STRINGLESS
+    }
+  }
+
+  void
+  checkSet(size_t const idx)
+  const
+  {
+    if (m_delegate.isUnderExecution())
+    {
+      checkScope();
+      if (m_state.isSet.test(idx))
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        throw typename Delegate::SetOnAlreadySetError(elemPath(idx));
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::setOnAlreadySetError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+      if (m_hasBeenRetrieved.test(idx))
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        throw typename Delegate::SetAfterGetError(elemPath(idx));
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::setAfterGetError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+    }
+  }
+
+  void
+  checkSetNxt(size_t const first, size_t const count)
+  const
+  {
+    if (m_delegate.isUnderExecution())
+    {
+      checkScope();
+      if (!m_state.isSetNxt.none(first, count))
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        size_t idx{first};
+        while (!m_state.isSetNxt.test(idx))
+        {
+          ++idx;
+        }
+        throw typename Delegate::SetNxtOnAlreadySetNxtError(elemPath(idx));
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::setNxtOnAlreadySetNxtError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+    }
+  }
+
+  void
+  checkGet(size_t const first, size_t const count)
+  const
+  {
+    if (m_delegate.isUnderExecution())
+    {
+      checkScope();
+      if (!m_state.isValid.all(first, count))
+      {
+#ifndef STATE_DIAGRAM_STRINGLESS
+        size_t idx{first};
+        while (m_state.isValid.test(idx))
+        {
+          ++idx;
+        }
+        throw typename Delegate::GetOnNotValidError(elemPath(idx));
+#else
+        STATE_DIAGRAM_HANDLE_ERROR(Delegate::getOnNotValidError);
+#endif // STATE_DIAGRAM_STRINGLESS
+      }
+      m_hasBeenRetrieved.set(first, count);
+      m_delegate.markAsRetrieved();
+    }
+  }
+
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+  void
+  markAsSet(size_t const first, size_t const count)
+  {
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.isValid.set(first, count);
+    m_state.isSet.set(first, count);
+    m_delegate.markAsSet();
+#else
+    static_cast<void>(first);
+    static_cast<void>(count);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  }
+
+  void
+  markAsSetNxt(size_t const first, size_t const count)
+  {
+    m_state.isSetNxt.set(first, count);
+    m_delegate.markAsSetNxt();
+  }
+
+  VarDelegateImpl *
+  implUpcast()
+  const
+  {
+    return m_delegate.implUpcast();
+  }
+
+  // Only the elements whose next data values have been set are swapped in.
+  void
+  makeNxtCur()
+  override
+  {
+    m_state.isSetNxt.forEachSet([this](size_t const idx){swap(m_state.data[idx], m_state.dataNxt[idx]);});
+  }
+
+  void
+  unset()
+  override
+  {
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.isValid |= m_state.isSetNxt;
+    m_state.isSet = m_state.isSetNxt;
+    m_hasBeenRetrieved.reset();
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    m_state.isSetNxt.reset();
+  }
+
+  size_t
+  dataSize()
+  const
+  override
+  {
+    return sizeof(State);
+  }
+
+  size_t
+  dataAlignment()
+  const
+  override
+  {
+    return alignof(State);
+  }
+
+  bool
+  hasTrivialData()
+  const
+  override
+  {
+    return is_trivially_copyable<State>::value;
+  }
+
+  void
+  copyData(void * const to, void const * const from)
+  const
+  override
+  {
+    new (to) State((from == nullptr) ? m_state : *static_cast<State const *>(from));
+  }
+
+  void
+  destroyData(void * const data)
+  const
+  override
+  {
+    static_cast<State *>(data)->~State();
+  }
+
+  void
+  swapData(void * const data)
+  override
+  {
+    State & other{*static_cast<State *>(data)};
+    swap_ranges(m_state.data, m_state.data + size, other.data);
+    swap_ranges(m_state.dataNxt, m_state.dataNxt + size, other.dataNxt);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    swap(m_state.isValid, other.isValid);
+    swap(m_state.isSet, other.isSet);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    swap(m_state.isSetNxt, other.isSetNxt);
+  }
+
+  Delegate m_delegate;
+  State m_state;
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  mutable BitSet<size> m_hasBeenRetrieved;
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+};
+
+//! Dense arrays of external data variables.
+/*!
+ * \param Data the type of the data values.
+ * \param size the number of elements.
+ */
+template<typename Data, size_t size>
+class ExternalDenseArray
+:
+  public DenseArray<ExternalVarDelegate, Data, size>
+{
+public:
+  //! Construct a dense array of external variables.
+  /*!
+   * \param name the name of the dense array.
+   * \param parent the parent of the dense array.
+   */
+  ExternalDenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Top const & parent)
+  :
+    DenseArray<ExternalVarDelegate, Data, size>{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent}
+  {
+    // This space intentionally left empty
+  }
+
+  //! Construct a dense array of external variables and, at the same time, assign initial values to its elements.
+  /*!
+   * \param name the name of the dense array.
+   * \param parent the parent of the dense array.
+   * \param initVal the initial values.
+   */
+  ExternalDenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Top const & parent, array<Data, size> const & initVal)
+  :
+    DenseArray<ExternalVarDelegate, Data, size>{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, initVal}
+  {
+    // This space intentionally left empty
+  }
+};
+
+//! Dense arrays of local data variables.
+/*!
+ * \param Data the type of the data values.
+ * \param capacity the number of elements.
+ */
+template<typename Data, size_t capacity>
+class LocalDenseArray
+:
+  public DenseArray<LocalVarDelegate, Data, capacity>
+{
+public:
+  //! Construct a dense array of local variables.
+  /*!
+   * \param Parent the type of the scope of the dense array, either a compound state or a region.
+   * \param name the name of the dense array.
+   * \param scope the scope of the dense array.
+   */
+  template<class Parent>
+  LocalDenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & scope)
+  :
+    DenseArray<LocalVarDelegate, Data, capacity>{STATE_DIAGRAM_STRING_ARG_COMMA(name) scope}
+  {
+    // This space intentionally left empty
+  }
+
+  //! Construct a dense array of local variables and, at the same time, assign initial values to its elements.
+  /*!
+   * \param Parent the type of the scope of the dense array, either a compound state or a region.
+   * \param name the name of the dense array.
+   * \param scope the scope of the dense array.
+   * \param initVal the initial values.
+   */
+  template<class Parent>
+  LocalDenseArray(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & scope, array<Data, capacity> const & initVal)
+  :
+    DenseArray<LocalVarDelegate, Data, capacity>{STATE_DIAGRAM_STRING_ARG_COMMA(name) scope, initVal}
+  {
+    // This space intentionally left empty
+  }
+};
+
+//! A concurrent region of a sub-divisible state.
+/*!
+ * Every sub-divisible state has at least one concurrent region.
+ * Whenever sub-states are directly attached to a sub-divisible state,
+ * then a default region is generated and attached to that state automatically.
+ * The default region becomes the parent of all directly attached sub-states,
+ * so direct attachment is form of syntactic sugar. Once a sub-divisible
+ * state has a default region, attempting to attach any further
+ * (non-default) region
+ * leads to an exception being thrown.
+ */
+class Region
+:
+  private virtual PImpl<RegionImpl>
+, public NamePath
 {
   friend class CompoundStateImpl;
   friend class Init;
   friend class Final;
   friend class State;
   friend class Connector;
-  friend class LocalSignalDelegate;
-  friend class LocalVarDelegate;
+  friend class LocalSignalDelegate;
+  friend class LocalVarDelegate;
+
+public:
+# define STATE_DIAGRAM_DEFAULT_NAME_OF_REGION "REGION"
+private:
+  static string const defaultName;
+
+public:
+  //! Construct a region with a compound state as parent.
+  /*!
+   * \param name the region's name.
+   * \param parent the region's parent.
+   */
+  Region(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+
+  //! Destruct region.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Region();
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown on a name clash among signals local to a region.
+  class LocalSignalNameClashError
+  :
+    public LocalSignalDelegate::NameClashError
+  {
+    friend class RegionImpl;
+
+  private:
+    LocalSignalNameClashError(string const & scopePath, string const & signalName);
+
+    string scopeTypeIndicator() const;
+  };
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown on a name clash among variables local to a region.
+  class LocalVarNameClashError
+  :
+    public LocalVarDelegate::NameClashError
+  {
+    friend class RegionImpl;
+
+  private:
+    LocalVarNameClashError(string const & scopePath, string const & varName);
+
+    string scopeTypeIndicator() const;
+  };
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Base class for region-related errors other than name clash errors on local signals or variables.
+  class Error
+  :
+    public state_diagram::Error
+  {
+  protected:
+    Error(string const & regionPath);
+
+  public:
+    //! The region's path.
+    string const regionPath;
+
+    class SubStateNameClash;
+    class MissingInit;
+  };
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+#else
+  static int constexpr error_missingInit{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+};
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+//! Error thrown on a name clash among the sub-states of a region.
+class Region::Error::SubStateNameClash
+:
+  public Region::Error
+{
+  friend class RegionImpl;
+
+private:
+  SubStateNameClash(string const & regionPath, string const & subStateName);
+
+public:
+  //! The name of the sub-state(s).
+  string const subStateName;
+
+private:
+  string specific() const override;
+};
+
+//! Error thrown whenever a region requiring an initial state does not have any.
+/*!
+ * At execution time, a region may be found to require an initial state. The error is thrown
+ * whenever the region
+ * does not have any initial state in that situation.
+ */
+class Region::Error::MissingInit
+:
+  public Region::Error
+{
+  friend class RegionImpl;
+
+private:
+  MissingInit(string const & regionPath);
+
+  string specific() const override;
+};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  //! Base class of all sub-divisible or, equivalently, compound states.
+/*!
+ * Compound states may consist of one or more regions each one containing sub-states.
+ * If more than one region is present, then these regions are executed concurrently.
+ */
+class CompoundState
+:
+  private PImplUpcast<CompoundStateImpl>
+, public virtual NamePath
+{
+  friend class Region;
+  friend class LocalSignalDelegate;
+  friend class LocalVarDelegate;
+  friend class Init;
+  friend class Final;
+  friend class State;
+  friend class Connector;
+
+protected:
+  CompoundState(CompoundStateImpl * const impl);
+
+  CompoundStateImpl * implUpcast() const;
+
+public:
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown on a name clash among signals local to a compound state.
+  class LocalSignalNameClashError
+  :
+    public LocalSignalDelegate::NameClashError
+  {
+    friend class CompoundStateImpl;
+
+  private:
+    LocalSignalNameClashError(string const & scopePath, string const & signalName);
+
+    string scopeTypeIndicator() const;
+  };
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown on a name clash among variables local to a compound state.
+  class LocalVarNameClashError
+  :
+    public LocalVarDelegate::NameClashError
+  {
+    friend class CompoundStateImpl;
+
+  private:
+    LocalVarNameClashError(string const & scopePath, string const & signalName);
+
+    string scopeTypeIndicator() const;
+  };
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Base class for region-related errors within the parent of compound states.
+  class RegionError
+  :
+    public Error
+  {
+  protected:
+    RegionError(string const & compoundStatePath);
+
+  public:
+    //! The compound state's path.
+    string const compoundStatePath;
+
+    class DefaultRegionRequest;
+    class Insertion;
+  };
+#else
+  static int constexpr regionError_defaultRegionRequest{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+  static int constexpr regionError_insertion_hasDefaultRegion{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+};
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+//! Error thrown whenever a default region is requested on a compound state that already has non-default regions.
+class CompoundState::RegionError::DefaultRegionRequest
+:
+  public CompoundState::RegionError
+{
+  friend class CompoundStateImpl;
+
+private:
+  DefaultRegionRequest(string const & compoundStatePath, size_t const nrOfNonDefaultRegions);
+
+public:
+  //! The number of non-default regions that have already been added.
+  size_t const nrOfNonDefaultRegions;
+
+private:
+  string specific() const override;
+};
+
+//! Base class of errors thrown on adding a region to a compound state.
+class CompoundState::RegionError::Insertion
+:
+  public CompoundState::RegionError
+{
+protected:
+  Insertion(string const & compoundStatePath, string const & regionName);
+
+public:
+  // The name of the region.
+  string const regionName;
+
+  class HasDefaultRegion;
+  class NameClash;
+};
+
+//! Error thrown on adding a region to a compound state that already has a default region.
+class CompoundState::RegionError::Insertion::HasDefaultRegion
+:
+  public CompoundState::RegionError::Insertion
+{
+  friend class CompoundStateImpl;
+
+private:
+  HasDefaultRegion(string const & compoundStatePath, string const & regionName);
+
+  string specific() const override;
+};
+
+//! Error thrown on a name clash among the regions belonging to a compound state.
+class CompoundState::RegionError::Insertion::NameClash
+:
+  public CompoundState::RegionError::Insertion
+{
+  friend class CompoundStateImpl;
+
+private:
+  NameClash(string const & compoundStatePath, string const & regionName);
+
+  string specific() const override;
+};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  //! Base class of all states other than top states.
+class SubState
+:
+  private PImplUpcast<SubStateImpl>
+, public virtual NamePath
+{
+  friend class Machine;
+
+protected:
+  SubState(SubStateImpl * const impl);
+
+public:
+  bool isCurrent() const;
+};
+
+//! Base class of states that are admissible as the source state of some external transition.
+class SourceState
+:
+  private PImplUpcast<SourceStateImpl>
+, public virtual SubState
+{
+  friend class Auto;
+  friend class Step;
+
+protected:
+  SourceState(SourceStateImpl * const impl);
+
+  SourceStateImpl * implUpcast() const;
+};
+
+//! Base class of states that are admissible as the target state of some external transition.
+class TargetState
+:
+  private PImplUpcast<TargetStateImpl>
+, public virtual SubState
+{
+  friend class Auto;
+  friend class Step;
+
+protected:
+  TargetState(TargetStateImpl * const impl);
+
+  TargetStateImpl * implUpcast() const;
+};
+
+//! Top states or, equivalently, entire state machines.
+class Top
+:
+  private virtual PImpl<TopStateImpl>
+, public CompoundState
+{
+  friend class ArenaScope;
+  friend class ExternalSignalDelegate;
+  friend class ExternalEvent;
+  friend class ExternalVarDelegate;
+  friend class Machine;
+  friend class MachinePool;
+
+public:
+  //! Construct a top state.
+  /*
+   * \parameter name the name of the top state.
+   */
+  Top(STATE_DIAGRAM_STRING_PARAM(name));
+
+  //! Destruct top state.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Top();
+
+  //! Initializing a top state.
+  /*!
+   * The initialization function needs be called once before executing macro steps.
+   */
+  void init() const;
+
+  //! Executing a macro step, that is to say, as many micro steps as possible.
+  /*!
+   * Executing a macro step consists of transition executions. This process continues until
+   * no transitions are enabled anymore, or forever if the state machine does not run out
+   * of enabled transitions.
+   *
+   * External signals that have been posted are activated first, in the order of posting,
+   * up to but excluding the first one that has already been activated for this macro step.
+   * That one and any posted after it are left to subsequent macro steps.
+   *
+   * \return true if the state machine enters an overall terminal state as a result of the macro step, false if not.
+   */
+  bool step() const;
+
+  //! Executing a macro step supplying external signals that are to be activated.
+  /*!
+   * Executing a macro step consists of transition firings. These firings continue until
+   * no transitions are enabled anymore, or forever if the state machine does not run out
+   * of enabled transitions.
+   *
+   * \param trigger the first external signal that is to be activated as trigger.
+   * \param remainingTriggers the remaining external signals that are to be activated as triggers.
+   *
+   * \return true if the state machine assumes an overall terminal state as a result of the macro step, false if not.
+   */
+  template<class E, class... Es>
+  bool step(E const & trigger, Es const &... remainingTriggers) const;
+
+  //! The type of durations for time-triggered transitions.
+  using Duration = chrono::nanoseconds;
+
+  //! The type of points in time for time-triggered transitions.
+  /*!
+   * Time points need not stem from a real clock. Time is whatever has been passed to advanceTime,
+   * which starts out as the zero time point.
+   */
+  using TimePoint = chrono::time_point<chrono::steady_clock, Duration>;
+
+  //! The granularity of timers. Deadlines are rounded up to a multiple of it.
+  static constexpr Duration timerResolution{chrono::milliseconds{1}};
+
+  //! Advance time, executing a macro step if any timer expires.
+  /*!
+   * Timers that expire activate the time-triggered transitions that they belong to for a single
+   * macro step, whether or not these are enabled otherwise. A timer is armed whenever its source
+   * state is entered, measuring from the time point most recently passed to advanceTime, and is
+   * cancelled when its source state is exited or frozen. The cost depends on the number of
+   * expiring timers rather than on the number of timers altogether. Time never goes back, so
+   * earlier time points are taken as the current one.
+   *
+   * \param now the current time point.
+   *
+   * \return true if the state machine enters an overall terminal state as a result of the macro step,
+   * false if not or if no macro step has been executed.
+   */
+  bool advanceTime(TimePoint const now) const;
+
+  //! The maximum number of posted external signals waiting for a macro step.
+  static size_t constexpr postCapacity{1024};
+
+  //! Post an external signal along with its data payload, to be activated by a subsequent macro step.
+  /*!
+   * Posting may happen from any thread, concurrently with other posts and with the thread that
+   * executes macro steps. The payload is moved into the signal only by that thread.
+   *
+   * \param signal the external signal.
+   * \param items the items from which the data payload is constructed.
+   *
+   * \return true if the signal has been posted, false if there are postCapacity posts waiting already.
+   */
+  template<typename Data, typename... RemainingData, typename... Items>
+  bool post(ExternalSignal<Data, RemainingData...> & signal, Items &&... items) const;
+
+  //! Post an external signal that does not carry any data payload, to be activated by a subsequent macro step.
+  /*!
+   * \param signal the external signal.
+   *
+   * \return true if the signal has been posted, false if there are postCapacity posts waiting already.
+   */
+  bool post(ExternalSignal<void> & signal) const;
+
+  //! Ways of deciding which regions of the top state are looked at again during a macro step.
+  /*!
+   * With RESCAN, which is the default, all regions are looked at over and over again until
+   * none of them has a transition firing anymore.
+   *
+   * With WORKLIST, only those regions that had a transition firing are looked at again.
+   * A region that has been looked at without any of its transitions firing cannot get
+   * enabled again by the other regions during the same macro step: signals never cross
+   * region borders at the top level and variables cannot be set after having been retrieved.
+   * This presumes that guards depend on nothing but the signals and variables of the state
+   * machine. It pays off for top states with many orthogonal regions most of which are idle.
+   */
+  enum class RegionScheduling {RESCAN, WORKLIST};
+
+  //! Choose how regions are looked at during subsequent macro steps.
+  /*!
+   * \param regionScheduling the way regions are to be looked at.
+   */
+  void setRegionScheduling(RegionScheduling const regionScheduling) const;
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  //! Orders in which regions, transitions and their specs are looked at.
+  /*!
+   * With SHUFFLED, which is the default, the order is randomized anew on every visit, using
+   * a random number generator that belongs to the top state. This helps in uncovering
+   * unintended dependencies on the order in which things happen.
+   *
+   * With DECLARATION_ORDER and REVERSE_ORDER, the order is that of declaration or its reverse,
+   * which makes runs reproducible.
+   */
+  enum class SchedulingPolicy {SHUFFLED, DECLARATION_ORDER, REVERSE_ORDER};
+
+  //! Choose the order in which regions, transitions and their specs are looked at.
+  /*!
+   * \param schedulingPolicy the order to be used.
+   */
+  void setSchedulingPolicy(SchedulingPolicy const schedulingPolicy) const;
+
+  //! Seed the random number generator used for shuffling.
+  /*!
+   * Top states that are seeded equally shuffle equally, whatever other top states do.
+   *
+   * \param seed the seed.
+   */
+  void seedScheduling(unsigned const seed) const;
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  class RequestForCurLocalScopeError
+  :
+    public Error
+  {
+    friend class TopStateImpl;
+
+  private:
+    RequestForCurLocalScopeError(string const & localVarPath);
+
+  public:
+    string const localVarPath;
+
+  private:
+    string specific() const override;
+  };
+#else
+  static int constexpr requestForCurLocalScopeError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+private:
+  void activate(ExternalEvent const & trigger) const;
+  bool enqueue(ExternalEvent const & signal, Post * const post) const;
+};
+
+template<class E, class... Es>
+bool
+Top
+::step(E const & trigger, Es const &... remainingTriggers)
+const
+{
+  activate(trigger);
+  return step(remainingTriggers...);
+}
+
+template<typename Data, typename... RemainingData, typename... Items>
+bool
+Top
+::post(ExternalSignal<Data, RemainingData...> & signal, Items &&... items)
+const
+{
+  using Payload_ = typename conditional<sizeof...(RemainingData) == 0, Data, Payload<Data, RemainingData...>>::type;
+  return enqueue(signal, new ConcretePost<Payload_>{signal, forward<Items>(items)...});
+}
+
+//! Scopes within which the components of a state machine are allocated from the arena of its top state.
+/*!
+ * Components, their list nodes and their specs that are constructed by the current thread
+ * within such a scope are placed into contiguous slabs owned by the top state, rather than
+ * being allocated one by one. Their memory is released in one go when the top state is
+ * destructed, which is why none of them may outlive it. Components constructed outside of
+ * any such scope are allocated individually, as usual.
+ *
+ * Scopes may be nested, in which case the innermost one takes effect.
+ */
+class ArenaScope
+{
+public:
+  //! Open an arena scope.
+  /*!
+   * \param top the top state whose arena is to be allocated from.
+   */
+  ArenaScope(Top const & top);
+  ArenaScope(ArenaScope const &) = delete;
+
+  //! Close an arena scope, reverting to the enclosing one, if any.
+  ~ArenaScope();
+
+  void operator=(ArenaScope const &) = delete;
+
+private:
+  Arena * const m_enclosing;
+};
+
+//! State machine instances sharing the structure of a top state.
+/*!
+ * A machine holds nothing but the runtime state of a state machine: the current sub-state of
+ * every region, the pause and freeze status of every state, and the data values of every variable.
+ * All of this is kept in a single compact block, whereas names, transitions and specs stay with
+ * the top state, which is shared by any number of machines.
+ *
+ * A macro step of a machine is executed against its top state: the machine's runtime state is
+ * swapped into the top state, the macro step is executed, and the runtime state is swapped back
+ * out again. The runtime state of the top state itself is left as it was. Signals are not part
+ * of the runtime state, as they only carry data from the outside into a single macro step.
+ *
+ * Timers are kept by the top state only, so time-triggered transitions never fire for machines.
+ *
+ * Machines are to be created after the top state has been completed and initialized, and
+ * must not outlive the top state.
+ */
+class Machine
+:
+  private PImpl<MachineImpl>
+{
+  friend class MachinePoolImpl;
+
+public:
+  //! Construct a machine.
+  /*!
+   * The runtime state of the machine starts out as a copy of that of the top state.
+   *
+   * \param top the top state whose structure the machine shares.
+   */
+  Machine(Top const & top);
+
+  //! Construct a machine as a copy of another machine of the same top state.
+  /*!
+   * \param other the machine whose runtime state is copied.
+   */
+  Machine(Machine const & other);
+
+  //! Destruct machine.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Machine();
+
+  void operator=(Machine const &) = delete;
+
+  //! Executing a macro step of the machine.
+  /*!
+   * \return true if the machine enters an overall terminal state as a result of the macro step, false if not.
+   */
+  bool step() const;
+
+  //! Executing a macro step of the machine supplying external signals that are to be activated.
+  /*!
+   * \param trigger the first external signal that is to be activated as trigger.
+   * \param remainingTriggers the remaining external signals that are to be activated as triggers.
+   *
+   * \return true if the machine enters an overall terminal state as a result of the macro step, false if not.
+   */
+  template<class E, class... Es>
+  bool step(E const & trigger, Es const &... remainingTriggers) const;
+
+  //! Query whether a sub-state is current within its region in the machine.
+  /*!
+   * \param subState the sub-state.
+   *
+   * \return true if the sub-state is current within its region, false if not.
+   */
+  bool isCurrent(SubState const & subState) const;
+
+  //! Retrieve the data value that a variable has in the machine.
+  /*!
+   * \param var the variable.
+   *
+   * \return the variable's data value.
+   */
+  template<class Delegate, typename Data>
+  Data get(Var<Delegate, Data> const & var) const;
+
+  //! Retrieve the data value that an element of a dense array has in the machine.
+  /*!
+   * \param array the dense array.
+   * \param idx the index of the element.
+   *
+   * \return the element's data value.
+   */
+  template<class Delegate, typename Data, size_t size>
+  Data get(DenseArray<Delegate, Data, size> const & array, size_t const idx) const;
+
+private:
+  void load() const;
+  void activate() const;
+  void activate(ExternalEvent const & trigger) const;
+  template<class E, class... Es>
+  void activate(E const & trigger, Es const &... remainingTriggers) const;
+  bool execLoaded() const;
+  void const * data(VarDelegateImpl const * const var) const;
+};
+
+template<class E, class... Es>
+bool
+Machine
+::step(E const & trigger, Es const &... remainingTriggers)
+const
+{
+  // Activating a trigger arms transitions, which is part of the runtime state that is swapped in first.
+  load();
+  activate(trigger, remainingTriggers...);
+  return execLoaded();
+}
+
+template<class E, class... Es>
+void
+Machine
+::activate(E const & trigger, Es const &... remainingTriggers)
+const
+{
+  activate(static_cast<ExternalEvent const &>(trigger));
+  activate(remainingTriggers...);
+}
+
+template<class Delegate, typename Data>
+Data
+Machine
+::get(Var<Delegate, Data> const & var)
+const
+{
+  return static_cast<Data const *>(data(var.implUpcast()))[0];
+}
+
+template<class Delegate, typename Data, size_t size>
+Data
+Machine
+::get(DenseArray<Delegate, Data, size> const & array, size_t const idx)
+const
+{
+  array.checkIdx(idx);
+  return static_cast<typename DenseArray<Delegate, Data, size>::State const *>(data(array.implUpcast()))->data[idx];
+}
+
+//! Pools of machines that are stepped concurrently by worker threads.
+/*!
+ * Each worker thread steps machines against a top state of its own, since a top state can
+ * execute only one macro step at a time. The top states handed to the pool are therefore to be
+ * built in exactly the same way, for example by the same function, and to be initialized. The
+ * machines of the pool are created from the first of them.
+ *
+ * Macro steps are submitted per machine, each one with its own batch of triggers, and are
+ * executed by a subsequent run. During a run, every machine with submitted macro steps is stepped
+ * by a single worker thread, which executes that machine's macro steps in the order of submission.
+ * Workers that run out of machines to step steal them from other workers.
+ *
+ * Actions, guards and outputs are executed on the worker threads, so they must not share any
+ * data between top states without proper synchronization.
+ */
+class MachinePool
+:
+  private PImpl<MachinePoolImpl>
+{
+public:
+  //! Construct a machine pool, starting a worker thread for every top state.
+  /*!
+   * \param tops identically built top states, one per worker thread.
+   */
+  MachinePool(vector<reference_wrapper<Top const>> const & tops);
+
+  //! Destruct machine pool, stopping its worker threads.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~MachinePool();
+
+  //! Add a machine to the pool.
+  /*!
+   * The runtime state of the machine starts out as a copy of that of the first top state.
+   *
+   * \return the index of the machine within the pool.
+   */
+  size_t add() const;
+
+  //! Retrieve a machine of the pool.
+  /*!
+   * Machines are not to be stepped directly while the pool is running.
+   *
+   * \param machineIdx the index of the machine within the pool.
+   *
+   * \return the machine.
+   */
+  Machine const & operator[](size_t const machineIdx) const;
+
+  //! Return the number of machines in the pool.
+  size_t size() const;
+
+  //! Submit a macro step of a machine to be executed by the next run.
+  /*!
+   * The triggers are external signals of the first top state. The corresponding external
+   * signals of whichever top state the macro step is executed against are activated.
+   *
+   * \param machineIdx the index of the machine within the pool.
+   * \param triggers the external signals that are to be activated as triggers.
+   */
+  template<class... Es>
+  void submit(size_t const machineIdx, Es const &... triggers) const;
+
+  //! Execute all submitted macro steps, returning when all of them have been executed.
+  /*!
+   * Should any macro step throw an error, then the first one thrown is rethrown after all other
+   * macro steps have been executed.
+   */
+  void run() const;
+
+  //! Return the number of worker threads.
+  size_t nrOfWorkers() const;
+
+  //! Return the fraction of the time spent in runs that a worker thread has been stepping machines.
+  /*!
+   * \param workerIdx the index of the worker thread.
+   */
+  double utilization(size_t const workerIdx) const;
+
+  //! Return the number of machines that a worker thread has stolen from other worker threads.
+  /*!
+   * \param workerIdx the index of the worker thread.
+   */
+  size_t nrOfSteals(size_t const workerIdx) const;
+
+private:
+  void submit(size_t const machineIdx, vector<ExternalEvent const *> const & triggers) const;
+};
+
+template<class... Es>
+void
+MachinePool
+::submit(size_t const machineIdx, Es const &... triggers)
+const
+{
+  submit(machineIdx, vector<ExternalEvent const *>{static_cast<ExternalEvent const *>(&triggers)...});
+}
+
+//! Initial states.
+/*!
+ * Every region can have at most one initial state. The
+ * initial state cannot be
+ * the target state of any transition and cannot be sub-divided either.
+ * The initial state of some region, R say, becomes current within
+ * R whenever the parent state of R becomes
+ * current by way of it being the target of some transition being executed,
+ * the top state always being current. If R
+ * does not have any initial state, then control flow can
+ * enter R only by way of state-boundary crossing transitions that target
+ * sub-states of R directly.
+ */
+class Init
+:
+  private virtual PImpl<InitStateImpl>
+, public SourceState
+{
+public:
+  //! The name of an initial state as a macro.
+# define STATE_DIAGRAM_NAME_OF_INITIAL_STATE "INIT"
+
+  //! The name of an initial state as a string constant.
+  static string const name;
+
+  //! Construct an initial state inside a default region of the parent state.
+  /*!
+   * If the parent state already has a default region from a similar constructor
+   * invocation, then that region is used; if not, then a default region is created.
+   *
+   * \param parent the parent compound state.
+   */
+  Init(CompoundState const & parent);
+
+  //! Construct an initial state inside a parent region that is explicitly referred-to.
+  /*!
+   * \param parent the parent region.
+   */
+  Init(Region const & parent);
+
+  //! Destruct initial state.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Init();
+};
+
+//! Final states.
+/*!
+ * Every region can have at most one final state. The
+ * final state cannot be
+ * the source state of any transition and cannot be sub-divided either.
+ */
+class Final
+:
+  private virtual PImpl<FinalStateImpl>
+, public TargetState
+{
+public:
+  //! The name of a final state as a macro.
+# define STATE_DIAGRAM_NAME_OF_FINAL_STATE "FINAL"
+
+  //! The name of a final state as a string constant.
+  static string const name;
+
+  //! Construct a final state inside a default region of the parent state.
+  /*!
+   * If the parent state already has a default region from a similar constructor
+   * invocation, then that region is used; if not, then a default region is created.
+   *
+   * \param parent the parent compound state.
+   */
+  Final(CompoundState const & parent);
+
+  //! Construct a final state inside a parent region that is explicitly referred-to.
+  /*!
+   * \param parent the parent region.
+   */
+  Final(Region const & parent);
+
+  //! Destruct final state.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Final();
+};
+
+//! Ordinary sub-divisible states.
+/*!
+ * Ordinary sub-divisible states are simply called states if no confusion can arise.
+ * The first layer of sub-division is always made up of zero or more regions.
+ * These regions contain the second layer, which consists of the sub-states of the parent state.
+ * These sub-states can be sub-divisible again and so on. Recursion stops at states
+ * that do not have any child regions.
+ * In all cases where
+ * there is more
+ * than one region attached to a state, these regions are executed concurrently to each other.
+ *
+ * States can appear both as the source and as the target of transitions - the so-called
+ * external transitions.
+ * Furthermore, they can have enter-, exit- and internal step transitions attached
+ * to them - the so-called single-state transitions.
+ */
+class State
+:
+  private virtual PImpl<StateImpl>
+, public CompoundState
+, public SourceState
+, public TargetState
+{
+  friend class Step;
+  friend class Enter;
+  friend class Exit;
+  friend class InternalAuto;
+  friend class InternalStep;
+
+public:
+  //! Construct a state inside a default region of the parent state.
+  /*!
+   * \param name the name of the state.
+   * \param the parent state.
+   */
+  State(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+
+  //! Construct a state inside a parent region that is explicitly referred to.
+  /*!
+   * \param name the name of the state.
+   * \param the parent region.
+   */
+  State(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+
+  //! Destruct state.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~State();
+
+  //! Test whether a state has terminated.
+  /*!
+   * This predicate provided for usage in transition guards.
+   * A state has terminated if, and only if, the current states of all of its child regions
+   * are terminal states.
+   */
+  bool hasTerminated() const;
+};
+
+//! Connector states.
+/*!
+ * Connector states can appear both as the source and as the target of transitions - the so-called
+ * external transitions.
+ */
+class Connector
+:
+  private virtual PImpl<ConnectorStateImpl>
+, public SourceState
+, public TargetState
+{
+  friend class Step;
+
+public:
+  //! Construct a state inside a default region of the parent state.
+  /*!
+   * \param name the name of the state.
+   * \param the parent state.
+   */
+  Connector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+
+  //! Construct a state inside a parent region that is explicitly referred to.
+  /*!
+   * \param name the name of the state.
+   * \param the parent region.
+   */
+  Connector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+
+  //! Destruct state.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Connector();
+
+  //! Test whether a state has terminated.
+  /*!
+   * This predicate provided for usage in transition guards.
+   * A state has terminated if, and only if, the current states of all of its child regions
+   * are terminal states.
+   */
+  bool hasTerminated() const;
+};
+
+//! Base class of all transitions.
+class Transition
+:
+  private PImplUpcast<TransitionImpl>
+{
+  friend class Action;
+  friend class CompletionFlag;
+  friend class FreezeFlag;
+  friend class Guard;
+  friend class Max1Flag;
+  friend class Output;
+  friend class Trigger;
+  friend class After;
+  friend class At;
+
+protected:
+  Transition(TransitionImpl * const impl);
+
+  virtual ~Transition();
+
+  TransitionImpl * implUpcast() const;
+
+public:
+  //! Base class of all transition specs.
+  /*!
+   * Transition specs are annotations that can be added to transitions to modify their behavior in various ways.
+   */
+  class Spec
+  {
+    friend class Transition;
+    friend class TriggerlessTransition;
+    friend class TriggeredTransition;
+
+  protected:
+    virtual ~Spec();
 
-public:
-# define STATE_DIAGRAM_DEFAULT_NAME_OF_REGION "REGION"
-private:
-  static string const defaultName;
+    virtual void join(Transition const * const) const = 0;
 
-public:
-  //! Construct a region with a compound state as parent.
+  public:
+#ifndef STATE_DIAGRAM_STRINGLESS
+    //! Error thrown whenever a trigger spec is added to a trigger-less transition.
+    class TriggerSpecOnTriggerlessTransitionError
+    :
+      public Error
+    {
+      friend class TriggerlessTransitionImpl;
+
+    private:
+      TriggerSpecOnTriggerlessTransitionError
+      (
+        string const & transitionTypeIndicator
+      , string const & originPath
+      );
+
+    public:
+      //! The type of the transition.
+      string const transitionTypeIndicator;
+
+      //! The path to the origin of the transition.
+      string const originPath;
+
+    protected:
+      string specific() const override;
+    };
+#else
+    static int constexpr triggerSpecOnTriggerlessTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+    //! Error thrown whenever a trigger-dependent spec is added to a trigger-less transition.
+    class TriggeredSpecOnTriggerlessTransitionError
+    :
+      public Error
+    {
+      friend class TriggerlessTransitionImpl;
+
+    private:
+      TriggeredSpecOnTriggerlessTransitionError
+      (
+        string const & specTypeIndicator
+      , string const & transitionTypeIndicator
+      , string const & originPath
+      );
+
+    public:
+      //! The type of spec.
+      string const specTypeIndicator;
+
+      //! The type of the transition .
+      string const transitionTypeIndicator;
+
+      //! The path to the origin of the transition.
+      string const originPath;
+
+    private:
+      string specific() const override;
+    };
+#else
+    static int constexpr triggeredSpecOnTriggerlessTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+  };
+
+  //! Add a spec to a transition.
   /*!
-   * \param name the region's name.
-   * \param parent the region's parent.
+   * \param spec the spec.
+   * \return the transition itself.
    */
-  Region(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+  Transition const & add(Spec const & spec) const;
 
-  //! Destruct region.
+  //! Add a spec to a transition.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param spec the spec.
+   * \return the transition itself.
    */
-  ~Region();
+  Transition const & operator<<(Spec const & spec) const;
 
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown on a name clash among signals local to a region.
-  class LocalSignalNameClashError
+  //! Base class for signal scope errors.
+  class ScopeError
   :
-    public LocalSignalDelegate::NameClashError
+    public Error
   {
-    friend class RegionImpl;
+  protected:
+    ScopeError(string const & signalPath, string const & scopePath);
 
-  private:
-    LocalSignalNameClashError(string const & scopePath, string const & signalName);
+  public:
+    //! The path to the signal.
+    string const signalPath;
 
-    string scopeTypeIndicator() const;
+    //! The path to the scope in which the error occurs, meaning that the signal ought to be visible in this scope but isn't.
+    string const scopePath;
+
+    class Output;
   };
+#else
+    static int constexpr scopeError_output{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
+};
 
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown on a name clash among variables local to a region.
-  class LocalVarNameClashError
-  :
-    public LocalVarDelegate::NameClashError
-  {
-    friend class RegionImpl;
+//! Error thrown when a transition activates a signal that lies out of scope.
+class Transition::ScopeError::Output
+:
+  public Transition::ScopeError
+{
+  friend class OutputEmitter;
+  friend class TriggerlessTransitionImpl;
+  friend class TriggeredTransitionImpl;
 
-  private:
-    LocalVarNameClashError(string const & scopePath, string const & varName);
+private:
+  Output(string const & signalPath, string const & scopePath);
 
-    string scopeTypeIndicator() const;
-  };
+  string specific() const override;
+};
 #endif // STATE_DIAGRAM_STRINGLESS
 
+//! Base class for enter-, exit- and internal step transitions.
+class SingleStateTransition
+:
+  public virtual Transition
+{
+protected:
+  SingleStateTransition(SingleStateTransitionImpl * const impl);
+};
+
+//! Base class for auto and step transitions.
+class ExternalTransition
+:
+  public virtual Transition
+{
+protected:
+  ExternalTransition(ExternalTransitionImpl * const impl);
+
+public:
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Base class for region-related errors other than name clash errors on local signals or variables.
-  class Error
+  //! Error thrown when the source and the target of an external transition do not lie in regions that are related via direct descent.
+  /*!
+   * Direct descent means that the two regions either are the same or that one
+   * of them is an ancestor of the other in the state-region hierarchy. Direct descent
+   * is violated if, and only if, the two regions are concurrent to each other.
+   * Avoiding the error being thrown means to avoid transitions that go across
+   * concurrency boundaries.
+   */
+  class DescendanceError
   :
-    public state_diagram::Error
+    public Error
   {
-  protected:
-    Error(string const & regionPath);
+    friend class ExternalTransitionImpl;
+
+  private:
+    DescendanceError(string const & sourcePath, string const & targetPath);
 
   public:
-    //! The region's path.
-    string const regionPath;
+    //! The path of the source state.
+    string const sourcePath;
 
-    class SubStateNameClash;
-    class MissingInit;
-  };
-#endif // STATE_DIAGRAM_STRINGLESS
+    //! The path of the target state.
+    string const targetPath;
 
-#ifndef STATE_DIAGRAM_STRINGLESS
+  private:
+    string specific() const override;
+  };
 #else
-  static int constexpr error_missingInit{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+    static int constexpr descendanceError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 };
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-//! Error thrown on a name clash among the sub-states of a region.
-class Region::Error::SubStateNameClash
+//! Base class for trigger-less transitions.
+class TriggerlessTransition
 :
-  public Region::Error
+  public virtual Transition
 {
-  friend class RegionImpl;
-
-private:
-  SubStateNameClash(string const & regionPath, string const & subStateName);
-
-public:
-  //! The name of the sub-state(s).
-  string const subStateName;
-
-private:
-  string specific() const override;
+protected:
+  TriggerlessTransition(TriggerlessTransitionImpl * const impl);
 };
 
-//! Error thrown whenever a region requiring an initial state does not have any.
-/*!
- * At execution time, a region may be found to require an initial state. The error is thrown
- * whenever the region
- * does not have any initial state in that situation.
- */
-class Region::Error::MissingInit
+//! Base class for triggered transitions.
+class TriggeredTransition
 :
-  public Region::Error
+  public virtual Transition
 {
-  friend class RegionImpl;
+protected:
+  TriggeredTransition(TriggeredTransitionImpl * const impl);
 
-private:
-  MissingInit(string const & regionPath);
+public:
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown whenever a triggered transition is being added a trigger that lies out of scope.
+  /*!
+   * The source state of the transition determines which signals lie in scope as potential triggers.
+   */
+  class TriggerScopeError
+  :
+    public Transition::ScopeError
+  {
+    friend class TriggeredTransitionImpl;
 
-  string specific() const override;
-};
+  private:
+    TriggerScopeError(string const & signalPath, string const & scopePath);
+
+    string specific() const override;
+  };
+#else
+    static int constexpr triggerScopeError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
+};
 
-  //! Base class of all sub-divisible or, equivalently, compound states.
+//! Designators for the two types of freezes.
 /*!
- * Compound states may consist of one or more regions each one containing sub-states.
- * If more than one region is present, then these regions are executed concurrently.
+ * A transition labeled with a freeze flag carrying the designator, FULL, freezes its source
+ * state and every state beneath it. No exit transitions are executed as the transition is executed.
+ * Once the state is re-entered, no enter transitions are executed and all current states are
+ * the same as before the freeze.
+ *
+ * A transition labeled with a freeze flag carrying the designator, SHALLOW, freezes the level just
+ * beneath its source state - so that the current state of each direct child region of the source
+ * state is frozen in place.
+ * All levels below that are exited and entered again like normal.
+ *
+ * The freeze condition can be overridden on re-entry. To override it, use a transition that crosses
+ * the state boundary, directly targeting some sub-state.
  */
-class CompoundState
+enum FreezeDepth {FULL, SHALLOW};
+
+//! Freeze flags that can be added as specs to transitions.
+class FreezeFlag
 :
-  private PImplUpcast<CompoundStateImpl>
-, public virtual NamePath
+  public Transition::Spec
 {
-  friend class Region;
-  friend class LocalSignalDelegate;
-  friend class LocalVarDelegate;
-  friend class Init;
-  friend class Final;
-  friend class State;
-  friend class Connector;
+  friend class Transition;
 
-protected:
-  CompoundState(CompoundStateImpl * const impl);
+public:
+  FreezeFlag(FreezeDepth const freezeDepth);
 
-  CompoundStateImpl * implUpcast() const;
+  FreezeDepth const freezeDepth;
+
+private:
+  void join(Transition const * const) const override;
 
 public:
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown on a name clash among signals local to a compound state.
-  class LocalSignalNameClashError
+  //! Error thrown whenever a freeze flag is added to a single-state transition.
+  class FreezeFlagOnSingleStateTransitionError
   :
-    public LocalSignalDelegate::NameClashError
+    public Error
   {
-    friend class CompoundStateImpl;
+    friend class FreezeFlag;
 
   private:
-    LocalSignalNameClashError(string const & scopePath, string const & signalName);
+    FreezeFlagOnSingleStateTransitionError(string const & hostPath);
 
-    string scopeTypeIndicator() const;
+  public:
+    //! The path of the state that hosts the transition.
+    string const hostPath;
+
+  private:
+    string specific() const override;
   };
+#else
+    static int constexpr freezeFlagOnSingleStateTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown on a name clash among variables local to a compound state.
-  class LocalVarNameClashError
+  //! Error thrown whenever a freeze flag is added to a auto transition.
+  class FreezeFlagOnAutoTransitionError
   :
-    public LocalVarDelegate::NameClashError
+    public Error
   {
-    friend class CompoundStateImpl;
+    friend class FreezeFlag;
 
   private:
-    LocalVarNameClashError(string const & scopePath, string const & signalName);
+    FreezeFlagOnAutoTransitionError(string const & sourcePath, string const & targetPath);
 
-    string scopeTypeIndicator() const;
+  public:
+    //! The path of the source state.
+    string const sourcePath;
+
+    //! The path of the target state.
+    string const targetPath;
+
+  private:
+    string specific() const override;
   };
+#else
+  static int constexpr freezeFlagOnAutoTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
+};
+
+//! Max-1 flags that can be added as specs to transitions.
+/*!
+ * A max-1 flag specifies that the transition can be executed at most once per macro step.
+ * A typical use would consist of adding a max-1 flag to a reset transition, where
+ * source and target state are the same. Another typical use would consist of adding a max-1 flag
+ * to an internal step transition to prevent it from leading to livelock.
+ */
+class Max1Flag
+:
+  public Transition::Spec
+{
+  friend class Transition;
+
+private:
+  void join(Transition const * const) const override;
 
+public:
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Base class for region-related errors within the parent of compound states.
-  class RegionError
+  //! Error thrown whenever a max-1 flag is added to an enter- or exit-transition.
+  class Max1FlagOnBoundaryTransitionError
   :
     public Error
   {
-  protected:
-    RegionError(string const & compoundStatePath);
+    friend class Max1Flag;
+
+  private:
+    Max1FlagOnBoundaryTransitionError(string const & hostPath);
 
   public:
-    //! The compound state's path.
-    string const compoundStatePath;
+    //! The path of the state that hosts the transition.
+    string const hostPath;
 
-    class DefaultRegionRequest;
-    class Insertion;
+  private:
+    string specific() const override;
   };
 #else
-  static int constexpr regionError_defaultRegionRequest{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-  static int constexpr regionError_insertion_hasDefaultRegion{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+  static int constexpr max1FlagOnBoundaryTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 };
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-//! Error thrown whenever a default region is requested on a compound state that already has non-default regions.
-class CompoundState::RegionError::DefaultRegionRequest
+//! Completion flags that can be added as specs to transitions.
+/*!
+ * A completion flag specifies that the transition becomes enabled only once
+ * the source state has terminated - in addition to any guards the transition might have.
+ * Completion flags may be added to auto transitions.
+ * Adding a completion flag to any other type of transition leads to an error being thrown.
+ */
+class CompletionFlag
 :
-  public CompoundState::RegionError
+  public Transition::Spec
 {
-  friend class CompoundStateImpl;
+  friend class Transition;
 
 private:
-  DefaultRegionRequest(string const & compoundStatePath, size_t const nrOfNonDefaultRegions);
+  void join(Transition const * const) const override;
 
 public:
-  //! The number of non-default regions that have already been added.
-  size_t const nrOfNonDefaultRegions;
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown whenever a completion flag is added to a single-state transition.
+  class CompletionFlagOnSingleStateTransitionError
+  :
+    public Error
+  {
+    friend class CompletionFlag;
 
-private:
-  string specific() const override;
+  private:
+    CompletionFlagOnSingleStateTransitionError(string const & hostPath);
+
+  public:
+    //! The path of the state that hosts the transition.
+    string const hostPath;
+
+  private:
+    string specific() const override;
+  };
+#else
+  static int constexpr completionFlagOnSingleStateTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
 };
 
-//! Base class of errors thrown on adding a region to a compound state.
-class CompoundState::RegionError::Insertion
+//! Trigger specs that can be added to triggered transitions.
+/*!
+ * A triggered transition can have more than one trigger signal. Besides all other
+ * preconditions (control flow and guards), the transition is enabled whenever
+ * at least one trigger signal is activated.
+ */
+class Trigger
 :
-  public CompoundState::RegionError
+  public Transition::Spec
 {
-protected:
-  Insertion(string const & compoundStatePath, string const & regionName);
+  friend class Transition;
 
 public:
-  // The name of the region.
-  string const regionName;
-
-  class HasDefaultRegion;
-  class NameClash;
-};
+  //! Construct a trigger spec.
+  /*!
+   * \param trigger the trigger signal.
+   */
+  Trigger(Event const & trigger);
 
-//! Error thrown on adding a region to a compound state that already has a default region.
-class CompoundState::RegionError::Insertion::HasDefaultRegion
-:
-  public CompoundState::RegionError::Insertion
-{
-  friend class CompoundStateImpl;
+  //! The trigger signal.
+  Event const & signal;
 
 private:
-  HasDefaultRegion(string const & compoundStatePath, string const & regionName);
-
-  string specific() const override;
+  void join(Transition const * const) const override;
 };
 
-//! Error thrown on a name clash among the regions belonging to a compound state.
-class CompoundState::RegionError::Insertion::NameClash
+//! Timer specs that make triggered transitions fire after a delay.
+/*!
+ * The timer is armed whenever the source state of the transition is entered and is cancelled when
+ * the source state is exited or frozen. Once the delay has passed, as measured by Top::advanceTime,
+ * the timer acts as a trigger of the transition for a single macro step.
+ */
+class After
 :
-  public CompoundState::RegionError::Insertion
+  public Transition::Spec
 {
-  friend class CompoundStateImpl;
+  friend class Transition;
 
-private:
-  NameClash(string const & compoundStatePath, string const & regionName);
+public:
+  //! Construct a timer spec.
+  /*!
+   * \param delay the delay from the time point at which the source state has been entered.
+   */
+  After(Top::Duration const delay);
 
-  string specific() const override;
+  //! The delay.
+  Top::Duration const delay;
+
+private:
+  void join(Transition const * const) const override;
 };
-#endif // STATE_DIAGRAM_STRINGLESS
 
-  //! Base class of all states other than top states.
-class SubState
+//! Timer specs that make triggered transitions fire at a time point.
+/*!
+ * The timer is armed whenever the source state of the transition is entered and is cancelled when
+ * the source state is exited or frozen. Once the time point has been reached, as measured by Top::advanceTime,
+ * the timer acts as a trigger of the transition for a single macro step.
+ */
+class At
 :
-  private PImplUpcast<SubStateImpl>
-, public virtual NamePath
+  public Transition::Spec
 {
-protected:
-  SubState(SubStateImpl * const impl);
+  friend class Transition;
 
 public:
-  bool isCurrent() const;
+  //! Construct a timer spec.
+  /*!
+   * \param deadline the time point.
+   */
+  At(Top::TimePoint const deadline);
+
+  //! The time point.
+  Top::TimePoint const deadline;
+
+private:
+  void join(Transition const * const) const override;
 };
 
-//! Base class of states that are admissible as the source state of some external transition.
-class SourceState
+//! Guard specs that can be added to transitions.
+/*!
+ * A guard spec is constructed from a function that returns a truth value.
+ * To check the guard at any given point of time, the function is evaluated.
+ * All guards that belong to a transition
+ * must return true for the transition to be enabled. If the transition is a triggered transition,
+ * then
+ * checking whether it is enabled entails looking for a trigger signal that is activated and,
+ * at the same time, makes all guards return true with
+ * triggered guards receiving the trigger signal as argument.
+ *
+ * At execution time, guards may be evaluated in any order. In particular, they may be evaluated in an order
+ * that differs from the one in which they were added to the transition. It is recommended to
+ * keep guards free of visible side effects.
+ */
+class Guard
 :
-  private PImplUpcast<SourceStateImpl>
-, public virtual SubState
+  public Transition::Spec
 {
-  friend class Auto;
-  friend class Step;
+  friend class Transition;
+  friend class TriggerlessTransitionImpl;
+  friend class TriggeredTransitionImpl;
 
-protected:
-  SourceState(SourceStateImpl * const impl);
+public:
+  //! Construct a trigger-less guard spec.
+  /*!
+   * The guard function is stored in place and called without going through std::function.
+   *
+   * \param triggerlessGuard the guard function.
+   */
+  template<class TriggerlessGuardFun, enable_if_t<is_invocable_r_v<bool, TriggerlessGuardFun &>, int> = 0>
+  Guard(TriggerlessGuardFun const & triggerlessGuard);
+
+  //! Construct a triggered guard spec.
+  /*!
+   * The guard function is stored in place and called without going through std::function.
+   *
+   * \param triggeredGuard the guard function.
+   */
+  template
+  <
+    class TriggeredGuardFun
+  , enable_if_t
+    <
+      is_invocable_r_v<bool, TriggeredGuardFun &, Event const &> && (!is_invocable_v<TriggeredGuardFun &>)
+    , int
+    > = 0
+  >
+  Guard(TriggeredGuardFun const & triggeredGuard);
 
-  SourceStateImpl * implUpcast() const;
+private:
+  TriggerlessGuard const triggerless;
+  TriggeredGuard const triggered;
+
+  void join(Transition const * const) const override;
 };
 
-//! Base class of states that are admissible as the target state of some external transition.
-class TargetState
-:
-  private PImplUpcast<TargetStateImpl>
-, public virtual SubState
+//! Emitters handed to functional output specs.
+/*!
+ * An emitter activates each signal it is called with for the remainder of the macro step.
+ * Emitting signals through an emitter does not allocate memory.
+ */
+class OutputEmitter
 {
-  friend class Auto;
-  friend class Step;
+  friend class TriggerlessTransitionImpl;
+  friend class TriggeredTransitionImpl;
 
-protected:
-  TargetState(TargetStateImpl * const impl);
+public:
+  OutputEmitter(OutputEmitter const &) = delete;
 
-  TargetStateImpl * implUpcast() const;
+  void operator=(OutputEmitter const &) = delete;
+
+  //! Activate a signal.
+  /*!
+   * \param output the signal to be activated.
+   */
+  void operator()(LocalEvent const & output) const;
+
+private:
+  OutputEmitter(SubStateImpl const * const outputScope);
+
+  SubStateImpl const * const m_outputScope;
 };
 
-//! Top states or, equivalently, entire state machines.
-class Top
+//! Output specs that can be added to transitions.
+/*!
+ * An output spec is constructed from a reference to a const signal, or a function that returns
+ * a reference to a const signal. An output spec is executed whenever the transition it belongs
+ * to is executed. Its effect consists of activating the signal referred-to for the remainder of the macro step.
+ * (Output specs might, thus, better be called activation specs. It is for historical reasons
+ * that the term used is kept here.)
+ *
+ * At execution time, all output specs that have been added to a transition are executed. They may be
+ * executed in any order. In particular, they may be executed in an order
+ * that differs from the one in which they were added to the transition. It is recommended to
+ * keep output spec functions free of visible side effects.
+ */
+class Output
 :
-  private virtual PImpl<TopStateImpl>
-, public CompoundState
+  public Transition::Spec
 {
-  friend class ExternalSignalDelegate;
-  friend class ExternalEvent;
-  friend class ExternalVarDelegate;
+  friend class Transition;
+  friend class TriggerlessTransitionImpl;
+  friend class TriggeredTransitionImpl;
 
 public:
-  //! Construct a top state.
+  //! Vectors of const references to local signals.
+  using LocalEventVector = vector<reference_wrapper<LocalEvent const>>;
+
+  //! Emitters handed to functional output specs.
+  using Emitter = OutputEmitter;
+
+  //! Construct a trigger-less output spec.
   /*
-   * \parameter name the name of the top state.
+   * \param triggerlessOutput the signal to be activated.
    */
-  Top(STATE_DIAGRAM_STRING_PARAM(name));
+  Output(LocalEvent const & triggerlessOutput);
 
-  //! Destruct top state.
+  //! Construct a trigger-less output spec.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param triggerlessOutputs a vector of signals that are to be activated.
    */
-  ~Top();
+  Output(LocalEventVector const & triggerlessOutputs);
 
-  //! Initializing a top state.
+  //! Construct a functional trigger-less output spec.
   /*!
-   * The initialization function needs be called once before executing macro steps.
+   * \param triggerlessOutputFun a function returning the signal to be activated.
    */
-  void init() const;
+  Output(function<LocalEvent const & ()> const & triggerlessOutputFun);
 
-  //! Executing a macro step, that is to say, as many micro steps as possible.
+  //! Construct a functional trigger-less output spec.
   /*!
-   * Executing a macro step consists of transition executions. This process continues until
-   * no transitions are enabled anymore, or forever if the state machine does not run out
-   * of enabled transitions.
-   *
-   * \return true if the state machine enters an overall terminal state as a result of the macro step, false if not.
+   * \param triggerlessOutputFun a function returning a vector of signals that are to be activated.
    */
-  bool step() const;
+  Output(function<LocalEventVector ()> const & triggerlessOutputsFun);
 
-  //! Executing a macro step supplying external signals that are to be activated.
+  //!Construct a functional triggered output spec.
   /*!
-   * Executing a macro step consists of transition firings. These firings continue until
-   * no transitions are enabled anymore, or forever if the state machine does not run out
-   * of enabled transitions.
-   *
-   * \param trigger the first external signal that is to be activated as trigger.
-   * \param remainingTriggers the remaining external signals that are to be activated as triggers.
-   *
-   * \return true if the state machine assumes an overall terminal state as a result of the macro step, false if not.
+   * \param triggeredOutput a trigger-dependent function returning the signal to be activated.
    */
-  template<class E, class... Es>
-  bool step(E const & trigger, Es const &... remainingTriggers) const;
-
-#ifndef STATE_DIAGRAM_STRINGLESS
-  class RequestForCurLocalScopeError
-  :
-    public Error
-  {
-    friend class TopStateImpl;
-
-  private:
-    RequestForCurLocalScopeError(string const & localVarPath);
-
-  public:
-    string const localVarPath;
-
-  private:
-    string specific() const override;
-  };
-#else
-  static int constexpr requestForCurLocalScopeError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
-
-private:
-  void activate(ExternalEvent const & trigger) const;
-};
-
-template<class E, class... Es>
-bool
-Top
-::step(E const & trigger, Es const &... remainingTriggers)
-const
-{
-  activate(trigger);
-  return step(remainingTriggers...);
-}
-
-//! Initial states.
-/*!
- * Every region can have at most one initial state. The
- * initial state cannot be
- * the target state of any transition and cannot be sub-divided either.
- * The initial state of some region, R say, becomes current within
- * R whenever the parent state of R becomes
- * current by way of it being the target of some transition being executed,
- * the top state always being current. If R
- * does not have any initial state, then control flow can
- * enter R only by way of state-boundary crossing transitions that target
- * sub-states of R directly.
- */
-class Init
-:
-  private virtual PImpl<InitStateImpl>
-, public SourceState
-{
-public:
-  //! The name of an initial state as a macro.
-# define STATE_DIAGRAM_NAME_OF_INITIAL_STATE "INIT"
-
-  //! The name of an initial state as a string constant.
-  static string const name;
+  Output(function<LocalEvent const & (Event const &)> const & triggeredOutput);
 
-  //! Construct an initial state inside a default region of the parent state.
+  //!Construct a functional triggered output spec.
   /*!
-   * If the parent state already has a default region from a similar constructor
-   * invocation, then that region is used; if not, then a default region is created.
-   *
-   * \param parent the parent compound state.
+   * \param triggeredOutput a trigger-dependent function returning a vector of signals that are to be activated.
    */
-  Init(CompoundState const & parent);
+  Output(function<LocalEventVector (Event const &)> const & triggeredOutputs);
 
-  //! Construct an initial state inside a parent region that is explicitly referred-to.
+  //! Construct an emitting trigger-less output spec.
   /*!
-   * \param parent the parent region.
+   * Unlike functions returning vectors, emitting functions activate any number of signals without allocating memory.
+   * The function is stored in place and called without going through std::function.
+   *
+   * \param triggerlessEmit a function that passes the signals to be activated to the emitter it receives.
    */
-  Init(Region const & parent);
+  template<class TriggerlessEmitFun, enable_if_t<is_invocable_v<TriggerlessEmitFun &, Emitter const &>, int> = 0>
+  Output(TriggerlessEmitFun const & triggerlessEmit);
 
-  //! Destruct initial state.
+  //! Construct an emitting triggered output spec.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * Unlike functions returning vectors, emitting functions activate any number of signals without allocating memory.
+   * The function is stored in place and called without going through std::function.
+   *
+   * \param triggeredEmit a trigger-dependent function that passes the signals to be activated to the emitter it
+   * receives.
    */
-  ~Init();
+  template
+  <
+    class TriggeredEmitFun
+  , enable_if_t<is_invocable_v<TriggeredEmitFun &, Event const &, Emitter const &>, int> = 0
+  >
+  Output(TriggeredEmitFun const & triggeredEmit);
+
+private:
+  TriggerlessOutput const triggerless;
+  TriggerlessOutputFun const triggerlessFun;
+  TriggeredOutput const triggered;
+
+  void join(Transition const * const) const override;
 };
 
-//! Final states.
+//! Action specs that can be added to transitions.
 /*!
- * Every region can have at most one final state. The
- * final state cannot be
- * the source state of any transition and cannot be sub-divided either.
+ * At execution time, all action specs that have been added to a transition are executed. They may be
+ * executed in any order. In particular, they may be executed in an order
+ * that differs from the one in which they were added to the transition. It is recommended to
+ * keep the visible effects actions may have independent of the order in which they are executed.
  */
-class Final
+class Action
 :
-  private virtual PImpl<FinalStateImpl>
-, public TargetState
+  public Transition::Spec
 {
-public:
-  //! The name of a final state as a macro.
-# define STATE_DIAGRAM_NAME_OF_FINAL_STATE "FINAL"
-
-  //! The name of a final state as a string constant.
-  static string const name;
+  friend class Transition;
+  friend class TriggerlessTransitionImpl;
+  friend class TriggeredTransitionImpl;
 
-  //! Construct a final state inside a default region of the parent state.
+public:
+  //! Construct a trigger-less action.
   /*!
-   * If the parent state already has a default region from a similar constructor
-   * invocation, then that region is used; if not, then a default region is created.
+   * The function is stored in place and called without going through std::function.
    *
-   * \param parent the parent compound state.
+   * \param triggerlessAction a function to be executed.
    */
-  Final(CompoundState const & parent);
+  template<class TriggerlessActionFun, enable_if_t<is_invocable_v<TriggerlessActionFun &>, int> = 0>
+  Action(TriggerlessActionFun const & triggerlessAction);
 
-  //! Construct a final state inside a parent region that is explicitly referred-to.
+  //! Construct a triggered action.
   /*!
-   * \param parent the parent region.
+   * The function is stored in place and called without going through std::function.
+   *
+   * \param triggerlessAction a trigger-dependent function to be executed.
    */
-  Final(Region const & parent);
+  template
+  <
+    class TriggeredActionFun
+  , enable_if_t
+    <
+      is_invocable_v<TriggeredActionFun &, Event const &> && (!is_invocable_v<TriggeredActionFun &>)
+    , int
+    > = 0
+  >
+  Action(TriggeredActionFun const & triggeredAction);
 
-  //! Destruct final state.
-  /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
-   */
-  ~Final();
+private:
+  TriggerlessAction const triggerless;
+  TriggeredAction const triggered;
+
+  void join(Transition const * const) const override;
 };
 
-//! Ordinary sub-divisible states.
-/*!
- * Ordinary sub-divisible states are simply called states if no confusion can arise.
- * The first layer of sub-division is always made up of zero or more regions.
- * These regions contain the second layer, which consists of the sub-states of the parent state.
- * These sub-states can be sub-divisible again and so on. Recursion stops at states
- * that do not have any child regions.
- * In all cases where
- * there is more
- * than one region attached to a state, these regions are executed concurrently to each other.
- *
- * States can appear both as the source and as the target of transitions - the so-called
- * external transitions.
- * Furthermore, they can have enter-, exit- and internal step transitions attached
- * to them - the so-called single-state transitions.
- */
-class State
+template<class TriggerlessEmitFun, enable_if_t<is_invocable_v<TriggerlessEmitFun &, OutputEmitter const &>, int>>
+Output
+::Output(TriggerlessEmitFun const & triggerlessEmit)
+:
+  triggerless{nullptr}
+, triggerlessFun{makeSpecFunction<void (OutputEmitter const &)>(triggerlessEmit)}
+, triggered
+  {
+    makeSpecFunction<void (Event const &, OutputEmitter const &)>
+    (
+      TriggerIgnoring<decay_t<TriggerlessEmitFun>>{triggerlessEmit}
+    )
+  }
+{
+  // This space intentionally left empty
+}
+
+template
+<
+  class TriggeredEmitFun
+, enable_if_t<is_invocable_v<TriggeredEmitFun &, Event const &, OutputEmitter const &>, int>
+>
+Output
+::Output(TriggeredEmitFun const & triggeredEmit)
+:
+  triggerless{nullptr}
+, triggerlessFun{nullptr}
+, triggered{makeSpecFunction<void (Event const &, OutputEmitter const &)>(triggeredEmit)}
+{
+  // This space intentionally left empty
+}
+
+template<class TriggerlessGuardFun, enable_if_t<is_invocable_r_v<bool, TriggerlessGuardFun &>, int>>
+Guard
+::Guard(TriggerlessGuardFun const & triggerlessGuard)
+:
+  triggerless{makeSpecFunction<bool ()>(triggerlessGuard)}
+, triggered{makeSpecFunction<bool (Event const &)>(TriggerIgnoring<decay_t<TriggerlessGuardFun>>{triggerlessGuard})}
+{
+  // This space intentionally left empty
+}
+
+template
+<
+  class TriggeredGuardFun
+, enable_if_t
+  <
+    is_invocable_r_v<bool, TriggeredGuardFun &, Event const &> && (!is_invocable_v<TriggeredGuardFun &>)
+  , int
+  >
+>
+Guard
+::Guard(TriggeredGuardFun const & triggeredGuard)
 :
-  private virtual PImpl<StateImpl>
-, public CompoundState
-, public SourceState
-, public TargetState
+  triggerless{nullptr}
+, triggered{makeSpecFunction<bool (Event const &)>(triggeredGuard)}
 {
-  friend class Step;
-  friend class Enter;
-  friend class Exit;
-  friend class InternalAuto;
-  friend class InternalStep;
+  // This space intentionally left empty
+}
+
+template<class TriggerlessActionFun, enable_if_t<is_invocable_v<TriggerlessActionFun &>, int>>
+Action
+::Action(TriggerlessActionFun const & triggerlessAction)
+:
+  triggerless{makeSpecFunction<void ()>(triggerlessAction)}
+, triggered{makeSpecFunction<void (Event const &)>(TriggerIgnoring<decay_t<TriggerlessActionFun>>{triggerlessAction})}
+{
+  // This space intentionally left empty
+}
+
+template
+<
+  class TriggeredActionFun
+, enable_if_t
+  <
+    is_invocable_v<TriggeredActionFun &, Event const &> && (!is_invocable_v<TriggeredActionFun &>)
+  , int
+  >
+>
+Action
+::Action(TriggeredActionFun const & triggeredAction)
+:
+  triggerless{nullptr}
+, triggered{makeSpecFunction<void (Event const &)>(triggeredAction)}
+{
+  // This space intentionally left empty
+}
 
+//! Trigger-less two-state transitions, called auto transitions.
+class Auto
+:
+  private virtual PImpl<AutoTransitionImpl>
+, public TriggerlessTransition
+, public ExternalTransition
+{
 public:
-  //! Construct a state inside a default region of the parent state.
+  //! Construct a auto transition .
   /*!
-   * \param name the name of the state.
-   * \param the parent state.
+   * \param source the source state.
+   * \param source the target state.
    */
-  State(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+  Auto(SourceState const & source, TargetState const & target);
 
-  //! Construct a state inside a parent region that is explicitly referred to.
+  //! Construct a auto transition supplying specs.
   /*!
-   * \param name the name of the state.
-   * \param the parent region.
+   * \param source the source state.
+   * \param source the target state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
    */
-  State(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+  template<class S, class... Ss>
+  Auto
+  (
+    SourceState const & source
+  , TargetState const & target
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
 
-  //! Destruct state.
+  //! Destruct auto transition.
   /*!
    * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  ~State();
-
-  //! Test whether a state has terminated.
-  /*!
-   * This predicate provided for usage in transition guards.
-   * A state has terminated if, and only if, the current states of all of its child regions
-   * are terminal states.
-   */
-  bool hasTerminated() const;
+  ~Auto();
 };
 
-//! Connector states.
-/*!
- * Connector states can appear both as the source and as the target of transitions - the so-called
- * external transitions.
- */
-class Connector
+template<class S, class... Ss>
+Auto
+::Auto
+(
+  SourceState const & source
+, TargetState const & target
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
 :
-  private virtual PImpl<ConnectorStateImpl>
-, public SourceState
-, public TargetState
+  Auto(source, target, remainingSpecs...)
 {
-  friend class Step;
+  add(forward<S>(firstSpec));
+}
 
+//! Triggered two-state transitions, called step transitions.
+class Step
+:
+  private virtual PImpl<StepTransitionImpl>
+, public TriggeredTransition
+, public ExternalTransition
+{
 public:
-  //! Construct a state inside a default region of the parent state.
+  //! Construct a step transition.
   /*!
-   * \param name the name of the state.
-   * \param the parent state.
+   * \param source the source state.
+   * \param target the target state.
    */
-  Connector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+  Step(SourceState const & source, TargetState const & target);
 
-  //! Construct a state inside a parent region that is explicitly referred to.
+  //! Construct a step transition supplying specs.
   /*!
-   * \param name the name of the state.
-   * \param the parent region.
+   * \param source the source state.
+   * \param source the target state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
    */
-  Connector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+  template<class S, class... Ss>
+  Step
+  (
+    SourceState const & source
+  , TargetState const & target
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
 
-  //! Destruct state.
+  //! Destruct step transition.
   /*!
    * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  ~Connector();
-
-  //! Test whether a state has terminated.
-  /*!
-   * This predicate provided for usage in transition guards.
-   * A state has terminated if, and only if, the current states of all of its child regions
-   * are terminal states.
-   */
-  bool hasTerminated() const;
+  ~Step();
 };
 
-//! Base class of all transitions.
-class Transition
+template<class S, class... Ss>
+Step
+::Step
+(
+  SourceState const & source
+, TargetState const & target
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
 :
-  private PImplUpcast<TransitionImpl>
+  Step(source, target, remainingSpecs...)
 {
-  friend class Action;
-  friend class CompletionFlag;
-  friend class FreezeFlag;
-  friend class Guard;
-  friend class Max1Flag;
-  friend class Output;
-  friend class Trigger;
+  add(forward<S>(firstSpec));
+}
 
+//! Base class for boundary (enter- and exit-) transitions.
+class BoundaryTransition
+:
+  public TriggerlessTransition
+, public SingleStateTransition
+{
 protected:
-  Transition(TransitionImpl * const impl);
-
-  virtual ~Transition();
-
-  TransitionImpl * implUpcast() const;
+  BoundaryTransition(BoundaryTransitionImpl * const impl);
+};
 
+//! Enter transitions.
+/*!
+ * An enter transition is executed whenever the control flow enters the state hosting it.
+ */
+class Enter
+:
+  private virtual PImpl<EnterTransitionImpl>
+, public BoundaryTransition
+{
 public:
-  //! Base class of all transition specs.
+  //! Construct an enter transition.
   /*!
-   * Transition specs are annotations that can be added to transitions to modify their behavior in various ways.
+   * \param state the host state.
    */
-  class Spec
-  {
-    friend class Transition;
-    friend class TriggerlessTransition;
-    friend class TriggeredTransition;
-
-  protected:
-    virtual ~Spec();
-
-    virtual void join(Transition const * const) const = 0;
-
-  public:
-#ifndef STATE_DIAGRAM_STRINGLESS
-    //! Error thrown whenever a trigger spec is added to a trigger-less transition.
-    class TriggerSpecOnTriggerlessTransitionError
-    :
-      public Error
-    {
-      friend class TriggerlessTransitionImpl;
-
-    private:
-      TriggerSpecOnTriggerlessTransitionError
-      (
-        string const & transitionTypeIndicator
-      , string const & originPath
-      );
-
-    public:
-      //! The type of the transition.
-      string const transitionTypeIndicator;
-
-      //! The path to the origin of the transition.
-      string const originPath;
-
-    protected:
-      string specific() const override;
-    };
-#else
-    static int constexpr triggerSpecOnTriggerlessTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
-
-#ifndef STATE_DIAGRAM_STRINGLESS
-    //! Error thrown whenever a trigger-dependent spec is added to a trigger-less transition.
-    class TriggeredSpecOnTriggerlessTransitionError
-    :
-      public Error
-    {
-      friend class TriggerlessTransitionImpl;
-
-    private:
-      TriggeredSpecOnTriggerlessTransitionError
-      (
-        string const & specTypeIndicator
-      , string const & transitionTypeIndicator
-      , string const & originPath
-      );
-
-    public:
-      //! The type of spec.
-      string const specTypeIndicator;
-
-      //! The type of the transition .
-      string const transitionTypeIndicator;
-
-      //! The path to the origin of the transition.
-      string const originPath;
-
-    private:
-      string specific() const override;
-    };
-#else
-    static int constexpr triggeredSpecOnTriggerlessTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
-  };
+  Enter(State const & host);
 
-  //! Add a spec to a transition.
+  //! Construct an enter transition supplying specs.
   /*!
-   * \param spec the spec.
-   * \return the transition itself.
+   * \param state the host state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
    */
-  Transition const & add(Spec const & spec) const;
+  template<class S, class... Ss>
+  Enter
+  (
+    State const & host
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
 
-  //! Add a spec to a transition.
+  //! Destruct enter transition.
   /*!
-   * \param spec the spec.
-   * \return the transition itself.
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  Transition const & operator<<(Spec const & spec) const;
-
-#ifndef STATE_DIAGRAM_STRINGLESS
-  //! Base class for signal scope errors.
-  class ScopeError
-  :
-    public Error
-  {
-  protected:
-    ScopeError(string const & signalPath, string const & scopePath);
-
-  public:
-    //! The path to the signal.
-    string const signalPath;
-
-    //! The path to the scope in which the error occurs, meaning that the signal ought to be visible in this scope but isn't.
-    string const scopePath;
-
-    class Output;
-  };
-#else
-    static int constexpr scopeError_output{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
+  ~Enter();
 };
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-//! Error thrown when a transition activates a signal that lies out of scope.
-class Transition::ScopeError::Output
+template<class S, class... Ss>
+Enter
+::Enter
+(
+  State const & host
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
 :
-  public Transition::ScopeError
+  Enter(host, remainingSpecs...)
 {
-  friend class TriggerlessTransitionImpl;
-  friend class TriggeredTransitionImpl;
+  add(forward<S>(firstSpec));
+}
 
-private:
-  Output(string const & signalPath, string const & scopePath);
+//! Exit transitions.
+/*!
+ * An exit transition is executed whenever the control flow exits the state hosting it.
+ */
+class Exit
+:
+  private virtual PImpl<ExitTransitionImpl>
+, public BoundaryTransition
+{
+public:
+  //! Construct an exit transition.
+  /*!
+   * \param state the host state.
+   */
+  Exit(State const & host);
 
-  string specific() const override;
+  //! Construct an exit transition supplying specs.
+  /*!
+   * \param state the host state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   */
+  template<class S, class... Ss>
+  Exit
+  (
+    State const & host
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
+
+  //! Destruct exit transition.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Exit();
 };
-#endif // STATE_DIAGRAM_STRINGLESS
 
-//! Base class for enter-, exit- and internal step transitions.
-class SingleStateTransition
+template<class S, class... Ss>
+Exit
+::Exit
+(
+  State const & host
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
 :
-  public virtual Transition
+  Exit(host, remainingSpecs...)
 {
-protected:
-  SingleStateTransition(SingleStateTransitionImpl * const impl);
-};
+  add(forward<S>(firstSpec));
+}
 
-//! Base class for auto and step transitions.
-class ExternalTransition
+//! Internal step transitions.
+/*!
+ * An internal step transition can be executed whenever the control flow resides inside the state hosting it.
+ * An internal step transition without any guards or without a max-1 flag leads to livelock once its trigger
+ * signal is activated. To prevent this kind of livelock, internal step transitions
+ * require one or more guards and/or a max-1 flag.
+ */
+class InternalStep
 :
-  public virtual Transition
+  private virtual PImpl<InternalStepTransitionImpl>
+, public TriggeredTransition
+, public SingleStateTransition
 {
-protected:
-  ExternalTransition(ExternalTransitionImpl * const impl);
-
 public:
-#ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown when the source and the target of an external transition do not lie in regions that are related via direct descent.
+  //! Construct an internal step transition.
   /*!
-   * Direct descent means that the two regions either are the same or that one
-   * of them is an ancestor of the other in the state-region hierarchy. Direct descent
-   * is violated if, and only if, the two regions are concurrent to each other.
-   * Avoiding the error being thrown means to avoid transitions that go across
-   * concurrency boundaries.
+   * \param host the host state.
    */
-  class DescendanceError
-  :
-    public Error
-  {
-    friend class ExternalTransitionImpl;
-
-  private:
-    DescendanceError(string const & sourcePath, string const & targetPath);
-
-  public:
-    //! The path of the source state.
-    string const sourcePath;
+  InternalStep(State const & host);
 
-    //! The path of the target state.
-    string const targetPath;
+  //! Construct an internal step transition supplying specs
+  /*!
+   * \param host the host state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   */
+  template<class S, class... Ss>
+  InternalStep
+  (
+    State const & host
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
 
-  private:
-    string specific() const override;
-  };
-#else
-    static int constexpr descendanceError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
+  //! Destruct internal step transition.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~InternalStep();
 };
 
-//! Base class for trigger-less transitions.
-class TriggerlessTransition
+template<class S, class... Ss>
+InternalStep
+::InternalStep
+(
+  State const & host
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
 :
-  public virtual Transition
+  InternalStep(host, remainingSpecs...)
 {
-protected:
-  TriggerlessTransition(TriggerlessTransitionImpl * const impl);
-};
+  add(forward<S>(firstSpec));
+}
 
-//! Base class for triggered transitions.
-class TriggeredTransition
+//! Internal auto transitions.
+/*!
+ * An internal auto transition can be executed whenever the control flow resides inside the state hosting it.
+ * An internal auto transition without any guards or without a max-1 flag leads to livelock.
+ * To prevent this kind of livelock, internal auto transitions
+ * require one or more guards and/or a max-1 flag.
+ */
+class InternalAuto
 :
-  public virtual Transition
+  private virtual PImpl<InternalAutoTransitionImpl>
+, public TriggerlessTransition
+, public SingleStateTransition
 {
-protected:
-  TriggeredTransition(TriggeredTransitionImpl * const impl);
-
 public:
-#ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown whenever a triggered transition is being added a trigger that lies out of scope.
+  //! Construct an internal auto transition.
   /*!
-   * The source state of the transition determines which signals lie in scope as potential triggers.
+   * \param host the host state.
    */
-  class TriggerScopeError
-  :
-    public Transition::ScopeError
-  {
-    friend class TriggeredTransitionImpl;
+  InternalAuto(State const & host);
 
-  private:
-    TriggerScopeError(string const & signalPath, string const & scopePath);
+  //! Construct an internal auto transition supplying specs
+  /*!
+   * \param host the host state.
+   * \param firstSpec the first spec to be added to the transition on construction.
+   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   */
+  template<class S, class... Ss>
+  InternalAuto
+  (
+    State const & host
+  , S && firstSpec
+  , Ss &&... remainingSpecs
+  );
 
-    string specific() const override;
-  };
-#else
-    static int constexpr triggerScopeError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
+  //! Destruct internal auto transition.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~InternalAuto();
 };
 
-//! Designators for the two types of freezes.
+template<class S, class... Ss>
+InternalAuto
+::InternalAuto
+(
+  State const & host
+, S && firstSpec
+, Ss &&... remainingSpecs
+)
+:
+  InternalAuto(host, remainingSpecs...)
+{
+  add(forward<S>(firstSpec));
+}
+
+//! Diagram images, that is to say, state machine structures serialized into a compact binary form.
 /*!
- * A transition labeled with a freeze flag carrying the designator, FULL, freezes its source
- * state and every state beneath it. No exit transitions are executed as the transition is executed.
- * Once the state is re-entered, no enter transitions are executed and all current states are
- * the same as before the freeze.
+ * An image holds the components of a state machine, their names and parents, as well as its
+ * transitions and their specs. Guards, actions and functional outputs are not held by an image,
+ * but are referred to by slot IDs, just like the data types of signals and variables are
+ * referred to by type IDs. Both are bound to C++ entities when a top state is loaded from the image.
  *
- * A transition labeled with a freeze flag carrying the designator, SHALLOW, freezes the level just
- * beneath its source state - so that the current state of each direct child region of the source
- * state is frozen in place.
- * All levels below that are exited and entered again like normal.
+ * Components and transitions are referred to by their indices within the image. The top state is
+ * always the component at index 0.
  *
- * The freeze condition can be overridden on re-entry. To override it, use a transition that crosses
- * the state boundary, directly targeting some sub-state.
+ * An image has a fixed layout and is read in place, which is why it can be memory-mapped from a file
+ * as is. Images are stored in the byte order of the host that writes them. The structure of an image
+ * is validated in full when it is constructed.
  */
-enum FreezeDepth {FULL, SHALLOW};
-
-//! Freeze flags that can be added as specs to transitions.
-class FreezeFlag
+class Image
 :
-  public Transition::Spec
+  private PImpl<ImageImpl>
 {
-  friend class Transition;
+  friend class ImageCodeGenerator;
+  friend class ImageTop;
 
 public:
-  FreezeFlag(FreezeDepth const freezeDepth);
+  //! The type of indices of components and transitions within an image.
+  using Idx = uint32_t;
 
-  FreezeDepth const freezeDepth;
+  //! The index of the top state within an image.
+  static Idx constexpr topIdx{0};
 
-private:
-  void join(Transition const * const) const override;
+  //! The type ID of signals that do not carry any data payload, which is bound implicitly.
+  static uint32_t constexpr voidTypeId{0};
+
+  //! Map an image from a file.
+  /*!
+   * The file is mapped read-only, so its pages are shared by all processes that map the same file.
+   *
+   * \param path the path of the file.
+   */
+  Image(char const * const path);
+
+  //! Construct an image that refers to bytes in memory.
+  /*!
+   * The bytes are not copied. They must be aligned to 8 bytes and outlive the image.
+   *
+   * \param bytes the bytes of the image.
+   * \param size the number of bytes.
+   */
+  Image(void const * const bytes, size_t const size);
+
+  //! Destruct image, unmapping it if it has been mapped from a file.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~Image();
+
+  //! Return the number of bytes of the image.
+  size_t size() const;
+
+  //! Return the number of components of the image, including the top state.
+  size_t nrOfComponents() const;
+
+  //! Return the number of transitions of the image.
+  size_t nrOfTransitions() const;
 
-public:
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown whenever a freeze flag is added to a single-state transition.
-  class FreezeFlagOnSingleStateTransitionError
+  //! Error thrown whenever a file cannot be mapped or written as an image.
+  class FileError
   :
     public Error
   {
-    friend class FreezeFlag;
+    friend class ImageCodeGeneratorImpl;
+    friend class ImageImpl;
+    friend class ImageWriterImpl;
 
   private:
-    FreezeFlagOnSingleStateTransitionError(string const & hostPath);
+    FileError(string const & path);
 
   public:
-    //! The path of the state that hosts the transition.
-    string const hostPath;
+    //! The path of the file.
+    string const path;
 
   private:
     string specific() const override;
   };
 #else
-    static int constexpr freezeFlagOnSingleStateTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+  static int constexpr fileError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 
 #ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown whenever a freeze flag is added to a auto transition.
-  class FreezeFlagOnAutoTransitionError
+  //! Error thrown whenever the structure of an image is found to be malformed.
+  class FormatError
   :
     public Error
   {
-    friend class FreezeFlag;
+    friend class ImageImpl;
 
   private:
-    FreezeFlagOnAutoTransitionError(string const & sourcePath, string const & targetPath);
+    FormatError(string const & reason);
 
   public:
-    //! The path of the source state.
-    string const sourcePath;
-
-    //! The path of the target state.
-    string const targetPath;
+    //! The reason why the image is malformed.
+    string const reason;
 
   private:
     string specific() const override;
   };
 #else
-  static int constexpr freezeFlagOnAutoTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+  static int constexpr formatError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
 #endif // STATE_DIAGRAM_STRINGLESS
 };
 
-//! Max-1 flags that can be added as specs to transitions.
+//! Writers of diagram images.
 /*!
- * A max-1 flag specifies that the transition can be executed at most once per macro step.
- * A typical use would consist of adding a max-1 flag to a reset transition, where
- * source and target state are the same. Another typical use would consist of adding a max-1 flag
- * to an internal step transition to prevent it from leading to livelock.
+ * Components are to be added after their parents. Each of the functions adding a component or a
+ * transition returns its index within the image, starting with index 1 for components, as index 0
+ * is taken by the top state, and with index 0 for transitions. Specs may be added to a transition
+ * at any time.
  */
-class Max1Flag
+class ImageWriter
 :
-  public Transition::Spec
+  private PImpl<ImageWriterImpl>
 {
-  friend class Transition;
+public:
+  //! Construct an image writer.
+  /*!
+   * \param topName the name of the top state.
+   */
+  ImageWriter(STATE_DIAGRAM_STRING_PARAM(topName));
 
-private:
-  void join(Transition const * const) const override;
+  //! Destruct image writer.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   */
+  ~ImageWriter();
 
-public:
-#ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown whenever a max-1 flag is added to an enter- or exit-transition.
-  class Max1FlagOnBoundaryTransitionError
-  :
-    public Error
-  {
-    friend class Max1Flag;
+  //! Add a region.
+  /*!
+   * \param name the name of the region.
+   * \param parent the index of the parent, which is either the top state or a regular state.
+   */
+  Image::Idx addRegion(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent) const;
 
-  private:
-    Max1FlagOnBoundaryTransitionError(string const & hostPath);
+  //! Add an initial state.
+  /*!
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   */
+  Image::Idx addInit(Image::Idx const parent) const;
 
-  public:
-    //! The path of the state that hosts the transition.
-    string const hostPath;
+  //! Add a final state.
+  /*!
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   */
+  Image::Idx addFinal(Image::Idx const parent) const;
 
-  private:
-    string specific() const override;
-  };
-#else
-  static int constexpr max1FlagOnBoundaryTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
-};
+  //! Add a regular state.
+  /*!
+   * \param name the name of the state.
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   */
+  Image::Idx addState(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent) const;
 
-//! Completion flags that can be added as specs to transitions.
-/*!
- * A completion flag specifies that the transition becomes enabled only once
- * the source state has terminated - in addition to any guards the transition might have.
- * Completion flags may be added to auto transitions.
- * Adding a completion flag to any other type of transition leads to an error being thrown.
- */
-class CompletionFlag
-:
-  public Transition::Spec
-{
-  friend class Transition;
+  //! Add a connector state.
+  /*!
+   * \param name the name of the connector state.
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   */
+  Image::Idx addConnector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent) const;
 
-private:
-  void join(Transition const * const) const override;
+  //! Add an external signal to the top state.
+  /*!
+   * \param name the name of the external signal.
+   * \param typeId the type ID of its data payload.
+   */
+  Image::Idx addExternalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) uint32_t const typeId = Image::voidTypeId) const;
 
-public:
-#ifndef STATE_DIAGRAM_STRINGLESS
-  //! Error thrown whenever a completion flag is added to a single-state transition.
-  class CompletionFlagOnSingleStateTransitionError
-  :
-    public Error
-  {
-    friend class CompletionFlag;
+  //! Add a local signal.
+  /*!
+   * \param name the name of the local signal.
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   * \param typeId the type ID of its data payload.
+   */
+  Image::Idx
+  addLocalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent, uint32_t const typeId = Image::voidTypeId)
+  const;
 
-  private:
-    CompletionFlagOnSingleStateTransitionError(string const & hostPath);
+  //! Add an external variable to the top state.
+  /*!
+   * \param name the name of the external variable.
+   * \param typeId the type ID of its data values.
+   */
+  Image::Idx addExternalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) uint32_t const typeId) const;
 
-  public:
-    //! The path of the state that hosts the transition.
-    string const hostPath;
+  //! Add a local variable.
+  /*!
+   * \param name the name of the local variable.
+   * \param parent the index of the parent, which is the top state, a regular state or a region.
+   * \param typeId the type ID of its data values.
+   */
+  Image::Idx addLocalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent, uint32_t const typeId) const;
 
-  private:
-    string specific() const override;
-  };
-#else
-  static int constexpr completionFlagOnSingleStateTransitionError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
-#endif // STATE_DIAGRAM_STRINGLESS
-};
+  //! Add an auto transition.
+  /*!
+   * \param source the index of the source state.
+   * \param target the index of the target state.
+   */
+  Image::Idx addAuto(Image::Idx const source, Image::Idx const target) const;
 
-//! Trigger specs that can be added to triggered transitions.
-/*!
- * A triggered transition can have more than one trigger signal. Besides all other
- * preconditions (control flow and guards), the transition is enabled whenever
- * at least one trigger signal is activated.
- */
-class Trigger
-:
-  public Transition::Spec
-{
-  friend class Transition;
+  //! Add a step transition.
+  /*!
+   * \param source the index of the source state.
+   * \param target the index of the target state.
+   */
+  Image::Idx addStep(Image::Idx const source, Image::Idx const target) const;
 
-public:
-  //! Construct a trigger spec.
+  //! Add an enter transition.
   /*!
-   * \param trigger the trigger signal.
+   * \param host the index of the host state.
    */
-  Trigger(Event const & trigger);
+  Image::Idx addEnter(Image::Idx const host) const;
 
-  //! The trigger signal.
-  Event const & signal;
+  //! Add an exit transition.
+  /*!
+   * \param host the index of the host state.
+   */
+  Image::Idx addExit(Image::Idx const host) const;
 
-private:
-  void join(Transition const * const) const override;
-};
+  //! Add an internal step transition.
+  /*!
+   * \param host the index of the host state.
+   */
+  Image::Idx addInternalStep(Image::Idx const host) const;
 
-//! Guard specs that can be added to transitions.
-/*!
- * A guard spec is constructed from a function that returns a truth value.
- * To check the guard at any given point of time, the function is evaluated.
- * All guards that belong to a transition
- * must return true for the transition to be enabled. If the transition is a triggered transition,
- * then
- * checking whether it is enabled entails looking for a trigger signal that is activated and,
- * at the same time, makes all guards return true with
- * triggered guards receiving the trigger signal as argument.
- *
- * At execution time, guards may be evaluated in any order. In particular, they may be evaluated in an order
- * that differs from the one in which they were added to the transition. It is recommended to
- * keep guards free of visible side effects.
- */
-class Guard
-:
-  public Transition::Spec
-{
-  friend class Transition;
-  friend class TriggerlessTransitionImpl;
-  friend class TriggeredTransitionImpl;
+  //! Add an internal auto transition.
+  /*!
+   * \param host the index of the host state.
+   */
+  Image::Idx addInternalAuto(Image::Idx const host) const;
 
-public:
-  //! Construct a trigger-less guard spec.
+  //! Add a trigger spec to a transition.
   /*!
-   * \param triggerlessGuard the guard function.
+   * \param transition the index of the transition.
+   * \param signal the index of the triggering signal.
    */
-  Guard(function<bool ()> const & triggerlessGuard);
+  void addTrigger(Image::Idx const transition, Image::Idx const signal) const;
 
-  //! Construct a triggered guard spec.
+  //! Add a timer spec firing after a delay to a transition.
   /*!
-   * \param triggeredGuard the guard function.
+   * \param transition the index of the transition.
+   * \param delay the delay.
    */
-  Guard(function<bool (Event const &)> const & triggeredGuard);
+  void addAfter(Image::Idx const transition, Top::Duration const delay) const;
 
-private:
-  TriggerlessGuard const triggerless;
-  TriggeredGuard const triggered;
+  //! Add a timer spec firing at a time point to a transition.
+  /*!
+   * \param transition the index of the transition.
+   * \param deadline the time point.
+   */
+  void addAt(Image::Idx const transition, Top::TimePoint const deadline) const;
 
-  void join(Transition const * const) const override;
+  //! Add a guard spec to a transition.
+  /*!
+   * \param transition the index of the transition.
+   * \param slotId the slot ID that the guard is bound to.
+   */
+  void addGuard(Image::Idx const transition, uint32_t const slotId) const;
+
+  //! Add an action spec to a transition.
+  /*!
+   * \param transition the index of the transition.
+   * \param slotId the slot ID that the action is bound to.
+   */
+  void addAction(Image::Idx const transition, uint32_t const slotId) const;
+
+  //! Add an output spec activating a local signal to a transition.
+  /*!
+   * \param transition the index of the transition.
+   * \param signal the index of the local signal.
+   */
+  void addOutput(Image::Idx const transition, Image::Idx const signal) const;
+
+  //! Add an output spec to a transition that is bound to a slot ID.
+  /*!
+   * \param transition the index of the transition.
+   * \param slotId the slot ID that the output spec is bound to.
+   */
+  void addBoundOutput(Image::Idx const transition, uint32_t const slotId) const;
+
+  //! Add a freeze flag to a transition.
+  /*!
+   * \param transition the index of the transition.
+   * \param freezeDepth the depth of freezing.
+   */
+  void addFreezeFlag(Image::Idx const transition, FreezeDepth const freezeDepth) const;
+
+  //! Add a max-1 flag to a transition.
+  /*!
+   * \param transition the index of the transition.
+   */
+  void addMax1Flag(Image::Idx const transition) const;
+
+  //! Add a completion flag to a transition.
+  /*!
+   * \param transition the index of the transition.
+   */
+  void addCompletionFlag(Image::Idx const transition) const;
+
+  //! Return the bytes of the image written so far.
+  /*!
+   * The bytes are validated just like on constructing an image from them.
+   */
+  vector<char> bytes() const;
+
+  //! Write the image written so far to a file.
+  /*!
+   * \param path the path of the file.
+   */
+  void write(char const * const path) const;
 };
 
-//! Output specs that can be added to transitions.
+//! Bindings of the slot IDs and type IDs of diagram images.
 /*!
- * An output spec is constructed from a reference to a const signal, or a function that returns
- * a reference to a const signal. An output spec is executed whenever the transition it belongs
- * to is executed. Its effect consists of activating the signal referred-to for the remainder of the macro step.
- * (Output specs might, thus, better be called activation specs. It is for historical reasons
- * that the term used is kept here.)
- *
- * At execution time, all output specs that have been added to a transition are executed. They may be
- * executed in any order. In particular, they may be executed in an order
- * that differs from the one in which they were added to the transition. It is recommended to
- * keep output spec functions free of visible side effects.
+ * Guard, action and output specs are bound to slot IDs, each kind of spec having slot IDs of its
+ * own. Data types are bound to type IDs, again with signals and variables having type IDs of their
+ * own. Binding an ID again replaces the previous binding.
  */
-class Output
+class ImageBindings
 :
-  public Transition::Spec
+  private PImpl<ImageBindingsImpl>
 {
-  friend class Transition;
-  friend class TriggerlessTransitionImpl;
-  friend class TriggeredTransitionImpl;
+  friend class ImageBindingsImpl;
+  friend class ImageTop;
+  friend class ImageTopImpl;
 
 public:
-  //! Vectors of const references to local signals.
-  using LocalEventVector = vector<reference_wrapper<LocalEvent const>>;
+  //! Construct bindings, with only the type ID of void signals being bound.
+  ImageBindings();
 
-  //! Construct a trigger-less output spec.
-  /*
-   * \param triggerlessOutput the signal to be activated.
+  //! Destruct bindings.
+  /*!
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  Output(LocalEvent const & triggerlessOutput);
+  ~ImageBindings();
 
-  //! Construct a trigger-less output spec.
+  //! Bind a guard spec to a slot ID.
   /*!
-   * \param triggerlessOutputs a vector of signals that are to be activated.
+   * \param slotId the slot ID.
+   * \param guard the guard spec.
    */
-  Output(LocalEventVector const & triggerlessOutputs);
+  void bind(uint32_t const slotId, Guard const & guard) const;
 
-  //! Construct a functional trigger-less output spec.
+  //! Bind an action spec to a slot ID.
   /*!
-   * \param triggerlessOutputFun a function returning the signal to be activated.
+   * \param slotId the slot ID.
+   * \param action the action spec.
    */
-  Output(function<LocalEvent const & ()> const & triggerlessOutputFun);
+  void bind(uint32_t const slotId, Action const & action) const;
 
-  //! Construct a functional trigger-less output spec.
+  //! Bind an output spec to a slot ID.
   /*!
-   * \param triggerlessOutputFun a function returning a vector of signals that are to be activated.
+   * \param slotId the slot ID.
+   * \param output the output spec.
    */
-  Output(function<LocalEventVector ()> const & triggerlessOutputsFun);
+  void bind(uint32_t const slotId, Output const & output) const;
 
-  //!Construct a functional triggered output spec.
+  //! Bind the data type of signals to a type ID.
   /*!
-   * \param triggeredOutput a trigger-dependent function returning the signal to be activated.
+   * \param Data the type of data to be carried as payload.
+   * \param RemainingData the types of remaining data to be carried as payload.
+   *
+   * \param typeId the type ID.
    */
-  Output(function<LocalEvent const & (Event const &)> const & triggeredOutput);
+  template<typename Data, typename... RemainingData>
+  void bindSignalType(uint32_t const typeId) const;
 
-  //!Construct a functional triggered output spec.
+  //! Bind the data type of variables to a type ID.
   /*!
-   * \param triggeredOutput a trigger-dependent function returning a vector of signals that are to be activated.
+   * Variables loaded from an image start out with a default constructed data value.
+   *
+   * \param Data the type of data to be carried as values.
+   *
+   * \param typeId the type ID.
    */
-  Output(function<LocalEventVector (Event const &)> const & triggeredOutputs);
+  template<typename Data>
+  void bindVarType(uint32_t const typeId) const;
 
 private:
-  TriggerlessOutput const triggerless;
-  TriggerlessOutputFun const triggerlessFun;
-  TriggeredOutput const triggered;
+  class SignalType
+  {
+  public:
+    PayloadTypeId payloadType;
+    size_t externalSize;
+    size_t externalAlignment;
+    ExternalEvent const * (* constructExternal)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Top const & parent);
+    void (* destructExternal)(void * const at);
+    size_t localSize;
+    size_t localAlignment;
+    LocalEvent const *
+      (* constructLocalInCompoundState)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+    LocalEvent const * (* constructLocalInRegion)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+    void (* destructLocal)(void * const at);
+  };
 
-  void join(Transition const * const) const override;
+  class VarType
+  {
+  public:
+    PayloadTypeId payloadType;
+    size_t externalSize;
+    size_t externalAlignment;
+    void (* constructExternal)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Top const & parent);
+    void (* destructExternal)(void * const at);
+    size_t localSize;
+    size_t localAlignment;
+    void (* constructLocalInCompoundState)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) CompoundState const & parent);
+    void (* constructLocalInRegion)(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Region const & parent);
+    void (* destructLocal)(void * const at);
+  };
+
+  template<typename Data, typename... RemainingData>
+  using SignalPayload = typename conditional<sizeof...(RemainingData) == 0, Data, Payload<Data, RemainingData...>>::type;
+
+  template<class Signal, class E, class Parent>
+  static
+  E const *
+  constructSignal(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & parent)
+  {
+    return new (at) Signal{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent};
+  }
+
+  template<class Var, typename Data, class Parent>
+  static
+  void
+  constructVar(void * const at, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Parent const & parent)
+  {
+    new (at) Var{STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, Data{}};
+  }
+
+  template<class Component>
+  static
+  void
+  destruct(void * const at)
+  {
+    static_cast<Component *>(at)->~Component();
+  }
+
+  void bind(uint32_t const typeId, SignalType const & signalType) const;
+  void bind(uint32_t const typeId, VarType const & varType) const;
 };
 
-//! Action specs that can be added to transitions.
+template<typename Data, typename... RemainingData>
+void
+ImageBindings
+::bindSignalType(uint32_t const typeId)
+const
+{
+  using External = ExternalSignal<Data, RemainingData...>;
+  using Local = LocalSignal<Data, RemainingData...>;
+  bind
+  (
+    typeId
+  , SignalType
+    {
+      &payloadTypeTag<SignalPayload<Data, RemainingData...>>
+    , sizeof(External)
+    , alignof(External)
+    , &constructSignal<External, ExternalEvent, Top>
+    , &destruct<External>
+    , sizeof(Local)
+    , alignof(Local)
+    , &constructSignal<Local, LocalEvent, CompoundState>
+    , &constructSignal<Local, LocalEvent, Region>
+    , &destruct<Local>
+    }
+  );
+}
+
+template<typename Data>
+void
+ImageBindings
+::bindVarType(uint32_t const typeId)
+const
+{
+  bind
+  (
+    typeId
+  , VarType
+    {
+      &payloadTypeTag<Data>
+    , sizeof(ExternalVar<Data>)
+    , alignof(ExternalVar<Data>)
+    , &constructVar<ExternalVar<Data>, Data, Top>
+    , &destruct<ExternalVar<Data>>
+    , sizeof(LocalVar<Data>)
+    , alignof(LocalVar<Data>)
+    , &constructVar<LocalVar<Data>, Data, CompoundState>
+    , &constructVar<LocalVar<Data>, Data, Region>
+    , &destruct<LocalVar<Data>>
+    }
+  );
+}
+
+//! Top states loaded from diagram images.
 /*!
- * At execution time, all action specs that have been added to a transition are executed. They may be
- * executed in any order. In particular, they may be executed in an order
- * that differs from the one in which they were added to the transition. It is recommended to
- * keep the visible effects actions may have independent of the order in which they are executed.
+ * Loading constructs the top state and all of its components and transitions in a single pass
+ * over the image, placing them into a single block of memory owned by the top state. The image
+ * and the bindings are no longer referred to once loading has completed.
+ *
+ * A loaded top state is used like any other top state, and machines may be created from it.
  */
-class Action
+class ImageTop
 :
-  public Transition::Spec
+  private PImpl<ImageTopImpl>
 {
-  friend class Transition;
-  friend class TriggerlessTransitionImpl;
-  friend class TriggeredTransitionImpl;
-
 public:
-  //! Construct a trigger-less action.
+  //! Load a top state from an image.
   /*!
-   * \param triggerlessAction a function to be executed.
+   * \param image the image.
+   * \param bindings the bindings of all slot IDs and type IDs used by the image.
    */
-  Action(function<void ()> const & triggerlessAction);
+  ImageTop(Image const & image, ImageBindings const & bindings);
 
-  //! Construct a triggered action.
+  //! Destruct loaded top state, along with all its components and transitions.
   /*!
-   * \param triggerlessAction a trigger-dependent function to be executed.
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  Action(function<void (Event const &)> const & triggeredAction);
+  ~ImageTop();
 
-private:
-  TriggerlessAction const triggerless;
-  TriggeredAction const triggered;
+  //! Return the top state.
+  Top const & top() const;
 
-  void join(Transition const * const) const override;
-};
+  //! Return a sub-state.
+  /*!
+   * \param idx the index of the sub-state within the image.
+   */
+  SubState const & subState(Image::Idx const idx) const;
 
-//! Trigger-less two-state transitions, called auto transitions.
-class Auto
-:
-  private virtual PImpl<AutoTransitionImpl>
-, public TriggerlessTransition
-, public ExternalTransition
-{
-public:
-  //! Construct a auto transition .
+  //! Return an external signal irrespective of the data type of its payload.
   /*!
-   * \param source the source state.
-   * \param source the target state.
+   * \param idx the index of the external signal within the image.
    */
-  Auto(SourceState const & source, TargetState const & target);
+  ExternalEvent const & externalEvent(Image::Idx const idx) const;
 
-  //! Construct a auto transition supplying specs.
+  //! Return an external signal.
   /*!
-   * \param source the source state.
-   * \param source the target state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * \param Data the type of data to be carried as payload.
+   * \param RemainingData the types of remaining data to be carried as payload.
+   *
+   * \param idx the index of the external signal within the image.
    */
-  template<class S, class... Ss>
-  Auto
-  (
-    SourceState const & source
-  , TargetState const & target
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  template<typename Data, typename... RemainingData>
+  ExternalSignal<Data, RemainingData...> & externalSignal(Image::Idx const idx) const;
 
-  //! Destruct auto transition.
+  //! Return an external variable.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param Data the type of data to be carried as values.
+   *
+   * \param idx the index of the external variable within the image.
    */
-  ~Auto();
+  template<typename Data>
+  ExternalVar<Data> & externalVar(Image::Idx const idx) const;
+
+  //! Return a local variable.
+  /*!
+   * \param Data the type of data to be carried as values.
+   *
+   * \param idx the index of the local variable within the image.
+   */
+  template<typename Data>
+  LocalVar<Data> & localVar(Image::Idx const idx) const;
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown whenever an image uses a slot ID or type ID that is not bound.
+  class UnboundError
+  :
+    public Error
+  {
+    friend class ImageTopImpl;
+
+  private:
+    UnboundError(string const & idKind, uint32_t const id);
+
+  public:
+    //! The kind of ID.
+    string const idKind;
+
+    //! The ID.
+    uint32_t const id;
+
+  private:
+    string specific() const override;
+  };
+#else
+  static int constexpr unboundError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  //! Error thrown whenever a component is retrieved as something it is not.
+  class ComponentError
+  :
+    public Error
+  {
+    friend class ImageTopImpl;
+
+  private:
+    ComponentError(Image::Idx const idx, string const & expected);
+
+  public:
+    //! The index of the component within the image.
+    Image::Idx const idx;
+
+    //! What the component has been expected to be.
+    string const expected;
+
+  private:
+    string specific() const override;
+  };
+#else
+  static int constexpr componentError{STATE_DIAGRAM_PER_COMPILATION_UNIQUE_ID};
+#endif // STATE_DIAGRAM_STRINGLESS
+
+private:
+  void * externalSignal(Image::Idx const idx, PayloadTypeId const payloadType) const;
+  void * externalVar(Image::Idx const idx, PayloadTypeId const payloadType) const;
+  void * localVar(Image::Idx const idx, PayloadTypeId const payloadType) const;
 };
 
-template<class S, class... Ss>
-Auto
-::Auto
-(
-  SourceState const & source
-, TargetState const & target
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  Auto(source, target, remainingSpecs...)
+template<typename Data, typename... RemainingData>
+ExternalSignal<Data, RemainingData...> &
+ImageTop
+::externalSignal(Image::Idx const idx)
+const
 {
-  add(forward<S>(firstSpec));
+  using Payload_ = typename conditional<sizeof...(RemainingData) == 0, Data, Payload<Data, RemainingData...>>::type;
+  return *static_cast<ExternalSignal<Data, RemainingData...> *>(externalSignal(idx, &payloadTypeTag<Payload_>));
 }
 
-//! Triggered two-state transitions, called step transitions.
-class Step
+template<typename Data>
+ExternalVar<Data> &
+ImageTop
+::externalVar(Image::Idx const idx)
+const
+{
+  return *static_cast<ExternalVar<Data> *>(externalVar(idx, &payloadTypeTag<Data>));
+}
+
+template<typename Data>
+LocalVar<Data> &
+ImageTop
+::localVar(Image::Idx const idx)
+const
+{
+  return *static_cast<LocalVar<Data> *>(localVar(idx, &payloadTypeTag<Data>));
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+//! Generators of C++ code that runs the diagrams of images without the engine.
+/*!
+ * The generated code is a header defining a class template of the given name, which takes a class
+ * of bindings as its parameter. Sub-states, regions and signals are enumerators, each region is a
+ * field holding its current sub-state, and stepping is a set of generated functions switching over
+ * the current sub-states, so no virtual function, implementation object or std::function is called.
+ * The enumerators have the indices of their components within the image as their values, with
+ * each default region taking the index of its parent state, or 0 for the top state.
+ *
+ * Macro steps and micro steps are executed just like by a top state loaded from the image that has
+ * Top::SchedulingPolicy::DECLARATION_ORDER and Top::RegionScheduling::RESCAN, including freeze
+ * flags, completion flags, max-1 flags and local signals. An instance of the class template offers
+ * init(), activate(Signal) and step(), which correspond to those of Top, and current(Region), which
+ * returns the current sub-state of a region.
+ *
+ * The bindings are passed on construction of an instance and are called with the slot IDs of the
+ * image, where Signal is the enumeration of signals of the instantiated class template:
+ *
+ * - bool guard(uint32_t slotId) and void action(uint32_t slotId) for triggerless transitions.
+ * - bool guard(uint32_t slotId, Signal trigger) and void action(uint32_t slotId, Signal trigger)
+ *   for triggered transitions.
+ *
+ * Variables, timer specs and bound output specs rest on the engine, so images using them are
+ * rejected. Payloads of signals are left to the bindings. Generating code does not repeat the checks
+ * carried out on loading an image, so an image is to be loaded as a top state to be known valid.
+ *
+ * Code generators are not available in stringless builds.
+ */
+class ImageCodeGenerator
 :
-  private virtual PImpl<StepTransitionImpl>
-, public TriggeredTransition
-, public ExternalTransition
+  private PImpl<ImageCodeGeneratorImpl>
 {
 public:
-  //! Construct a step transition.
+  //! Generate code for an image.
   /*!
-   * \param source the source state.
-   * \param target the target state.
+   * \param image the image.
+   * \param className the name of the generated class template.
    */
-  Step(SourceState const & source, TargetState const & target);
+  ImageCodeGenerator(Image const & image, string const & className);
 
-  //! Construct a step transition supplying specs.
+  //! Destruct code generator.
   /*!
-   * \param source the source state.
-   * \param source the target state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  template<class S, class... Ss>
-  Step
-  (
-    SourceState const & source
-  , TargetState const & target
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  ~ImageCodeGenerator();
 
-  //! Destruct step transition.
+  //! Return the generated code.
+  string const & code() const;
+
+  //! Write the generated code to a file.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param path the path of the file.
    */
-  ~Step();
-};
+  void write(char const * const path) const;
 
-template<class S, class... Ss>
-Step
-::Step
-(
-  SourceState const & source
-, TargetState const & target
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  Step(source, target, remainingSpecs...)
-{
-  add(forward<S>(firstSpec));
-}
+  //! Error thrown whenever an image uses what generated code does not support.
+  class UnsupportedError
+  :
+    public Error
+  {
+    friend class ImageCodeGeneratorImpl;
 
-//! Base class for boundary (enter- and exit-) transitions.
-class BoundaryTransition
-:
-  public TriggerlessTransition
-, public SingleStateTransition
-{
-protected:
-  BoundaryTransition(BoundaryTransitionImpl * const impl);
+  private:
+    UnsupportedError(string const & itemKind, Image::Idx const idx, string const & reason);
+
+  public:
+    //! The kind of item, which is either "component" or "transition".
+    string const itemKind;
+
+    //! The index of the item within the image.
+    Image::Idx const idx;
+
+    //! Why the item is not supported.
+    string const reason;
+
+  private:
+    string specific() const override;
+  };
 };
+#endif // STATE_DIAGRAM_STRINGLESS
 
-//! Enter transitions.
+#ifndef STATE_DIAGRAM_STRINGLESS
+//! Bindings of the names used by diagram texts, that is to say, a registry of C++ callables and data types.
 /*!
- * An enter transition is executed whenever the control flow enters the state hosting it.
+ * Guard, action and output specs are bound to names, each kind of spec having names of its own.
+ * Data types are bound to names, again with signals and variables having names of their own.
+ * Binding a name again replaces the previous binding.
+ *
+ * Text bindings are not available in stringless builds.
  */
-class Enter
+class TextBindings
 :
-  private virtual PImpl<EnterTransitionImpl>
-, public BoundaryTransition
+  private PImpl<TextBindingsImpl>
 {
+  friend class TextTop;
+
 public:
-  //! Construct an enter transition.
+  //! Construct bindings, with only the name "void" being bound to the signal type without payload.
+  TextBindings();
+
+  //! Destruct bindings.
   /*!
-   * \param state the host state.
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  Enter(State const & host);
+  ~TextBindings();
 
-  //! Construct an enter transition supplying specs.
+  //! Bind a guard spec to a name.
   /*!
-   * \param state the host state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * \param name the name.
+   * \param guard the guard spec.
    */
-  template<class S, class... Ss>
-  Enter
-  (
-    State const & host
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  void bind(string const & name, Guard const & guard) const;
 
-  //! Destruct enter transition.
+  //! Bind an action spec to a name.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param name the name.
+   * \param action the action spec.
    */
-  ~Enter();
-};
-
-template<class S, class... Ss>
-Enter
-::Enter
-(
-  State const & host
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  Enter(host, remainingSpecs...)
-{
-  add(forward<S>(firstSpec));
-}
+  void bind(string const & name, Action const & action) const;
 
-//! Exit transitions.
-/*!
- * An exit transition is executed whenever the control flow exits the state hosting it.
- */
-class Exit
-:
-  private virtual PImpl<ExitTransitionImpl>
-, public BoundaryTransition
-{
-public:
-  //! Construct an exit transition.
+  //! Bind an output spec to a name.
   /*!
-   * \param state the host state.
+   * \param name the name.
+   * \param output the output spec.
    */
-  Exit(State const & host);
+  void bind(string const & name, Output const & output) const;
 
-  //! Construct an exit transition supplying specs.
+  //! Bind the data type of signals to a name.
   /*!
-   * \param state the host state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * \param Data the type of data to be carried as payload.
+   * \param RemainingData the types of remaining data to be carried as payload.
+   *
+   * \param name the name.
    */
-  template<class S, class... Ss>
-  Exit
-  (
-    State const & host
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  template<typename Data, typename... RemainingData>
+  void bindSignalType(string const & name) const;
 
-  //! Destruct exit transition.
+  //! Bind the data type of variables to a name.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * Variables loaded from a text start out with a default constructed data value.
+   *
+   * \param Data the type of data to be carried as values.
+   *
+   * \param name the name.
    */
-  ~Exit();
+  template<typename Data>
+  void bindVarType(string const & name) const;
+
+private:
+  ImageBindings const & imageBindings() const;
+  uint32_t signalTypeId(string const & name) const;
+  uint32_t varTypeId(string const & name) const;
 };
 
-template<class S, class... Ss>
-Exit
-::Exit
-(
-  State const & host
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  Exit(host, remainingSpecs...)
+template<typename Data, typename... RemainingData>
+void
+TextBindings
+::bindSignalType(string const & name)
+const
 {
-  add(forward<S>(firstSpec));
+  imageBindings().bindSignalType<Data, RemainingData...>(signalTypeId(name));
 }
 
-//! Internal step transitions.
+template<typename Data>
+void
+TextBindings
+::bindVarType(string const & name)
+const
+{
+  imageBindings().bindVarType<Data>(varTypeId(name));
+}
+
+//! Top states loaded from diagram texts.
 /*!
- * An internal step transition can be executed whenever the control flow resides inside the state hosting it.
- * An internal step transition without any guards or without a max-1 flag leads to livelock once its trigger
- * signal is activated. To prevent this kind of livelock, internal step transitions
- * require one or more guards and/or a max-1 flag.
+ * A diagram text describes a state machine in JSON. The top state is an object, with the members below,
+ * all of which are optional except for the name:
+ *
+ * - "name": the name of the top state.
+ * - "signals": an array of signals, each being an object with a "name" and, unless it carries no payload,
+ *   a "type" naming a signal type bound in the text bindings.
+ * - "vars": an array of variables, each being an object with a "name" and a "type" naming a variable type
+ *   bound in the text bindings.
+ * - "states": an array of sub-states within the default region.
+ * - "regions": an array of regions, each being an object with a "name" and optional "signals", "vars",
+ *   "states" and "transitions".
+ * - "transitions": an array of transitions.
+ *
+ * Sub-states are objects with a "name" and an optional "kind", which is one of "state", the default,
+ * "init", "final" and "connector". Regular states have the same members as the top state. Signals and
+ * variables of the top state are external, those of regular states and regions are local.
+ *
+ * Transitions are objects with a "kind", which is one of "auto", "step", "enter", "exit", "internalStep"
+ * and "internalAuto". Auto and step transitions have a "source" and a "target", all other transitions have
+ * a "host". Their specs are added in the order of the following members:
+ *
+ * - "trigger": the name of a signal, or an array of them.
+ * - "after": a delay in nanoseconds.
+ * - "at": a time point in nanoseconds since the epoch of the steady clock.
+ * - "guard", "action" and "boundOutput": the name of a bound spec, or an array of them.
+ * - "output": the name of a local signal to be activated, or an array of them.
+ * - "freeze": either "full" or "shallow".
+ * - "max1" and "completion": true to add the flag.
+ *
+ * States, signals and variables are referred to by their paths relative to the state or region where they
+ * are referred to, or relative to any state or region enclosing it. A path joins names with dots, as in
+ * "busy.inner.waiting", with regions being part of the path.
+ *
+ * The text is translated into a diagram image, from which the top state is loaded, so all components and
+ * transitions are placed into a single block of memory owned by the top state.
+ *
+ * Loaded top states are not available in stringless builds.
  */
-class InternalStep
+class TextTop
 :
-  private virtual PImpl<InternalStepTransitionImpl>
-, public TriggeredTransition
-, public SingleStateTransition
+  private PImpl<TextTopImpl>
 {
 public:
-  //! Construct an internal step transition.
+  //! Load a top state from a diagram text.
   /*!
-   * \param host the host state.
+   * \param text the diagram text.
+   * \param bindings the bindings of all names of specs and types used by the text.
    */
-  InternalStep(State const & host);
+  TextTop(string const & text, TextBindings const & bindings);
 
-  //! Construct an internal step transition supplying specs
+  //! Destruct loaded top state, along with all its components and transitions.
   /*!
-   * \param host the host state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * The destructor is intended for RAII. It is not normally to be called explicitly.
    */
-  template<class S, class... Ss>
-  InternalStep
-  (
-    State const & host
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  ~TextTop();
 
-  //! Destruct internal step transition.
+  //! Return the top state.
+  Top const & top() const;
+
+  //! Return a sub-state.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param path the path of the sub-state, relative to the top state.
    */
-  ~InternalStep();
-};
+  SubState const & subState(string const & path) const;
 
-template<class S, class... Ss>
-InternalStep
-::InternalStep
-(
-  State const & host
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  InternalStep(host, remainingSpecs...)
-{
-  add(forward<S>(firstSpec));
-}
+  //! Return an external signal irrespective of the data type of its payload.
+  /*!
+   * \param name the name of the external signal.
+   */
+  ExternalEvent const & externalEvent(string const & name) const;
 
-//! Internal auto transitions.
-/*!
- * An internal auto transition can be executed whenever the control flow resides inside the state hosting it.
- * An internal auto transition without any guards or without a max-1 flag leads to livelock.
- * To prevent this kind of livelock, internal auto transitions
- * require one or more guards and/or a max-1 flag.
- */
-class InternalAuto
-:
-  private virtual PImpl<InternalAutoTransitionImpl>
-, public TriggerlessTransition
-, public SingleStateTransition
-{
-public:
-  //! Construct an internal auto transition.
+  //! Return an external signal.
   /*!
-   * \param host the host state.
+   * \param Data the type of data to be carried as payload.
+   * \param RemainingData the types of remaining data to be carried as payload.
+   *
+   * \param name the name of the external signal.
    */
-  InternalAuto(State const & host);
+  template<typename Data, typename... RemainingData>
+  ExternalSignal<Data, RemainingData...> & externalSignal(string const & name) const;
 
-  //! Construct an internal auto transition supplying specs
+  //! Return an external variable.
   /*!
-   * \param host the host state.
-   * \param firstSpec the first spec to be added to the transition on construction.
-   * \param remainingSpecs all the remaining specs to be added to the transition on construction.
+   * \param Data the type of data to be carried as values.
+   *
+   * \param name the name of the external variable.
    */
-  template<class S, class... Ss>
-  InternalAuto
-  (
-    State const & host
-  , S && firstSpec
-  , Ss &&... remainingSpecs
-  );
+  template<typename Data>
+  ExternalVar<Data> & externalVar(string const & name) const;
 
-  //! Destruct internal auto transition.
+  //! Return a local variable.
   /*!
-   * The destructor is intended for RAII. It is not normally to be called explicitly.
+   * \param Data the type of data to be carried as values.
+   *
+   * \param path the path of the local variable, relative to the top state.
    */
-  ~InternalAuto();
+  template<typename Data>
+  LocalVar<Data> & localVar(string const & path) const;
+
+  //! Error thrown whenever a diagram text is not well-formed JSON or does not describe a state machine.
+  class SyntaxError
+  :
+    public Error
+  {
+    friend class JsonDocument;
+    friend class TextTopImpl;
+
+  private:
+    SyntaxError(size_t const line, size_t const column, string const & reason);
+
+  public:
+    //! The line of the text where the error has been found, counting from 1.
+    size_t const line;
+
+    //! The column of the text where the error has been found, counting from 1.
+    size_t const column;
+
+    //! What is wrong.
+    string const reason;
+
+  private:
+    string specific() const override;
+  };
+
+  //! Error thrown whenever a name is neither declared in a diagram text nor bound in its text bindings.
+  class NameError
+  :
+    public Error
+  {
+    friend class TextTopImpl;
+
+  private:
+    NameError(string const & nameKind, string const & name);
+
+  public:
+    //! The kind of name.
+    string const nameKind;
+
+    //! The name.
+    string const name;
+
+  private:
+    string specific() const override;
+  };
+
+private:
+  ImageTop const & loaded() const;
+  Image::Idx idx(string const & nameKind, string const & path) const;
 };
 
-template<class S, class... Ss>
-InternalAuto
-::InternalAuto
-(
-  State const & host
-, S && firstSpec
-, Ss &&... remainingSpecs
-)
-:
-  InternalAuto(host, remainingSpecs...)
+template<typename Data, typename... RemainingData>
+ExternalSignal<Data, RemainingData...> &
+TextTop
+::externalSignal(string const & name)
+const
 {
-  add(forward<S>(firstSpec));
+  return loaded().externalSignal<Data, RemainingData...>(idx("signal", name));
+}
+
+template<typename Data>
+ExternalVar<Data> &
+TextTop
+::externalVar(string const & name)
+const
+{
+  return loaded().externalVar<Data>(idx("variable", name));
+}
+
+template<typename Data>
+LocalVar<Data> &
+TextTop
+::localVar(string const & path)
+const
+{
+  return loaded().localVar<Data>(idx("variable", path));
 }
+#endif // STATE_DIAGRAM_STRINGLESS
 
 //! Macro to abbreviate type state_diagram::Output::LocalEventVector.
 #define FSM_LEV state_diagram::Output::LocalEventVector
@@ -3781,6 +6401,26 @@ InternalAuto
 #define FSM_LOCAL_ARRAY(type, name, capacity, ...) state_diagram::LocalArray<type, capacity> name{__VA_ARGS__}
 #endif // STATE_DIAGRAM_STRINGLESS
 
+//! Macro to construct a dense array of external variables.
+/*!
+ * The string name of the dense array is identical to its programmatic name.
+ */
+#ifndef STATE_DIAGRAM_STRINGLESS
+#define FSM_DENSE_ARRAY(type, name, size, parent, ...) state_diagram::ExternalDenseArray<type, size> name{#name, parent __VA_OPT__(,) __VA_ARGS__}
+#else
+#define FSM_DENSE_ARRAY(type, name, size, parent, ...) state_diagram::ExternalDenseArray<type, size> name{parent __VA_OPT__(,) __VA_ARGS__}
+#endif // STATE_DIAGRAM_STRINGLESS
+
+//! Macro to construct a dense array of local variables.
+/*!
+ * The string name of the dense array is identical to its programmatic name.
+ */
+#ifndef STATE_DIAGRAM_STRINGLESS
+#define FSM_LOCAL_DENSE_ARRAY(type, name, capacity, ...) state_diagram::LocalDenseArray<type, capacity> name{#name __VA_OPT__(,) __VA_ARGS__}
+#else
+#define FSM_LOCAL_DENSE_ARRAY(type, name, capacity, ...) state_diagram::LocalDenseArray<type, capacity> name{__VA_ARGS__}
+#endif // STATE_DIAGRAM_STRINGLESS
+
 //! Macro to construct an auto transition.
 /*!
  * The auto transition's programmatic name is derived from the programmatic names of its source and target.
@@ -19,7 +19,14 @@
 
 #include "state_diagram_error.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 #ifndef STATE_DIAGRAM_STRINGLESS
 # define STATE_DIAGRAM_STRING_PARAM(PARAM) string const & PARAM
@@ -38,6 +45,87 @@ namespace state_diagram
 
 using namespace std;
 
+void * allocateComponent(size_t const size, size_t const alignment);
+void releaseComponent(void * const component);
+
+template<class Impl, class... Args>
+Impl *
+makeComponent(Args &&... args)
+{
+  void * const memory{allocateComponent(sizeof(Impl), alignof(Impl))};
+  try
+  {
+    return new (memory) Impl{forward<Args>(args)...};
+  }
+  catch (...)
+  {
+    releaseComponent(memory);
+    throw;
+  }
+}
+
+template<class Impl>
+void
+deleteComponent(Impl * const impl)
+{
+  if (impl == nullptr)
+  {
+    return;
+  }
+  impl->~Impl();
+  releaseComponent(impl);
+}
+
+template<typename Item>
+class ComponentAllocator
+{
+public:
+  using value_type = Item;
+
+  ComponentAllocator() = default;
+
+  template<typename OtherItem>
+  ComponentAllocator(ComponentAllocator<OtherItem> const &)
+  {
+    // This space intentionally left empty
+  }
+
+  Item *
+  allocate(size_t const n)
+  {
+    return static_cast<Item *>(allocateComponent(n * sizeof(Item), alignof(Item)));
+  }
+
+  void
+  deallocate(Item * const items, size_t const)
+  {
+    releaseComponent(items);
+  }
+
+  template<typename OtherItem>
+  bool
+  operator==(ComponentAllocator<OtherItem> const &)
+  const
+  {
+    return true;
+  }
+
+  template<typename OtherItem>
+  bool
+  operator!=(ComponentAllocator<OtherItem> const &)
+  const
+  {
+    return false;
+  }
+};
+
+template<class Sharable, class... Args>
+shared_ptr<Sharable>
+makeSharedComponent(Args &&... args)
+{
+  return allocate_shared<Sharable>(ComponentAllocator<Sharable>{}, forward<Args>(args)...);
+}
+
 template<class Impl>
 class PImplUpcast
 {
@@ -71,7 +159,7 @@ protected:
   template<class... Args>
   PImpl(Args... args)
   :
-    m_impl{new Impl{args...}}
+    m_impl{makeComponent<Impl>(args...)}
   {
     if (m_impl == nullptr)
     {
@@ -94,6 +182,7 @@ protected:
   void operator=(PImpl const &) = delete;
 };
 
+class Arena;
 class AutoTransitionImpl;
 class BoundaryTransitionImpl;
 class CompoundStateImpl;
@@ -104,12 +193,19 @@ class ExitTransitionImpl;
 class ExternalSignalDelegateImpl;
 class ExternalVarDelegateImpl;
 class FinalStateImpl;
+class ImageBindingsImpl;
+class ImageCodeGeneratorImpl;
+class ImageImpl;
+class ImageTopImpl;
+class ImageWriterImpl;
 class InitStateImpl;
 class InternalAutoTransitionImpl;
 class InternalStepTransitionImpl;
 class InternalVarDelegateImpl;
 class LocalSignalDelegateImpl;
 class LocalVarDelegateImpl;
+class MachineImpl;
+class MachinePoolImpl;
 class NamePathImpl;
 class RegionImpl;
 class SignalDelegateImpl;
@@ -119,19 +215,133 @@ class StateImpl;
 class StepTransitionImpl;
 class SubStateImpl;
 class TargetStateImpl;
+class TextBindingsImpl;
+class TextTopImpl;
 class TopStateImpl;
 class TransitionImpl;
 class TriggeredTransitionImpl;
 class TriggerlessTransitionImpl;
 class VarDelegateImpl;
 
-class TriggerlessGuardSharable;
+class Event;
+
+// Payload types are identified by the addresses of these tags, so checking them requires no RTTI.
+template<typename Data>
+inline char const payloadTypeTag{};
+
+using PayloadTypeId = void const *;
+
+// Spec functions are invoked through a single function pointer that is generated for the concrete type of the
+// callable, which is held in place rather than behind another indirection.
+template<typename Signature>
+class SpecFunction;
+
+template<typename Result, typename... Params>
+class SpecFunction<Result (Params...)>
+{
+protected:
+  using Invocation = Result (*)(SpecFunction const * const, Params...);
+
+  SpecFunction(Invocation const invocation)
+  :
+    m_invocation{invocation}
+  {
+    // This space intentionally left empty
+  }
+
+public:
+  SpecFunction(SpecFunction const &) = delete;
+
+  void operator=(SpecFunction const &) = delete;
+
+  Result
+  operator()(Params... params)
+  const
+  {
+    return m_invocation(this, forward<Params>(params)...);
+  }
+
+private:
+  Invocation const m_invocation;
+};
+
+template<typename Signature, class Callable>
+class ConcreteSpecFunction;
+
+template<typename Result, typename... Params, class Callable>
+class ConcreteSpecFunction<Result (Params...), Callable>
+:
+  public SpecFunction<Result (Params...)>
+{
+public:
+  ConcreteSpecFunction(Callable const & callable)
+  :
+    SpecFunction<Result (Params...)>{&invoke}
+  , m_callable{callable}
+  {
+    // This space intentionally left empty
+  }
+
+private:
+  static
+  Result
+  invoke(SpecFunction<Result (Params...)> const * const specFunction, Params... params)
+  {
+    auto & callable{static_cast<ConcreteSpecFunction const *>(specFunction)->m_callable};
+    if constexpr (is_void_v<Result>)
+    {
+      callable(forward<Params>(params)...);
+    }
+    else
+    {
+      return callable(forward<Params>(params)...);
+    }
+  }
+
+  // Callables are invoked the way std::function invokes them, which admits mutable lambdas.
+  mutable Callable m_callable;
+};
+
+template<class Callable>
+class TriggerIgnoring
+{
+public:
+  TriggerIgnoring(Callable const & callable)
+  :
+    m_callable{callable}
+  {
+    // This space intentionally left empty
+  }
+
+  template<typename... Params>
+  decltype(auto)
+  operator()(Event const &, Params &&... params)
+  {
+    return m_callable(forward<Params>(params)...);
+  }
+
+private:
+  Callable m_callable;
+};
+
+template<typename Signature, class Callable>
+shared_ptr<SpecFunction<Signature> const>
+makeSpecFunction(Callable const & callable)
+{
+  return makeSharedComponent<ConcreteSpecFunction<Signature, decay_t<Callable>>>(callable);
+}
+
+using TriggerlessGuardSharable = SpecFunction<bool ()>;
+using TriggerlessActionSharable = SpecFunction<void ()>;
+using TriggeredGuardSharable = SpecFunction<bool (Event const &)>;
+using TriggeredActionSharable = SpecFunction<void (Event const &)>;
+
+class OutputEmitter;
+
+using TriggerlessOutputFunSharable = SpecFunction<void (OutputEmitter const &)>;
+using TriggeredOutputSharable = SpecFunction<void (Event const &, OutputEmitter const &)>;
+
 class TriggerlessOutputSharable;
-class TriggerlessActionSharable;
-class TriggerlessOutputFunSharable;
-class TriggeredGuardSharable;
-class TriggeredOutputSharable;
-class TriggeredActionSharable;
 
 using TriggerlessGuard = shared_ptr<TriggerlessGuardSharable const>;
 using TriggerlessOutput = shared_ptr<TriggerlessOutputSharable const>;
@@ -141,6 +351,102 @@ using TriggeredGuard = shared_ptr<TriggeredGuardSharable const>;
 using TriggeredOutput = shared_ptr<TriggeredOutputSharable const>;
 using TriggeredAction = shared_ptr<TriggeredActionSharable const>;
 
+// Flags of the elements of dense arrays, packed into words so that ranges of them can be checked and updated a word at
+// a time.
+template<size_t nrOfBits>
+class BitSet
+{
+public:
+  bool
+  test(size_t const idx)
+  const
+  {
+    return (m_words[idx / bitsPerWord] & (uint64_t{1} << (idx % bitsPerWord))) != 0;
+  }
+
+  void
+  set(size_t const idx)
+  {
+    m_words[idx / bitsPerWord] |= uint64_t{1} << (idx % bitsPerWord);
+  }
+
+  void
+  set(size_t const first, size_t const count)
+  {
+    forEachWord(first, count, [this](size_t const wordIdx, uint64_t const mask){m_words[wordIdx] |= mask;});
+  }
+
+  void
+  reset()
+  {
+    fill(begin(m_words), end(m_words), uint64_t{0});
+  }
+
+  bool
+  all(size_t const first, size_t const count)
+  const
+  {
+    bool all{true};
+    forEachWord(first, count, [&](size_t const wordIdx, uint64_t const mask){all &= (m_words[wordIdx] & mask) == mask;});
+    return all;
+  }
+
+  bool
+  none(size_t const first, size_t const count)
+  const
+  {
+    bool none{true};
+    forEachWord(first, count, [&](size_t const wordIdx, uint64_t const mask){none &= (m_words[wordIdx] & mask) == 0;});
+    return none;
+  }
+
+  BitSet &
+  operator|=(BitSet const & other)
+  {
+    for (size_t wordIdx{0}; wordIdx < nrOfWords; ++wordIdx)
+    {
+      m_words[wordIdx] |= other.m_words[wordIdx];
+    }
+    return *this;
+  }
+
+  template<class Visit>
+  void
+  forEachSet(Visit && visit)
+  const
+  {
+    for (size_t wordIdx{0}; wordIdx < nrOfWords; ++wordIdx)
+    {
+      for (uint64_t word{m_words[wordIdx]}; word != 0; word &= word - 1)
+      {
+        visit(wordIdx * bitsPerWord + static_cast<size_t>(countr_zero(word)));
+      }
+    }
+  }
+
+private:
+  static size_t constexpr bitsPerWord{64};
+  static size_t constexpr nrOfWords{(nrOfBits + bitsPerWord - 1) / bitsPerWord};
+
+  template<class Visit>
+  static
+  void
+  forEachWord(size_t first, size_t const count, Visit && visit)
+  {
+    size_t const last{first + count};
+    while (first < last)
+    {
+      size_t const bitIdx{first % bitsPerWord};
+      size_t const nrOfBitsInWord{min(bitsPerWord - bitIdx, last - first)};
+      uint64_t const mask{(nrOfBitsInWord == bitsPerWord) ? ~uint64_t{0} : (((uint64_t{1} << nrOfBitsInWord) - 1) << bitIdx)};
+      visit(first / bitsPerWord, mask);
+      first += nrOfBitsInWord;
+    }
+  }
+
+  uint64_t m_words[nrOfWords]{};
+};
+
 } // namespace state_diagram
 
 #endif // STATE_DIAGRAM_INTERNAL_H_
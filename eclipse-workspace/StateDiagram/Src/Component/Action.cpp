@@ -18,29 +18,10 @@
 
 #include "Impl/TriggerlessTransitionImpl.h"
 #include "Impl/TriggeredTransitionImpl.h"
-#include "Impl/Spec_all.h"
 
 namespace state_diagram
 {
 
-Action
-::Action(function<void ()> const & triggerlessAction)
-:
-  triggerless{make_shared<TriggerlessActionSharable>(triggerlessAction)}
-, triggered{make_shared<TriggeredActionSharable>([=](Event const &){triggerlessAction();})}
-{
-  // This space intentionally left empty
-}
-
-Action
-::Action(function<void (Event const &)> const & triggeredAction)
-:
-  triggerless{nullptr}
-, triggered{make_shared<TriggeredActionSharable>(triggeredAction)}
-{
-  // This space intentionally left empty
-}
-
 void
 Action
 ::join(Transition const * const transition)
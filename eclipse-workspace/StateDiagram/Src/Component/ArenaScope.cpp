@@ -14,22 +14,27 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/Arena.h"
+#include "Impl/TopStateImpl.h"
 
 namespace state_diagram
 {
 
-UnwindCmd
-StackSeq::Construct
-::accept
-(
-  function<UnwindCmd (StackSeq::Construct const * const)> const onConstruct
-, function<UnwindCmd (StackSeq::Unwind const * const)> const
-)
-const
+ArenaScope
+::ArenaScope(Top const & top)
+:
+  m_enclosing{Arena::current}
 {
-  return onConstruct(this);
+  Arena::current = top.m_impl->arena;
 }
 
-} // namespace state_diagram
+ArenaScope
+::~ArenaScope()
+{
+  Arena::current = m_enclosing;
+}
 
+} // namespace state_diagram
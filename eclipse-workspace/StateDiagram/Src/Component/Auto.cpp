@@ -35,7 +35,7 @@ Auto
 Auto
 ::~Auto()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
@@ -48,7 +48,7 @@ Connector
 Connector
 ::~Connector()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 bool
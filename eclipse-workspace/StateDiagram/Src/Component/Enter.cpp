@@ -34,7 +34,7 @@ Enter
 Enter
 ::~Enter()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
@@ -19,10 +19,29 @@
 namespace state_diagram
 {
 
+Event
+::Event()
+:
+  m_payloadTypeId{nullptr}
+, m_signal{nullptr}
+, m_payload{nullptr}
+{
+  // This space intentionally left empty
+}
+
 Event
 ::~Event()
 {
   // This space intentionally left empty
 }
 
+void
+Event
+::bindPayload(PayloadTypeId const payloadTypeId, void * const signal, void * const payload)
+{
+  m_payloadTypeId = payloadTypeId;
+  m_signal = signal;
+  m_payload = payload;
+}
+
 }
@@ -34,7 +34,7 @@ Exit
 Exit
 ::~Exit()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
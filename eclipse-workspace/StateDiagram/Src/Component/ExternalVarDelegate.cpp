@@ -33,7 +33,7 @@ ExternalVarDelegate
 ExternalVarDelegate
 ::~ExternalVarDelegate()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
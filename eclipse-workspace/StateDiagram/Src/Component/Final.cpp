@@ -46,7 +46,7 @@ Final
 Final
 ::~Final()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 string const
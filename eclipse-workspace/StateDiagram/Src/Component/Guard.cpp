@@ -18,29 +18,10 @@
 
 #include "Impl/TriggerlessTransitionImpl.h"
 #include "Impl/TriggeredTransitionImpl.h"
-#include "Impl/Spec_all.h"
 
 namespace state_diagram
 {
 
-Guard
-::Guard(function<bool ()> const & triggerlessGuard)
-:
-  triggerless{make_shared<TriggerlessGuardSharable>(triggerlessGuard)}
-, triggered{make_shared<TriggeredGuardSharable>([=](Event const &){return triggerlessGuard();})}
-{
-  // This space intentionally left empty
-}
-
-Guard
-::Guard(function<bool (Event const &)> const & triggeredGuard)
-:
-  triggerless{nullptr}
-, triggered{make_shared<TriggeredGuardSharable>(triggeredGuard)}
-{
-  // This space intentionally left empty
-}
-
 void
 Guard
 ::join(Transition const * const transition)
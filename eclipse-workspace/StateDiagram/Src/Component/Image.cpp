@@ -14,44 +14,57 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
+#include "state_diagram/state_diagram.h"
 
-#include "../RegionImpl.h"
+#include "Impl/ImageImpl.h"
 
 namespace state_diagram
 {
 
-StackSeq::Construct::Continue
-::Continue
-(
-  RegionImpl * const _subjectRegion
-, StackSeq::Construct const * const _next
-)
+Image
+::Image(char const * const path)
 :
-  subjectRegion{_subjectRegion}
-, next{_next}
+  PImpl<ImageImpl>{path}
 {
   // This space intentionally left empty
 }
 
-void
-StackSeq::Construct::Continue
-::accept
-(
-  function<void (StackSeq::Construct::Continue const * const)> const onContinue
-, function<void (StackSeq::Construct::Halt const * const)> const
-)
+Image
+::Image(void const * const bytes, size_t const size)
+:
+  PImpl<ImageImpl>{bytes, size}
+{
+  // This space intentionally left empty
+}
+
+Image
+::~Image()
+{
+  deleteComponent(m_impl);
+}
+
+size_t
+Image
+::size()
+const
+{
+  return m_impl->size();
+}
+
+size_t
+Image
+::nrOfComponents()
 const
 {
-  onContinue(this);
+  return m_impl->header().components.count;
 }
 
-void
-StackSeq::Construct::Continue
-::exec()
+size_t
+Image
+::nrOfTransitions()
 const
 {
-  subjectRegion->descendToTarget(next.get());
+  return m_impl->header().transitions.count;
 }
 
 } // namespace state_diagram
@@ -0,0 +1,78 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/ImageBindingsImpl.h"
+
+namespace state_diagram
+{
+
+ImageBindings
+::ImageBindings()
+:
+  PImpl<ImageBindingsImpl>{}
+{
+  bindSignalType<void>(Image::voidTypeId);
+}
+
+ImageBindings
+::~ImageBindings()
+{
+  deleteComponent(m_impl);
+}
+
+void
+ImageBindings
+::bind(uint32_t const slotId, Guard const & guard)
+const
+{
+  m_impl->bind(slotId, guard);
+}
+
+void
+ImageBindings
+::bind(uint32_t const slotId, Action const & action)
+const
+{
+  m_impl->bind(slotId, action);
+}
+
+void
+ImageBindings
+::bind(uint32_t const slotId, Output const & output)
+const
+{
+  m_impl->bind(slotId, output);
+}
+
+void
+ImageBindings
+::bind(uint32_t const typeId, SignalType const & signalType)
+const
+{
+  m_impl->bind(typeId, signalType);
+}
+
+void
+ImageBindings
+::bind(uint32_t const typeId, VarType const & varType)
+const
+{
+  m_impl->bind(typeId, varType);
+}
+
+} // namespace state_diagram
@@ -0,0 +1,57 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "Impl/ImageCodeGeneratorImpl.h"
+
+namespace state_diagram
+{
+
+ImageCodeGenerator
+::ImageCodeGenerator(Image const & image, string const & className)
+:
+  PImpl<ImageCodeGeneratorImpl>{static_cast<ImageImpl const *>(image.m_impl), className}
+{
+  // This space intentionally left empty
+}
+
+ImageCodeGenerator
+::~ImageCodeGenerator()
+{
+  deleteComponent(m_impl);
+}
+
+string const &
+ImageCodeGenerator
+::code()
+const
+{
+  return m_impl->code();
+}
+
+void
+ImageCodeGenerator
+::write(char const * const path)
+const
+{
+  m_impl->write(path);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
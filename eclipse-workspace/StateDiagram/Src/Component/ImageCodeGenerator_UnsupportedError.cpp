@@ -0,0 +1,52 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include <cctype>
+
+namespace state_diagram
+{
+
+ImageCodeGenerator::UnsupportedError
+::UnsupportedError(string const & _itemKind, Image::Idx const _idx, string const & _reason)
+:
+  itemKind{_itemKind}
+, idx{_idx}
+, reason{_reason}
+{
+  // This space intentionally left empty
+}
+
+string
+ImageCodeGenerator::UnsupportedError
+::specific()
+const
+{
+  string capitalizedItemKind{itemKind};
+  if (!capitalizedItemKind.empty())
+  {
+    capitalizedItemKind[0] = static_cast<char>(toupper(static_cast<unsigned char>(capitalizedItemKind[0])));
+  }
+  return
+    capitalizedItemKind + " " + to_string(idx) + " of diagram image is not supported by generated code: "
+    + reason + ".";
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
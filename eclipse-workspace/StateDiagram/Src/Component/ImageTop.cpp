@@ -0,0 +1,88 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/ImageTopImpl.h"
+
+namespace state_diagram
+{
+
+ImageTop
+::ImageTop(Image const & image, ImageBindings const & bindings)
+:
+  PImpl<ImageTopImpl>{static_cast<ImageImpl const *>(image.m_impl), static_cast<ImageBindingsImpl const *>(bindings.m_impl)}
+{
+  // This space intentionally left empty
+}
+
+ImageTop
+::~ImageTop()
+{
+  deleteComponent(m_impl);
+}
+
+Top const &
+ImageTop
+::top()
+const
+{
+  return m_impl->top();
+}
+
+SubState const &
+ImageTop
+::subState(Image::Idx const idx)
+const
+{
+  return m_impl->subState(idx);
+}
+
+ExternalEvent const &
+ImageTop
+::externalEvent(Image::Idx const idx)
+const
+{
+  return m_impl->externalEvent(idx);
+}
+
+void *
+ImageTop
+::externalSignal(Image::Idx const idx, PayloadTypeId const payloadType)
+const
+{
+  return
+    m_impl->component(idx, ImageFormat::ComponentKind::EXTERNAL_SIGNAL, payloadType, "an external signal of the requested type");
+}
+
+void *
+ImageTop
+::externalVar(Image::Idx const idx, PayloadTypeId const payloadType)
+const
+{
+  return
+    m_impl->component(idx, ImageFormat::ComponentKind::EXTERNAL_VAR, payloadType, "an external variable of the requested type");
+}
+
+void *
+ImageTop
+::localVar(Image::Idx const idx, PayloadTypeId const payloadType)
+const
+{
+  return m_impl->component(idx, ImageFormat::ComponentKind::LOCAL_VAR, payloadType, "a local variable of the requested type");
+}
+
+} // namespace state_diagram
@@ -14,40 +14,30 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
+#include "state_diagram/state_diagram.h"
 
-#include "../TargetStateImpl.h"
+#ifndef STATE_DIAGRAM_STRINGLESS
 
 namespace state_diagram
 {
 
-StackSeq::Construct::Halt
-::Halt(TargetStateImpl * const _target)
+ImageTop::ComponentError
+::ComponentError(Image::Idx const _idx, string const & _expected)
 :
-  target{_target}
+  idx{_idx}
+, expected{_expected}
 {
   // This space intentionally left empty
 }
 
-void
-StackSeq::Construct::Halt
-::accept
-(
-  function<void (StackSeq::Construct::Continue const * const)> const
-, function<void (StackSeq::Construct::Halt const * const)> const onHalt
-)
+string
+ImageTop::ComponentError
+::specific()
 const
 {
-  onHalt(this);
-}
-
-void
-StackSeq::Construct::Halt
-::exec()
-const
-{
-  target->becomeCurrent();
+  return "Component " + to_string(idx) + " of diagram image is not " + expected + ".";
 }
 
 } // namespace state_diagram
 
+#endif // STATE_DIAGRAM_STRINGLESS
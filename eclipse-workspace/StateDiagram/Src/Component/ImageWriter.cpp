@@ -0,0 +1,255 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/ImageWriterImpl.h"
+
+namespace state_diagram
+{
+
+ImageWriter
+::ImageWriter(STATE_DIAGRAM_STRING_PARAM(topName))
+:
+  PImpl<ImageWriterImpl>{STATE_DIAGRAM_STRING_ARG(topName)}
+{
+  // This space intentionally left empty
+}
+
+ImageWriter
+::~ImageWriter()
+{
+  deleteComponent(m_impl);
+}
+
+Image::Idx
+ImageWriter
+::addRegion(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::REGION, STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, 0);
+}
+
+Image::Idx
+ImageWriter
+::addInit(Image::Idx const parent)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::INIT, STATE_DIAGRAM_STRING_ARG_COMMA("") parent, 0);
+}
+
+Image::Idx
+ImageWriter
+::addFinal(Image::Idx const parent)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::FINAL, STATE_DIAGRAM_STRING_ARG_COMMA("") parent, 0);
+}
+
+Image::Idx
+ImageWriter
+::addState(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::STATE, STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, 0);
+}
+
+Image::Idx
+ImageWriter
+::addConnector(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::CONNECTOR, STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, 0);
+}
+
+Image::Idx
+ImageWriter
+::addExternalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) uint32_t const typeId)
+const
+{
+  return
+    m_impl->addComponent(ImageFormat::ComponentKind::EXTERNAL_SIGNAL, STATE_DIAGRAM_STRING_ARG_COMMA(name) Image::topIdx, typeId);
+}
+
+Image::Idx
+ImageWriter
+::addLocalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent, uint32_t const typeId)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::LOCAL_SIGNAL, STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, typeId);
+}
+
+Image::Idx
+ImageWriter
+::addExternalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) uint32_t const typeId)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::EXTERNAL_VAR, STATE_DIAGRAM_STRING_ARG_COMMA(name) Image::topIdx, typeId);
+}
+
+Image::Idx
+ImageWriter
+::addLocalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent, uint32_t const typeId)
+const
+{
+  return m_impl->addComponent(ImageFormat::ComponentKind::LOCAL_VAR, STATE_DIAGRAM_STRING_ARG_COMMA(name) parent, typeId);
+}
+
+Image::Idx
+ImageWriter
+::addAuto(Image::Idx const source, Image::Idx const target)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::AUTO, source, target);
+}
+
+Image::Idx
+ImageWriter
+::addStep(Image::Idx const source, Image::Idx const target)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::STEP, source, target);
+}
+
+Image::Idx
+ImageWriter
+::addEnter(Image::Idx const host)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::ENTER, host, host);
+}
+
+Image::Idx
+ImageWriter
+::addExit(Image::Idx const host)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::EXIT, host, host);
+}
+
+Image::Idx
+ImageWriter
+::addInternalStep(Image::Idx const host)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::INTERNAL_STEP, host, host);
+}
+
+Image::Idx
+ImageWriter
+::addInternalAuto(Image::Idx const host)
+const
+{
+  return m_impl->addTransition(ImageFormat::TransitionKind::INTERNAL_AUTO, host, host);
+}
+
+void
+ImageWriter
+::addTrigger(Image::Idx const transition, Image::Idx const signal)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::TRIGGER, signal, 0);
+}
+
+void
+ImageWriter
+::addAfter(Image::Idx const transition, Top::Duration const delay)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::AFTER, 0, delay.count());
+}
+
+void
+ImageWriter
+::addAt(Image::Idx const transition, Top::TimePoint const deadline)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::AT, 0, deadline.time_since_epoch().count());
+}
+
+void
+ImageWriter
+::addGuard(Image::Idx const transition, uint32_t const slotId)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::GUARD, slotId, 0);
+}
+
+void
+ImageWriter
+::addAction(Image::Idx const transition, uint32_t const slotId)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::ACTION, slotId, 0);
+}
+
+void
+ImageWriter
+::addOutput(Image::Idx const transition, Image::Idx const signal)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::OUTPUT, signal, 0);
+}
+
+void
+ImageWriter
+::addBoundOutput(Image::Idx const transition, uint32_t const slotId)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::BOUND_OUTPUT, slotId, 0);
+}
+
+void
+ImageWriter
+::addFreezeFlag(Image::Idx const transition, FreezeDepth const freezeDepth)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::FREEZE_FLAG, static_cast<uint32_t>(freezeDepth), 0);
+}
+
+void
+ImageWriter
+::addMax1Flag(Image::Idx const transition)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::MAX1_FLAG, 0, 0);
+}
+
+void
+ImageWriter
+::addCompletionFlag(Image::Idx const transition)
+const
+{
+  m_impl->addSpec(transition, ImageFormat::SpecKind::COMPLETION_FLAG, 0, 0);
+}
+
+vector<char>
+ImageWriter
+::bytes()
+const
+{
+  return m_impl->bytes();
+}
+
+void
+ImageWriter
+::write(char const * const path)
+const
+{
+  m_impl->write(path);
+}
+
+} // namespace state_diagram
@@ -16,28 +16,27 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "StackSeq_all.h"
+#ifndef STATE_DIAGRAM_STRINGLESS
 
 namespace state_diagram
 {
 
-StackSeq::Unwind::Void
-StackSeq::Unwind::Void
-::instance
+Image::FileError
+::FileError(string const & _path)
+:
+  path{_path}
 {
   // This space intentionally left empty
-};
-
-UnwindCmd
-StackSeq::Unwind::Void
-::accept
-(
-  function<UnwindCmd ()> const onVoid
-, function<UnwindCmd (StackSeq::Unwind::Do const * const)>
-)
+}
+
+string
+Image::FileError
+::specific()
 const
 {
-  return onVoid();
+  return "Cannot map or write diagram image file \"" + path + "\".";
 }
 
 } // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
@@ -14,29 +14,29 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
 
 namespace state_diagram
 {
 
-StackSeq::Unwind::Do
-::Do(TargetStateImpl * const _target)
+Image::FormatError
+::FormatError(string const & _reason)
 :
-  target{_target}
+  reason{_reason}
 {
   // This space intentionally left empty
 }
 
-UnwindCmd
-StackSeq::Unwind::Do
-::accept
-(
-  function<UnwindCmd ()> const
-, function<UnwindCmd (StackSeq::Unwind::Do const * const)> const onDo
-)
+string
+Image::FormatError
+::specific()
 const
 {
-  return onDo(this);
+  return "Malformed diagram image, as " + reason + ".";
 }
 
 } // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
@@ -0,0 +1,123 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "Arena.h"
+
+#include <cstdint>
+
+namespace state_diagram
+{
+
+namespace
+{
+  size_t constexpr initialSlabSize{size_t{1} << 16};
+  size_t constexpr maxSlabSize{size_t{1} << 20};
+
+  // Every component is preceded by a header telling where it has been allocated from, so that releasing it needs
+  // neither a lookup nor the arena itself, which may be gone by then.
+  class Header
+  {
+  public:
+    Arena * arena;
+    size_t alignment;
+  };
+
+  size_t
+  headerSpace(size_t const alignment)
+  {
+    return (sizeof(Header) + alignment - 1) / alignment * alignment;
+  }
+
+  Header *
+  headerOf(void * const component)
+  {
+    return static_cast<Header *>(component) - 1;
+  }
+}
+
+thread_local Arena * Arena::current{nullptr};
+
+Arena
+::Arena()
+:
+  m_slabs{}
+, m_cursor{nullptr}
+, m_end{nullptr}
+, m_nextSlabSize{initialSlabSize}
+{
+  // This space intentionally left empty
+}
+
+void *
+Arena
+::allocate(size_t const size, size_t const alignment)
+{
+  auto const place
+  {
+    [&]()->char *
+    {
+      uintptr_t const cursor{reinterpret_cast<uintptr_t>(m_cursor) + sizeof(Header)};
+      uintptr_t const aligned{(cursor + alignment - 1) / alignment * alignment};
+      return reinterpret_cast<char *>(aligned);
+    }
+  };
+
+  char * component{place()};
+  if ((m_cursor == nullptr) || (component + size > m_end))
+  {
+    size_t const required{size + headerSpace(alignment) + alignment};
+    size_t const slabSize{(required > m_nextSlabSize) ? required : m_nextSlabSize};
+    size_t const nrOfUnits{(slabSize + sizeof(max_align_t) - 1) / sizeof(max_align_t)};
+    m_slabs.emplace_back(new max_align_t[nrOfUnits]);
+    m_cursor = reinterpret_cast<char *>(m_slabs.back().get());
+    m_end = m_cursor + nrOfUnits * sizeof(max_align_t);
+    m_nextSlabSize = (2 * m_nextSlabSize < maxSlabSize) ? 2 * m_nextSlabSize : maxSlabSize;
+    component = place();
+  }
+  m_cursor = component + size;
+  *headerOf(component) = Header{this, alignment};
+  return component;
+}
+
+void *
+allocateComponent(size_t const size, size_t const _alignment)
+{
+  size_t const alignment{(_alignment < alignof(Header)) ? alignof(Header) : _alignment};
+  if (Arena::current != nullptr)
+  {
+    return Arena::current->allocate(size, alignment);
+  }
+  size_t const space{headerSpace(alignment)};
+  char * const memory{static_cast<char *>(::operator new(space + size, align_val_t{alignment}))};
+  void * const component{memory + space};
+  *headerOf(component) = Header{nullptr, alignment};
+  return component;
+}
+
+void
+releaseComponent(void * const component)
+{
+  Header const header{*headerOf(component)};
+  if (header.arena != nullptr)
+  {
+    // Components allocated from an arena are released along with the arena.
+    return;
+  }
+  ::operator delete(static_cast<char *>(component) - headerSpace(header.alignment), align_val_t{header.alignment});
+}
+
+} // namespace state_diagram
@@ -0,0 +1,51 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_ARENA_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_ARENA_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace state_diagram
+{
+
+class Arena
+{
+public:
+  Arena();
+  Arena(Arena const &) = delete;
+
+  void operator=(Arena const &) = delete;
+
+  void * allocate(size_t const size, size_t const alignment);
+
+  static thread_local Arena * current;
+
+private:
+  vector<unique_ptr<max_align_t[]>> m_slabs;
+  char * m_cursor;
+  char * m_end;
+  size_t m_nextSlabSize;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_ARENA_H_
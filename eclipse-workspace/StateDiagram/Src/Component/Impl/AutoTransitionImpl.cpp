@@ -56,6 +56,7 @@ AutoTransitionImpl
     return ExecStat{};
   }
   max1Disable();
+  source->touch();
   source->finalize();
   source->unfreeze();
   return ExternalTransitionImpl::exec();
@@ -18,7 +18,6 @@
 
 #include <cassert>
 
-#include "Util/ListAlgorithm.hpp"
 #include "RegionImpl.h"
 #include "TopStateImpl.h"
 
@@ -36,13 +35,11 @@ CompoundStateImpl
 CompoundStateImpl
 ::CompoundStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl const * const _parent, TopStateImpl * const _topState)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_topState->namePool)}
 , LocalScope{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent, _topState}
 , m_defaultRegion{}
 , m_regions{}
-#ifndef STATE_DIAGRAM_STRINGLESS
-, m_regionNames{}
-#endif // STATE_DIAGRAM_STRINGLESS
+, m_regionSlice{}
 {
   // This space intentionally left empty
 }
@@ -70,7 +67,7 @@ CompoundStateImpl
   if (m_regions.size() == 0)
   {
     assert (m_defaultRegion.get() == nullptr);
-    m_defaultRegion = make_unique<RegionImpl>(STATE_DIAGRAM_STRING_ARG_COMMA(Region::defaultName) this);
+    m_defaultRegion = ComponentPtr<RegionImpl>{makeComponent<RegionImpl>(STATE_DIAGRAM_STRING_ARG_COMMA(Region::defaultName) this)};
   }
   assert (m_defaultRegion.get() != nullptr);
   assert (m_regions.size() == 1);
@@ -81,7 +78,7 @@ void
 CompoundStateImpl
 ::insertRegion(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const region)
 {
-  assert(!containsItem(m_regions, region));
+  assert(region->parentCompoundState() == this);
   if (m_defaultRegion.get() != nullptr)
   {
 #ifndef STATE_DIAGRAM_STRINGLESS
@@ -91,13 +88,13 @@ CompoundStateImpl
 #endif // STATE_DIAGRAM_STRINGLESS
   }
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_regionNames.insert(_name).second};
-  if (!stat)
+  if (!topState->claimName(this, TopStateImpl::NameKind::REGION, region->nameId))
   {
     throw CompoundState::RegionError::Insertion::NameClash(path(), _name);
   }
 #endif // STATE_DIAGRAM_STRINGLESS
   m_regions.emplace_front(region);
+  topState->registerComponent();
 }
 
 bool
@@ -108,12 +105,25 @@ const
   return m_regions.empty();
 }
 
-ForwardList<RegionImpl * const> const &
+void
+CompoundStateImpl
+::compileRegions(ExecutionPlan & plan)
+{
+  m_regionSlice = plan.regions.append(m_regions);
+  uint32_t planIdx{m_regionSlice.begin};
+  for (auto const & region : m_regions)
+  {
+    region->planIdx = planIdx++;
+    region->compile(plan);
+  }
+}
+
+Table<RegionImpl *>::Range
 CompoundStateImpl
 ::regions()
 const
 {
-  return m_regions;
+  return topState->plan().regions[m_regionSlice];
 }
 
 void
@@ -121,7 +131,10 @@ CompoundStateImpl
 ::forEachRegion(function<void (RegionImpl * const)> const & f)
 const
 {
-  forEachItem(m_regions, f);
+  for (auto const & region : regions())
+  {
+    f(region);
+  }
 }
 
 void
@@ -129,7 +142,13 @@ CompoundStateImpl
 ::forEachRegionExcept(function<void (RegionImpl * const)> const & f, RegionImpl const * const exceptee)
 const
 {
-  forEachItemExcept(m_regions, f, exceptee);
+  for (auto const & region : regions())
+  {
+    if (region != exceptee)
+    {
+      f(region);
+    }
+  }
 }
 
 void
@@ -137,7 +156,10 @@ CompoundStateImpl
 ::forEachCRegion(function<void (RegionImpl const * const)> const & f)
 const
 {
-  forEachCItem(m_regions, f);
+  for (auto const & region : regions())
+  {
+    f(region);
+  }
 }
 
 void
@@ -149,41 +171,65 @@ CompoundStateImpl
 )
 const
 {
-  forEachCItemExcept(m_regions, f, exceptee);
+  for (auto const & region : regions())
+  {
+    if (region != exceptee)
+    {
+      f(region);
+    }
+  }
 }
 
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
 
 void
 CompoundStateImpl
-::forEachRegionRandomly(function<void (RegionImpl * const)> const & f)
+::forEachRegionScheduled(function<void (RegionImpl * const)> const & f)
 const
 {
-  forEachItemRandomly(m_regions, f);
+  for (auto const & region : Scheduler::Sequence<RegionImpl>{topState->scheduler(), regions()})
+  {
+    f(region);
+  }
 }
 
 void
 CompoundStateImpl
-::forEachRegionRandomlyExcept(function<void (RegionImpl * const)> const & f, RegionImpl const * const exceptee)
+::forEachRegionScheduledExcept(function<void (RegionImpl * const)> const & f, RegionImpl const * const exceptee)
 const
 {
-  forEachItemRandomlyExcept(m_regions, f, exceptee);
+  for (auto const & region : Scheduler::Sequence<RegionImpl>{topState->scheduler(), regions()})
+  {
+    if (region != exceptee)
+    {
+      f(region);
+    }
+  }
 }
 
 void
 CompoundStateImpl
-::forEachCRegionRandomly(function<void (RegionImpl const * const)> const & f)
+::forEachCRegionScheduled(function<void (RegionImpl const * const)> const & f)
 const
 {
-  forEachCItemRandomly(m_regions, f);
+  for (auto const & region : Scheduler::Sequence<RegionImpl const>{topState->scheduler(), regions()})
+  {
+    f(region);
+  }
 }
 
 void
 CompoundStateImpl
-::forEachCRegionRandomlyExcept(function<void (RegionImpl const * const)> const & f, RegionImpl const * const exceptee)
+::forEachCRegionScheduledExcept(function<void (RegionImpl const * const)> const & f, RegionImpl const * const exceptee)
 const
 {
-  forEachCItemRandomlyExcept(m_regions, f, exceptee);
+  for (auto const & region : Scheduler::Sequence<RegionImpl const>{topState->scheduler(), regions()})
+  {
+    if (region != exceptee)
+    {
+      f(region);
+    }
+  }
 }
 
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -194,7 +240,7 @@ CompoundStateImpl
 {
   auto const initRegion{[&](RegionImpl * const region){region->init();}};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachRegionRandomly(initRegion);
+  forEachRegionScheduled(initRegion);
 #else
   forEachRegion(initRegion);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -207,7 +253,7 @@ const
 {
   auto const shallowInitRegion{[&](RegionImpl * const region){region->shallowInit();}};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachRegionRandomly(shallowInitRegion);
+  forEachRegionScheduled(shallowInitRegion);
 #else
   forEachRegion(shallowInitRegion);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -220,7 +266,7 @@ const
 {
   auto const initRegion{[&](RegionImpl * const region){region->init();}};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachRegionRandomlyExcept(initRegion, exceptee);
+  forEachRegionScheduledExcept(initRegion, exceptee);
 #else
   forEachRegionExcept(initRegion, exceptee);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -233,7 +279,7 @@ const
 {
   auto const finalizeRegion{[&](RegionImpl const * const region){region->finalize();}};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachCRegionRandomly(finalizeRegion);
+  forEachCRegionScheduled(finalizeRegion);
 #else
   forEachCRegion(finalizeRegion);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -246,7 +292,7 @@ const
 {
   auto const finalizeRegion{[&](RegionImpl const * const region){region->finalize();}};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachCRegionRandomlyExcept(finalizeRegion, exceptee);
+  forEachCRegionScheduledExcept(finalizeRegion, exceptee);
 #else
   forEachCRegionExcept(finalizeRegion, exceptee);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -278,15 +324,5 @@ const
 
 #endif // STATE_DIAGRAM_STRINGLESS
 
-void
-CompoundStateImpl
-::reload()
-const
-{
-  LocalScope::reload();
-  auto const reloadRegion{[&](RegionImpl const * const region){region->reload();}};
-  forEachCRegion(reloadRegion);
-}
-
 } // namespace state_diagram
 
@@ -20,11 +20,10 @@
 #include "state_diagram/state_diagram.h"
 
 #include <memory>
-#ifndef STATE_DIAGRAM_STRINGLESS
-#include <set>
-#endif // STATE_DIAGRAM_STRINGLESS
 
-#include "Util/ForwardList.hpp"
+#include "Util/ComponentAllocator.hpp"
+#include "Util/SmallVector.hpp"
+#include "Util/Table.hpp"
 #include "LocalScope.h"
 #include "NamePathImpl.h"
 #include "RegionImpl.h"
@@ -32,6 +31,7 @@
 namespace state_diagram
 {
 
+class ExecutionPlan;
 class StateImpl;
 class TopStateImpl;
 
@@ -41,11 +41,9 @@ class CompoundStateImpl
 , public LocalScope
 {
 private:
-  unique_ptr<RegionImpl> m_defaultRegion;
-  ForwardList<RegionImpl * const> m_regions;
-#ifndef STATE_DIAGRAM_STRINGLESS
-  set<string> m_regionNames;
-#endif // STATE_DIAGRAM_STRINGLESS
+  ComponentPtr<RegionImpl> m_defaultRegion;
+  SmallVector<RegionImpl * const> m_regions;
+  TableSlice m_regionSlice;
 
 protected:
   CompoundStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) TopStateImpl * const topState);
@@ -62,7 +60,8 @@ public:
 protected:
   bool isEmpty() const;
 
-  ForwardList<RegionImpl * const> const & regions() const;
+  void compileRegions(ExecutionPlan & plan);
+  Table<RegionImpl *>::Range regions() const;
 
   void forEachRegion(function<void (RegionImpl * const)> const & f) const;
   void forEachRegionExcept(function<void (RegionImpl * const)> const & f, RegionImpl const * const exceptee) const;
@@ -75,16 +74,16 @@ protected:
   )
   const;
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  void forEachRegionRandomly(function<void (RegionImpl * const)> const & f) const;
+  void forEachRegionScheduled(function<void (RegionImpl * const)> const & f) const;
   void
-  forEachRegionRandomlyExcept
+  forEachRegionScheduledExcept
   (
     function<void (RegionImpl * const)> const & f
   , RegionImpl const * const exceptee)
   const;
-  void forEachCRegionRandomly(function<void (RegionImpl const * const)> const & f) const;
+  void forEachCRegionScheduled(function<void (RegionImpl const * const)> const & f) const;
   void
-  forEachCRegionRandomlyExcept
+  forEachCRegionScheduledExcept
   (
     function<void (RegionImpl const * const)> const & f
   , RegionImpl const * const exceptee
@@ -93,21 +92,11 @@ protected:
 #endif // STATE_DIAGRAM_NO_SHUFFLING
 
 public:
-  virtual bool isDeepMemberOf(RegionImpl const * const r) const = 0;
-
   virtual void init();
   void shallowInit() const;
   void initRegionsExcept(RegionImpl const * const exceptee) const;
   void finalize() const;
   void finalizeRegionsExcept(RegionImpl const * const exceptee) const;
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Woverloaded-virtual"
-#endif
-  virtual void reload() const;
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
 
 #ifndef STATE_DIAGRAM_STRINGLESS
 private:
@@ -34,7 +34,7 @@ ConnectorStateImpl
 ConnectorStateImpl
 ::ConnectorStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const _parent)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
 , SubStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
 , SourceStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
 , TargetStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
@@ -0,0 +1,67 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ExecutionPlan.h"
+
+namespace state_diagram
+{
+
+ExecutionPlan
+::ExecutionPlan()
+:
+  regions{}
+, autoTransitions{}
+, internalTransitions{}
+, boundaryTransitions{}
+, triggers{}
+, triggeredGuards{}
+, triggeredOutputs{}
+, triggeredActions{}
+, triggerlessGuards{}
+, triggerlessOutputFuns{}
+, triggerlessActions{}
+, subStates{}
+, states{}
+, vars{}
+, externalSignals{}
+, nrOfScopes{0}
+{
+  // This space intentionally left empty
+}
+
+void
+ExecutionPlan
+::clear()
+{
+  regions.clear();
+  autoTransitions.clear();
+  internalTransitions.clear();
+  boundaryTransitions.clear();
+  triggers.clear();
+  triggeredGuards.clear();
+  triggeredOutputs.clear();
+  triggeredActions.clear();
+  triggerlessGuards.clear();
+  triggerlessOutputFuns.clear();
+  triggerlessActions.clear();
+  subStates.clear();
+  states.clear();
+  vars.clear();
+  externalSignals.clear();
+  nrOfScopes = 0;
+}
+
+} // namespace state_diagram
@@ -0,0 +1,73 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_EXECUTIONPLAN_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_EXECUTIONPLAN_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+
+#include "Util/Table.hpp"
+#include "Spec_all.h"
+
+namespace state_diagram
+{
+
+class AutoTransitionImpl;
+class BoundaryTransitionImpl;
+class ExternalSignalDelegateImpl;
+class InternalTransitionImpl;
+class RegionImpl;
+class StateImpl;
+class SubStateImpl;
+class VarDelegateImpl;
+
+class ExecutionPlan
+{
+public:
+  ExecutionPlan();
+  ExecutionPlan(ExecutionPlan const &) = delete;
+
+  void operator=(ExecutionPlan const &) = delete;
+
+  void clear();
+
+  Table<RegionImpl *> regions;
+  Table<AutoTransitionImpl *> autoTransitions;
+  Table<InternalTransitionImpl *> internalTransitions;
+  Table<BoundaryTransitionImpl *> boundaryTransitions;
+
+  Table<Event const *> triggers;
+  Table<TriggeredGuardSharable const *> triggeredGuards;
+  Table<TriggeredOutputSharable const *> triggeredOutputs;
+  Table<TriggeredActionSharable const *> triggeredActions;
+
+  Table<TriggerlessGuardSharable const *> triggerlessGuards;
+  Table<TriggerlessOutputFunSharable const *> triggerlessOutputFuns;
+  Table<TriggerlessActionSharable const *> triggerlessActions;
+
+  Table<SubStateImpl *> subStates;
+  Table<StateImpl *> states;
+  Table<VarDelegateImpl *> vars;
+  Table<ExternalSignalDelegateImpl *> externalSignals;
+
+  uint32_t nrOfScopes;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_EXECUTIONPLAN_H_
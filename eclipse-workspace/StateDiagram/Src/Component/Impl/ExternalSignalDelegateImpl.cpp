@@ -23,7 +23,8 @@ namespace state_diagram
 ExternalSignalDelegateImpl
 ::ExternalSignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) TopStateImpl * const _parent)
 :
-  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
+, planIdx{}
 , m_parent{_parent}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_isUnderExecution{false}
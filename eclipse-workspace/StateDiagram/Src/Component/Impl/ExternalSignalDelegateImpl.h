@@ -17,6 +17,8 @@
 #ifndef STATE_DIAGRAM_COMPONENT_IMPL_EXTERNALSIGNALDELEGATEIMPL_H_
 #define STATE_DIAGRAM_COMPONENT_IMPL_EXTERNALSIGNALDELEGATEIMPL_H_
 
+#include <cstdint>
+
 #include "NamePathImpl.h"
 #include "SignalDelegateImpl.h"
 
@@ -59,6 +61,8 @@ public:
   void deactivate() override;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
+  uint32_t planIdx;
+
 private:
   TopStateImpl * const m_parent;
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -16,8 +16,11 @@
 
 #include "ExternalTransitionImpl.h"
 
+#include <algorithm>
 #include <cassert>
 
+#include "StateImpl.h"
+
 namespace state_diagram
 {
 
@@ -26,7 +29,8 @@ ExternalTransitionImpl
 :
   source{_source}
 , target{_target}
-, m_stackSeq{makeStackSeqCheckColocality()}
+, m_exitRegions{computeExitRegionsCheckColocality()}
+, m_entryRegions{computeEntryRegions()}
 , m_outputScope{computeOutputScope()}
 {
   // This space intentionally left empty
@@ -48,23 +52,34 @@ const
   return source;
 }
 
-unique_ptr<StackSeq const>
+vector<RegionImpl *>
 ExternalTransitionImpl
-::makeStackSeqCheckColocality()
+::computeExitRegionsCheckColocality()
 const
 {
+  vector<RegionImpl *> exitRegions{};
   if (source->parentRegion() == target->parentRegion())
   {
-    return make_unique<StackSeq::Unwind::Void const>();
+    return exitRegions;
   }
   assert (source->parentRegion() != target->parentRegion());
   if (target->isDeepMemberOf(source->parentRegion()))
   {
-    return target->parentRegion()->makeStackSeqConstruct(target, source->parentRegion());
+    return exitRegions;
   }
   if (source->isDeepMemberOf(target->parentRegion()))
   {
-    return make_unique<StackSeq::Unwind::Do const>(target);
+    // Innermost first, up to but excluding the target region, which is where the least common ancestor lies.
+    for
+    (
+      RegionImpl * exitRegion{source->parentRegion()}
+    ; exitRegion != target->parentRegion()
+    ; exitRegion = exitRegion->parentState()->parentRegion()
+    )
+    {
+      exitRegions.push_back(exitRegion);
+    }
+    return exitRegions;
   }
   // Co-locality violated if none of the two parent regions is enclosed within the other.
 #ifndef STATE_DIAGRAM_STRINGLESS
@@ -74,6 +89,31 @@ const
 #endif // STATE_DIAGRAM_STRINGLESS
 }
 
+vector<RegionImpl *>
+ExternalTransitionImpl
+::computeEntryRegions()
+const
+{
+  vector<RegionImpl *> entryRegions{};
+  if ((source->parentRegion() == target->parentRegion()) || !target->isDeepMemberOf(source->parentRegion()))
+  {
+    return entryRegions;
+  }
+  // Outermost first, from just below the source region, which is where the least common ancestor lies, down to
+  // the target region.
+  for
+  (
+    RegionImpl * entryRegion{target->parentRegion()}
+  ; entryRegion != source->parentRegion()
+  ; entryRegion = entryRegion->parentState()->parentRegion()
+  )
+  {
+    entryRegions.push_back(entryRegion);
+  }
+  reverse(entryRegions.begin(), entryRegions.end());
+  return entryRegions;
+}
+
 SubStateImpl *
 ExternalTransitionImpl
 ::computeOutputScope()
@@ -103,33 +143,21 @@ ExecStat
 ExternalTransitionImpl
 ::exec()
 {
-  UnwindCmd const unwindCmd{
-    m_stackSeq->accept
-    (
-      [](StackSeq::Construct const * const ssc)
-      {
-        ssc->exec();
-        return UnwindCmd{};
-      }
-    , [&](StackSeq::Unwind const * const ssu) -> UnwindCmd
-      {
-        return
-          ssu->accept
-          (
-            [&]() -> UnwindCmd
-            {
-              this->target->becomeCurrent();
-              return UnwindCmd{};
-            }
-          , [](StackSeq::Unwind::Do const * const ssud) -> UnwindCmd
-            {
-              return UnwindCmd{ssud->target};
-            }
-          );
-      }
-    )
-  };
-  return ExecStat{unwindCmd};
+  for (auto const & exitRegion : m_exitRegions)
+  {
+    exitRegion->exitParentState(target);
+  }
+  for (auto const & entryRegion : m_entryRegions)
+  {
+    entryRegion->enterParentState();
+  }
+  target->becomeCurrent();
+  if (m_exitRegions.empty())
+  {
+    return ExecStat{UnwindCmd{}};
+  }
+  // The exited states still have their exec frames on the call stack, which are to be skipped up to the target region.
+  return ExecStat{UnwindCmd{target}};
 }
 
 } // namespace state_diagram
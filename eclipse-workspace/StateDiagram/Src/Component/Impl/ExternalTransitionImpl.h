@@ -19,7 +19,8 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "StackSeq/StackSeq_all.h"
+#include <vector>
+
 #include "ExecStat.h"
 #include "NamePathImpl.h"
 #include "TargetStateImpl.h"
@@ -46,7 +47,8 @@ public:
   void setCompletionFlag();
 
 protected:
-  unique_ptr<StackSeq const> const m_stackSeq;
+  vector<RegionImpl *> const m_exitRegions;
+  vector<RegionImpl *> const m_entryRegions;
   SubStateImpl const * const m_outputScope;
 
   SourceStateImpl * origin() const override;
@@ -57,7 +59,8 @@ public:
   virtual ExecStat exec();
 
 private:
-  unique_ptr<StackSeq const> makeStackSeqCheckColocality() const;
+  vector<RegionImpl *> computeExitRegionsCheckColocality() const;
+  vector<RegionImpl *> computeEntryRegions() const;
 
   SubStateImpl * computeOutputScope() const;
 };
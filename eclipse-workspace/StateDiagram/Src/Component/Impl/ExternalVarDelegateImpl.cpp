@@ -26,7 +26,7 @@ namespace state_diagram
 ExternalVarDelegateImpl
 ::ExternalVarDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) TopStateImpl * const _parent, ExternalVarDelegate * const _interface)
 :
-  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface}
+  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface, _parent, nullptr}
 , m_parent{_parent}
 {
   m_parent->insertExternalVar(STATE_DIAGRAM_STRING_ARG_COMMA(name) this);
@@ -32,7 +32,7 @@ FinalStateImpl
 FinalStateImpl
 ::FinalStateImpl(RegionImpl * const _parent)
 :
-   NamePathImpl{STATE_DIAGRAM_STRING_ARG(Final::name)}
+   NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Final::name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
  , SubStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Final::name) _parent}
  , TargetStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Final::name) _parent}
 {
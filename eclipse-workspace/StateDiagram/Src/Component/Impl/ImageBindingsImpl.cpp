@@ -0,0 +1,109 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ImageBindingsImpl.h"
+
+namespace state_diagram
+{
+
+ImageBindingsImpl
+::ImageBindingsImpl()
+:
+  m_guards{}
+, m_actions{}
+, m_outputs{}
+, m_signalTypes{}
+, m_varTypes{}
+{
+  // This space intentionally left empty
+}
+
+void
+ImageBindingsImpl
+::bind(uint32_t const slotId, Guard const & guard)
+{
+  rebind(m_guards, slotId, guard);
+}
+
+void
+ImageBindingsImpl
+::bind(uint32_t const slotId, Action const & action)
+{
+  rebind(m_actions, slotId, action);
+}
+
+void
+ImageBindingsImpl
+::bind(uint32_t const slotId, Output const & output)
+{
+  rebind(m_outputs, slotId, output);
+}
+
+void
+ImageBindingsImpl
+::bind(uint32_t const typeId, ImageBindings::SignalType const & signalType)
+{
+  rebind(m_signalTypes, typeId, signalType);
+}
+
+void
+ImageBindingsImpl
+::bind(uint32_t const typeId, ImageBindings::VarType const & varType)
+{
+  rebind(m_varTypes, typeId, varType);
+}
+
+Guard const *
+ImageBindingsImpl
+::guard(uint32_t const slotId)
+const
+{
+  return lookUp(m_guards, slotId);
+}
+
+Action const *
+ImageBindingsImpl
+::action(uint32_t const slotId)
+const
+{
+  return lookUp(m_actions, slotId);
+}
+
+Output const *
+ImageBindingsImpl
+::output(uint32_t const slotId)
+const
+{
+  return lookUp(m_outputs, slotId);
+}
+
+ImageBindings::SignalType const *
+ImageBindingsImpl
+::signalType(uint32_t const typeId)
+const
+{
+  return lookUp(m_signalTypes, typeId);
+}
+
+ImageBindings::VarType const *
+ImageBindingsImpl
+::varType(uint32_t const typeId)
+const
+{
+  return lookUp(m_varTypes, typeId);
+}
+
+} // namespace state_diagram
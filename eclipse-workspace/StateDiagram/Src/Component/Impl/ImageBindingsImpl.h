@@ -0,0 +1,77 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGEBINDINGSIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGEBINDINGSIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace state_diagram
+{
+
+class ImageBindingsImpl
+{
+public:
+  ImageBindingsImpl();
+  ImageBindingsImpl(ImageBindingsImpl const &) = delete;
+
+  void operator=(ImageBindingsImpl const &) = delete;
+
+  void bind(uint32_t const slotId, Guard const & guard);
+  void bind(uint32_t const slotId, Action const & action);
+  void bind(uint32_t const slotId, Output const & output);
+  void bind(uint32_t const typeId, ImageBindings::SignalType const & signalType);
+  void bind(uint32_t const typeId, ImageBindings::VarType const & varType);
+
+  Guard const * guard(uint32_t const slotId) const;
+  Action const * action(uint32_t const slotId) const;
+  Output const * output(uint32_t const slotId) const;
+  ImageBindings::SignalType const * signalType(uint32_t const typeId) const;
+  ImageBindings::VarType const * varType(uint32_t const typeId) const;
+
+private:
+  template<class Binding>
+  static
+  void
+  rebind(unordered_map<uint32_t, Binding> & bindings, uint32_t const id, Binding const & binding)
+  {
+    // Specs cannot be assigned to, so a binding is replaced rather than overwritten.
+    bindings.erase(id);
+    bindings.emplace(id, binding);
+  }
+
+  template<class Binding>
+  static
+  Binding const *
+  lookUp(unordered_map<uint32_t, Binding> const & bindings, uint32_t const id)
+  {
+    auto const binding{bindings.find(id)};
+    return (binding != bindings.end()) ? &binding->second : nullptr;
+  }
+
+  unordered_map<uint32_t, Guard> m_guards;
+  unordered_map<uint32_t, Action> m_actions;
+  unordered_map<uint32_t, Output> m_outputs;
+  unordered_map<uint32_t, ImageBindings::SignalType> m_signalTypes;
+  unordered_map<uint32_t, ImageBindings::VarType> m_varTypes;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGEBINDINGSIMPL_H_
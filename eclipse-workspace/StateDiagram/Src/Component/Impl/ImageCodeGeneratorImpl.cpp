@@ -0,0 +1,1452 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "ImageCodeGeneratorImpl.h"
+
+#include <algorithm>
+#include <fstream>
+#include <initializer_list>
+#include <set>
+#include <sstream>
+
+#include "ImageImpl.h"
+
+namespace state_diagram
+{
+
+namespace
+{
+  char const * const keywords[]
+  {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char"
+  , "char8_t", "char16_t", "char32_t", "class", "compl", "concept", "const", "consteval", "constexpr", "constinit"
+  , "const_cast", "continue", "co_await", "co_return", "co_yield", "decltype", "default", "delete", "do", "double"
+  , "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if"
+  , "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or"
+  , "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "requires", "return", "short"
+  , "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this"
+  , "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual"
+  , "void", "volatile", "wchar_t", "while", "xor", "xor_eq"
+  };
+
+  string
+  joined(string const & scope, string const & name)
+  {
+    return scope.empty() ? name : scope + "_" + name;
+  }
+
+  // Characters that may not appear in identifiers are replaced, and names that are keywords are suffixed.
+  string
+  sanitized(string const & name)
+  {
+    string identifier{name};
+    for (auto & c : identifier)
+    {
+      bool const isLetterOrDigit
+      {
+        ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9'))
+      };
+      if (!isLetterOrDigit)
+      {
+        c = '_';
+      }
+    }
+    if (identifier.empty() || ((identifier[0] >= '0') && (identifier[0] <= '9')))
+    {
+      identifier.insert(0, 1, '_');
+    }
+    if (find(begin(keywords), end(keywords), identifier) != end(keywords))
+    {
+      identifier += '_';
+    }
+    return identifier;
+  }
+
+  // Enumerators of the same enumeration whose sanitized names clash are told apart by their values.
+  string
+  unique(set<string> & identifiers, string const & name, Image::Idx const id)
+  {
+    string identifier{sanitized(name)};
+    if (!identifiers.insert(identifier).second)
+    {
+      identifier += "_" + to_string(id);
+      identifiers.insert(identifier);
+    }
+    return identifier;
+  }
+
+  string
+  mask(uint32_t const bit)
+  {
+    char const * const digits{"0123456789abcdef"};
+    uint64_t const value{uint64_t{1} << (bit % 64)};
+    string hex{};
+    for (int shift{60}; shift >= 0; shift -= 4)
+    {
+      if (!hex.empty() || ((value >> shift) != 0))
+      {
+        hex += digits[(value >> shift) & 0xf];
+      }
+    }
+    return "UINT64_C(0x" + hex + ")";
+  }
+
+  string
+  word(char const * const flags, uint32_t const bit)
+  {
+    return string{flags} + "[" + to_string(bit / 64) + "]";
+  }
+}
+
+ImageCodeGeneratorImpl
+::ImageCodeGeneratorImpl(ImageImpl const * const image, string const & className)
+:
+  m_topName{image->str(image->header().topName)}
+, m_components{}
+, m_regions{}
+, m_transitions{}
+, m_specs{}
+, m_max1Bits{}
+, m_nrOfStateBits{0}
+, m_nrOfSignalBits{0}
+, m_nrOfMax1Bits{0}
+, m_code{}
+{
+  model(image);
+  nameIdentifiers();
+  stringstream out;
+  generate(out, sanitized(className));
+  m_code = out.str();
+}
+
+string const &
+ImageCodeGeneratorImpl
+::code()
+const
+{
+  return m_code;
+}
+
+void
+ImageCodeGeneratorImpl
+::write(char const * const path)
+const
+{
+  ofstream file{path, ios::trunc};
+  file.write(m_code.data(), static_cast<streamsize>(m_code.size()));
+  file.close();
+  if (!file)
+  {
+    throw Image::FileError(path);
+  }
+}
+
+void
+ImageCodeGeneratorImpl
+::model(ImageImpl const * const image)
+{
+  ImageFormat::Header const & header{image->header()};
+  m_components.reserve(header.components.count);
+  for (Image::Idx idx{0}; idx < header.components.count; ++idx)
+  {
+    addComponent(image, idx);
+  }
+  for (auto const & region : m_regions)
+  {
+    if (region.init == none)
+    {
+      throw
+        ImageCodeGenerator::UnsupportedError("component", region.id, "region " + region.path + " has no initial state");
+    }
+  }
+  m_specs.reserve(header.specs.count);
+  for (Image::Idx idx{0}; idx < header.specs.count; ++idx)
+  {
+    m_specs.push_back(image->spec(idx));
+  }
+  m_transitions.reserve(header.transitions.count);
+  m_max1Bits.reserve(header.transitions.count);
+  for (Image::Idx idx{0}; idx < header.transitions.count; ++idx)
+  {
+    addTransition(image, idx);
+  }
+}
+
+void
+ImageCodeGeneratorImpl
+::addComponent(ImageImpl const * const image, Image::Idx const idx)
+{
+  ImageFormat::Component const & record{image->component(idx)};
+  string const name{image->str(record.name)};
+  m_components.push_back(Component{record.kind, record.parent, none, none, {}, none, "", "", {}, {}, {}, {}, {}});
+  switch (record.kind)
+  {
+  case ImageFormat::ComponentKind::TOP:
+    m_components[idx].path = m_topName;
+    break;
+
+  case ImageFormat::ComponentKind::REGION:
+  {
+    Component const & parent{m_components[record.parent]};
+    m_regions.push_back
+    (
+      Region{idx, record.parent, none, {}, joined(parent.identifier, name), parent.path + "::" + name}
+    );
+    m_components[idx].region = static_cast<uint32_t>(m_regions.size() - 1);
+    m_components[record.parent].regions.push_back(m_components[idx].region);
+    m_components[idx].identifier = m_regions.back().identifier;
+    m_components[idx].path = m_regions.back().path;
+    break;
+  }
+
+  case ImageFormat::ComponentKind::INIT:
+  case ImageFormat::ComponentKind::FINAL:
+  case ImageFormat::ComponentKind::STATE:
+  case ImageFormat::ComponentKind::CONNECTOR:
+  {
+    uint32_t const region{regionWithin(record.parent)};
+    string const subStateName
+    {
+      (record.kind == ImageFormat::ComponentKind::INIT)
+      ? Init::name
+      : ((record.kind == ImageFormat::ComponentKind::FINAL) ? Final::name : name)
+    };
+    Component & component{m_components[idx]};
+    component.region = region;
+    component.identifier = joined(m_components[record.parent].identifier, subStateName);
+    component.path = m_regions[region].path + "::" + subStateName;
+    if (record.kind == ImageFormat::ComponentKind::STATE)
+    {
+      component.bit = m_nrOfStateBits++;
+    }
+    if ((record.kind == ImageFormat::ComponentKind::INIT) && (m_regions[region].init == none))
+    {
+      m_regions[region].init = idx;
+    }
+    m_regions[region].subStates.push_back(idx);
+    break;
+  }
+
+  case ImageFormat::ComponentKind::EXTERNAL_SIGNAL:
+    m_components[idx].identifier = name;
+    m_components[idx].path = name;
+    m_components[idx].bit = m_nrOfSignalBits++;
+    break;
+
+  case ImageFormat::ComponentKind::LOCAL_SIGNAL:
+    m_components[idx].identifier = joined(m_components[record.parent].identifier, name);
+    m_components[idx].path = m_components[record.parent].path + "::" + name;
+    m_components[idx].bit = m_nrOfSignalBits++;
+    break;
+
+  default:
+    throw ImageCodeGenerator::UnsupportedError("component", idx, "variables rest on the engine");
+  }
+}
+
+void
+ImageCodeGeneratorImpl
+::addTransition(ImageImpl const * const image, Image::Idx const idx)
+{
+  ImageFormat::Transition const & record{image->transition(idx)};
+  m_transitions.push_back(record);
+  m_max1Bits.push_back(none);
+  for (uint32_t specIdx{record.firstSpec}; specIdx < record.firstSpec + record.nrOfSpecs; ++specIdx)
+  {
+    switch (m_specs[specIdx].kind)
+    {
+    case ImageFormat::SpecKind::AFTER:
+    case ImageFormat::SpecKind::AT:
+      throw ImageCodeGenerator::UnsupportedError("transition", idx, "timer specs rest on the engine");
+
+    case ImageFormat::SpecKind::BOUND_OUTPUT:
+      throw ImageCodeGenerator::UnsupportedError("transition", idx, "bound output specs rest on the engine");
+
+    case ImageFormat::SpecKind::MAX1_FLAG:
+      if (m_max1Bits.back() == none)
+      {
+        m_max1Bits.back() = m_nrOfMax1Bits++;
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  switch (record.kind)
+  {
+  case ImageFormat::TransitionKind::AUTO:
+  case ImageFormat::TransitionKind::STEP:
+  {
+    uint32_t const sourceRegion{m_components[record.source].region};
+    uint32_t const targetRegion{m_components[record.target].region};
+    // Both sub-states are to be nested within one region, so that exiting and entering states can be laid out
+    // in full ahead of time, just like the engine does when constructing the transition.
+    if
+    (
+      (sourceRegion != targetRegion)
+      && !isDeepMemberOf(record.target, sourceRegion)
+      && !isDeepMemberOf(record.source, targetRegion)
+    )
+    {
+      throw ImageCodeGenerator::UnsupportedError("transition", idx, "its source and target are not nested");
+    }
+    if (record.kind == ImageFormat::TransitionKind::AUTO)
+    {
+      m_components[record.source].autoTransitions.push_back(idx);
+    }
+    else
+    {
+      m_components[record.source].stepTransitions.push_back(idx);
+    }
+    break;
+  }
+
+  case ImageFormat::TransitionKind::ENTER:
+    m_components[record.source].enterTransitions.push_back(idx);
+    break;
+
+  case ImageFormat::TransitionKind::EXIT:
+    m_components[record.source].exitTransitions.push_back(idx);
+    break;
+
+  default:
+    m_components[record.source].internalTransitions.push_back(idx);
+    break;
+  }
+}
+
+uint32_t
+ImageCodeGeneratorImpl
+::regionWithin(Image::Idx const parent)
+{
+  Component & component{m_components[parent]};
+  if (component.kind == ImageFormat::ComponentKind::REGION)
+  {
+    return component.region;
+  }
+  // Sub-states of the top state or of a state are members of its default region, which is made on demand.
+  if (component.defaultRegion == none)
+  {
+    m_regions.push_back
+    (
+      Region
+      {
+        parent
+      , parent
+      , none
+      , {}
+      , joined(component.identifier, STATE_DIAGRAM_DEFAULT_NAME_OF_REGION)
+      , component.path + "::" + STATE_DIAGRAM_DEFAULT_NAME_OF_REGION
+      }
+    );
+    component.defaultRegion = static_cast<uint32_t>(m_regions.size() - 1);
+    component.regions.push_back(component.defaultRegion);
+  }
+  return component.defaultRegion;
+}
+
+void
+ImageCodeGeneratorImpl
+::nameIdentifiers()
+{
+  set<string> states;
+  set<string> signals;
+  set<string> regions;
+  for (Image::Idx idx{0}; idx < m_components.size(); ++idx)
+  {
+    Component & component{m_components[idx]};
+    switch (component.kind)
+    {
+    case ImageFormat::ComponentKind::INIT:
+    case ImageFormat::ComponentKind::FINAL:
+    case ImageFormat::ComponentKind::STATE:
+    case ImageFormat::ComponentKind::CONNECTOR:
+      component.identifier = unique(states, component.identifier, idx);
+      break;
+
+    case ImageFormat::ComponentKind::EXTERNAL_SIGNAL:
+    case ImageFormat::ComponentKind::LOCAL_SIGNAL:
+      component.identifier = unique(signals, component.identifier, idx);
+      break;
+
+    default:
+      break;
+    }
+  }
+  for (auto & region : m_regions)
+  {
+    region.identifier = unique(regions, region.identifier, region.id);
+  }
+}
+
+bool
+ImageCodeGeneratorImpl
+::isDeepMemberOf(Image::Idx const subState, uint32_t const region)
+const
+{
+  for (Image::Idx member{subState}; ; )
+  {
+    uint32_t const memberRegion{m_components[member].region};
+    if (memberRegion == region)
+    {
+      return true;
+    }
+    member = m_regions[memberRegion].parent;
+    if (member == Image::topIdx)
+    {
+      return false;
+    }
+  }
+}
+
+vector<uint32_t>
+ImageCodeGeneratorImpl
+::exitRegions(ImageFormat::Transition const & transition)
+const
+{
+  vector<uint32_t> exitRegions{};
+  uint32_t const targetRegion{m_components[transition.target].region};
+  if
+  (
+    (m_components[transition.source].region == targetRegion)
+    || isDeepMemberOf(transition.target, m_components[transition.source].region)
+  )
+  {
+    return exitRegions;
+  }
+  // Innermost first, up to but excluding the target region.
+  for
+  (
+    uint32_t exitRegion{m_components[transition.source].region}
+  ; exitRegion != targetRegion
+  ; exitRegion = m_components[m_regions[exitRegion].parent].region
+  )
+  {
+    exitRegions.push_back(exitRegion);
+  }
+  return exitRegions;
+}
+
+vector<uint32_t>
+ImageCodeGeneratorImpl
+::entryRegions(ImageFormat::Transition const & transition)
+const
+{
+  vector<uint32_t> entryRegions{};
+  uint32_t const sourceRegion{m_components[transition.source].region};
+  if ((m_components[transition.target].region == sourceRegion) || !isDeepMemberOf(transition.target, sourceRegion))
+  {
+    return entryRegions;
+  }
+  // Outermost first, from just below the source region down to the target region.
+  for
+  (
+    uint32_t entryRegion{m_components[transition.target].region}
+  ; entryRegion != sourceRegion
+  ; entryRegion = m_components[m_regions[entryRegion].parent].region
+  )
+  {
+    entryRegions.push_back(entryRegion);
+  }
+  reverse(entryRegions.begin(), entryRegions.end());
+  return entryRegions;
+}
+
+void
+ImageCodeGeneratorImpl
+::generate(ostream & out, string const & className)
+const
+{
+  string guard{"STATE_DIAGRAM_GENERATED_"};
+  for (char const c : className)
+  {
+    guard += static_cast<char>(((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c);
+  }
+  guard += "_H_";
+
+  out
+    << "// Generated from the diagram image of top state \"" << m_topName << "\". Do not edit.\n"
+    << "\n"
+    << "#ifndef " << guard << "\n"
+    << "#define " << guard << "\n"
+    << "\n"
+    << "#include <cstdint>\n"
+    << "#include <cstring>\n"
+    << "\n"
+    << "template<class Bindings>\n"
+    << "class " << className << "\n"
+    << "{\n"
+    << "public:\n";
+
+  auto const enumerate
+  {
+    [&](char const * const name, auto const & forEachEnumerator)
+    {
+      out << "  enum class " << name << " : std::uint32_t\n  {\n";
+      char const * separator{"    "};
+      forEachEnumerator
+      (
+        [&](string const & identifier, Image::Idx const id, string const & path)
+        {
+          out << separator << identifier << " = " << id << " // " << path << "\n";
+          separator = "  , ";
+        }
+      );
+      out << "  };\n\n";
+    }
+  };
+  auto const forEachComponent
+  {
+    [&](initializer_list<ImageFormat::ComponentKind> const kinds, auto const & f)
+    {
+      for (Image::Idx idx{0}; idx < m_components.size(); ++idx)
+      {
+        if (find(kinds.begin(), kinds.end(), m_components[idx].kind) != kinds.end())
+        {
+          f(m_components[idx].identifier, idx, m_components[idx].path);
+        }
+      }
+    }
+  };
+  enumerate
+  (
+    "State"
+  , [&](auto const & f)
+    {
+      forEachComponent
+      (
+        {
+          ImageFormat::ComponentKind::INIT
+        , ImageFormat::ComponentKind::FINAL
+        , ImageFormat::ComponentKind::STATE
+        , ImageFormat::ComponentKind::CONNECTOR
+        }
+      , f
+      );
+    }
+  );
+  enumerate
+  (
+    "Region"
+  , [&](auto const & f)
+    {
+      for (auto const & region : m_regions)
+      {
+        f(region.identifier, region.id, region.path);
+      }
+    }
+  );
+  enumerate
+  (
+    "Signal"
+  , [&](auto const & f)
+    {
+      forEachComponent({ImageFormat::ComponentKind::EXTERNAL_SIGNAL, ImageFormat::ComponentKind::LOCAL_SIGNAL}, f);
+    }
+  );
+
+  generatePublic(out, className);
+
+  out
+    << "private:\n"
+    << "  struct ExecStat\n"
+    << "  {\n"
+    << "    bool stat;\n"
+    << "    std::uint32_t unwindTo;\n"
+    << "  };\n"
+    << "\n"
+    << "  static std::uint32_t constexpr noRegion{UINT32_MAX};\n"
+    << "\n";
+  for (auto const & region : m_regions)
+  {
+    generateRegion(out, region);
+  }
+  for (Image::Idx idx{0}; idx < m_components.size(); ++idx)
+  {
+    switch (m_components[idx].kind)
+    {
+    case ImageFormat::ComponentKind::STATE:
+      generateState(out, idx);
+      generateSource(out, idx);
+      break;
+
+    case ImageFormat::ComponentKind::INIT:
+    case ImageFormat::ComponentKind::CONNECTOR:
+      generateSource(out, idx);
+      break;
+
+    default:
+      break;
+    }
+  }
+  for (Image::Idx idx{0}; idx < m_transitions.size(); ++idx)
+  {
+    generateTransition(out, idx);
+  }
+
+  out
+    << "  void\n"
+    << "  reload()\n"
+    << "  {\n"
+    << "    std::memset(m_isActive, 0, sizeof(m_isActive));\n"
+    << "    std::memset(m_isPaused, 0, sizeof(m_isPaused));\n"
+    << "    std::memset(m_haveExecuted, 0, sizeof(m_haveExecuted));\n"
+    << "  }\n"
+    << "\n"
+    << "  Bindings & m_bindings;\n";
+  for (auto const & region : m_regions)
+  {
+    out << "  State " << current(region) << ";\n";
+  }
+  out
+    << "  std::uint64_t m_isActive[" << nrOfWords(m_nrOfSignalBits) << "];\n"
+    << "  std::uint64_t m_isPaused[" << nrOfWords(m_nrOfStateBits) << "];\n"
+    << "  std::uint64_t m_isFrozen[" << nrOfWords(m_nrOfStateBits) << "];\n"
+    << "  std::uint64_t m_isFrozenShallowly[" << nrOfWords(m_nrOfStateBits) << "];\n"
+    << "  std::uint64_t m_haveExecuted[" << nrOfWords(m_nrOfMax1Bits) << "];\n"
+    << "};\n"
+    << "\n"
+    << "#endif // " << guard << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generatePublic(ostream & out, string const & className)
+const
+{
+  out
+    << "  " << className << "(Bindings & bindings)\n"
+    << "  :\n"
+    << "    m_bindings{bindings}\n";
+  for (auto const & region : m_regions)
+  {
+    out << "  , " << current(region) << "{}\n";
+  }
+  out
+    << "  , m_isActive{}\n"
+    << "  , m_isPaused{}\n"
+    << "  , m_isFrozen{}\n"
+    << "  , m_isFrozenShallowly{}\n"
+    << "  , m_haveExecuted{}\n"
+    << "  {\n"
+    << "    // This space intentionally left empty\n"
+    << "  }\n"
+    << "\n";
+
+  Component const & top{m_components[Image::topIdx]};
+  out
+    << "  void\n"
+    << "  init()\n"
+    << "  {\n";
+  for (auto const region : top.regions)
+  {
+    out << "    initRegion" << m_regions[region].id << "();\n";
+  }
+  out
+    << "  }\n"
+    << "\n";
+
+  out
+    << "  void\n"
+    << "  activate(Signal const signal)\n"
+    << "  {\n"
+    << "    switch (signal)\n"
+    << "    {\n";
+  for (auto const & component : m_components)
+  {
+    if (component.kind == ImageFormat::ComponentKind::EXTERNAL_SIGNAL)
+    {
+      out
+        << "    case Signal::" << component.identifier << ":\n"
+        << "      " << setBit("m_isActive", component.bit) << "\n"
+        << "      break;\n"
+        << "\n";
+    }
+  }
+  out
+    << "    default:\n"
+    << "      break;\n"
+    << "    }\n"
+    << "  }\n"
+    << "\n";
+
+  // Regions are rescanned until none of them is active anymore, or all of them have terminated.
+  out
+    << "  bool\n"
+    << "  step()\n"
+    << "  {\n"
+    << "    bool haveAllRegionsTerminated;\n"
+    << "    for (;;)\n"
+    << "    {\n"
+    << "      bool isSomeRegionActive{false};\n"
+    << "      haveAllRegionsTerminated = true;\n";
+  for (auto const region : top.regions)
+  {
+    out
+      << "      isSomeRegionActive |= execRegion" << m_regions[region].id << "().stat;\n"
+      << "      haveAllRegionsTerminated &= " << hasTerminated(m_regions[region]) << ";\n";
+  }
+  out
+    << "      if ((!isSomeRegionActive) || haveAllRegionsTerminated)\n"
+    << "      {\n"
+    << "        break;\n"
+    << "      }\n"
+    << "    }\n"
+    << "    reload();\n"
+    << "    return haveAllRegionsTerminated;\n"
+    << "  }\n"
+    << "\n";
+
+  out
+    << "  State\n"
+    << "  current(Region const region)\n"
+    << "  const\n"
+    << "  {\n"
+    << "    switch (region)\n"
+    << "    {\n";
+  for (auto const & region : m_regions)
+  {
+    out
+      << "    case Region::" << region.identifier << ":\n"
+      << "      return " << current(region) << ";\n"
+      << "\n";
+  }
+  out
+    << "    default:\n"
+    << "      return State{};\n"
+    << "    }\n"
+    << "  }\n"
+    << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateRegion(ostream & out, Region const & region)
+const
+{
+  string const id{to_string(region.id)};
+  auto const forEachState
+  {
+    [&](char const * const call)
+    {
+      out
+        << "    switch (" << current(region) << ")\n"
+        << "    {\n";
+      for (auto const subState : region.subStates)
+      {
+        if (m_components[subState].kind == ImageFormat::ComponentKind::STATE)
+        {
+          out
+            << "    case " << state(subState) << ":\n"
+            << "      " << call << subState << "();\n"
+            << "      break;\n"
+            << "\n";
+        }
+      }
+      out
+        << "    default:\n"
+        << "      break;\n"
+        << "    }\n";
+    }
+  };
+
+  out
+    << "  // Region " << region.path << ".\n"
+    << "  void\n"
+    << "  initRegion" << id << "()\n"
+    << "  {\n"
+    << "    " << current(region) << " = " << state(region.init) << ";\n"
+    << "  }\n"
+    << "\n"
+    << "  void\n"
+    << "  shallowInitRegion" << id << "()\n"
+    << "  {\n";
+  forEachState("initState");
+  out
+    << "  }\n"
+    << "\n"
+    << "  void\n"
+    << "  finalizeRegion" << id << "()\n"
+    << "  {\n";
+  forEachState("finalizeState");
+  out
+    << "  }\n"
+    << "\n"
+    << "  ExecStat\n"
+    << "  execRegion" << id << "()\n"
+    << "  {\n"
+    << "    ExecStat stat{false, noRegion};\n"
+    << "    switch (" << current(region) << ")\n"
+    << "    {\n";
+  for (auto const subState : region.subStates)
+  {
+    ImageFormat::ComponentKind const kind{m_components[subState].kind};
+    if (kind != ImageFormat::ComponentKind::FINAL)
+    {
+      out
+        << "    case " << state(subState) << ":\n"
+        << "      stat = " << ((kind == ImageFormat::ComponentKind::STATE) ? "execState" : "execSource")
+        << subState << "();\n"
+        << "      break;\n"
+        << "\n";
+    }
+  }
+  // The transition that has been executed has already exited the states in between and entered its target, so
+  // only the exec frames of the exited states are left to be skipped.
+  out
+    << "    default:\n"
+    << "      break;\n"
+    << "    }\n"
+    << "    if (stat.stat && (stat.unwindTo == " << id << "))\n"
+    << "    {\n"
+    << "      return ExecStat{true, noRegion};\n"
+    << "    }\n"
+    << "    return stat;\n"
+    << "  }\n"
+    << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateState(ostream & out, Image::Idx const idx)
+const
+{
+  Component const & component{m_components[idx]};
+  string const id{to_string(idx)};
+
+  out
+    << "  // State " << component.path << ".\n"
+    << "  void\n"
+    << "  initState" << id << "()\n"
+    << "  {\n"
+    << "    " << setBit("m_isPaused", component.bit) << "\n"
+    << "    if (" << isBitClear("m_isFrozen", component.bit) << ")\n"
+    << "    {\n"
+    << "      enterState" << id << "();\n";
+  for (auto const region : component.regions)
+  {
+    out << "      initRegion" << m_regions[region].id << "();\n";
+  }
+  out
+    << "    }\n"
+    << "    else if (" << isBitSet("m_isFrozenShallowly", component.bit) << ")\n"
+    << "    {\n";
+  for (auto const region : component.regions)
+  {
+    out << "      shallowInitRegion" << m_regions[region].id << "();\n";
+  }
+  out
+    << "    }\n"
+    << "  }\n"
+    << "\n"
+    << "  void\n"
+    << "  enterState" << id << "()\n"
+    << "  {\n";
+  generateBoundaryTransitions(out, component.enterTransitions);
+  out
+    << "  }\n"
+    << "\n"
+    << "  void\n"
+    << "  exitState" << id << "()\n"
+    << "  {\n";
+  generateBoundaryTransitions(out, component.exitTransitions);
+  out
+    << "  }\n"
+    << "\n"
+    << "  void\n"
+    << "  finalizeState" << id << "()\n"
+    << "  {\n";
+  for (auto const region : component.regions)
+  {
+    out << "    finalizeRegion" << m_regions[region].id << "();\n";
+  }
+  out
+    << "    exitState" << id << "();\n"
+    << "  }\n"
+    << "\n";
+
+  out
+    << "  bool\n"
+    << "  execInternalTransitions" << id << "()\n"
+    << "  {\n"
+    << "    bool isSomeTransitionActive{false};\n";
+  for (auto const transition : component.internalTransitions)
+  {
+    out << "    isSomeTransitionActive |= transition" << transition << "();\n";
+  }
+  out
+    << "    return isSomeTransitionActive;\n"
+    << "  }\n"
+    << "\n";
+
+  // Regions come first, with internal transitions being executed whenever some region is active. Otherwise, the
+  // transitions leaving the state come first, and internal transitions only if none of them is executed.
+  out
+    << "  ExecStat\n"
+    << "  execState" << id << "()\n"
+    << "  {\n"
+    << "    bool isSomeRegionActive{false};\n";
+  for (auto const region : component.regions)
+  {
+    out
+      << "    {\n"
+      << "      ExecStat const stat{execRegion" << m_regions[region].id << "()};\n"
+      << "      if (stat.stat)\n"
+      << "      {\n"
+      << "        if (stat.unwindTo != noRegion)\n"
+      << "        {\n"
+      << "          return stat;\n"
+      << "        }\n"
+      << "        isSomeRegionActive = true;\n"
+      << "      }\n"
+      << "    }\n";
+  }
+  out
+    << "    if (isSomeRegionActive)\n"
+    << "    {\n"
+    << "      execInternalTransitions" << id << "();\n"
+    << "      return ExecStat{true, noRegion};\n"
+    << "    }\n"
+    << "    ExecStat const stat{execSource" << id << "()};\n"
+    << "    if (stat.stat)\n"
+    << "    {\n"
+    << "      return stat;\n"
+    << "    }\n"
+    << "    return ExecStat{execInternalTransitions" << id << "(), noRegion};\n"
+    << "  }\n"
+    << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateSource(ostream & out, Image::Idx const idx)
+const
+{
+  Component const & component{m_components[idx]};
+  if (component.kind != ImageFormat::ComponentKind::STATE)
+  {
+    out << "  // Sub-state " << component.path << ".\n";
+  }
+  out
+    << "  ExecStat\n"
+    << "  execSource" << idx << "()\n"
+    << "  {\n";
+  // Auto transitions come first, then step transitions, each in the order of the image.
+  for (auto const & transitions : {component.autoTransitions, component.stepTransitions})
+  {
+    for (auto const transition : transitions)
+    {
+      out
+        << "    {\n"
+        << "      ExecStat const stat{transition" << transition << "()};\n"
+        << "      if (stat.stat)\n"
+        << "      {\n"
+        << "        return stat;\n"
+        << "      }\n"
+        << "    }\n";
+    }
+  }
+  out
+    << "    return ExecStat{false, noRegion};\n"
+    << "  }\n"
+    << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateTransition(ostream & out, Image::Idx const idx)
+const
+{
+  ImageFormat::Transition const & transition{m_transitions[idx]};
+  Component const & source{m_components[transition.source]};
+  bool const isSourceState{source.kind == ImageFormat::ComponentKind::STATE};
+  uint32_t const max1Bit{m_max1Bits[idx]};
+  string const id{to_string(idx)};
+
+  // Only triggers whose signals are active are considered, in the order of their last occurrences, since the
+  // engine holds a single one of duplicate triggers.
+  vector<Image::Idx> triggers{};
+  for (uint32_t specIdx{transition.firstSpec}; specIdx < transition.firstSpec + transition.nrOfSpecs; ++specIdx)
+  {
+    if (m_specs[specIdx].kind == ImageFormat::SpecKind::TRIGGER)
+    {
+      triggers.erase(remove(triggers.begin(), triggers.end(), m_specs[specIdx].arg), triggers.end());
+      triggers.push_back(m_specs[specIdx].arg);
+    }
+  }
+  // The trigger is chosen only if some action is passed it, otherwise whether there is one is enough.
+  bool isTriggerPassed{false};
+  for (uint32_t specIdx{transition.firstSpec}; specIdx < transition.firstSpec + transition.nrOfSpecs; ++specIdx)
+  {
+    isTriggerPassed |= (m_specs[specIdx].kind == ImageFormat::SpecKind::ACTION);
+  }
+  auto const chooseTrigger
+  {
+    [&](char const * const nothing)
+    {
+      vector<string> conditions{};
+      for (auto const trigger : triggers)
+      {
+        string const isActive{isBitSet("m_isActive", m_components[trigger].bit)};
+        string const guards{this->guards(transition, signal(trigger))};
+        conditions.push_back(guards.empty() ? isActive : "(" + isActive + ") && " + guards);
+      }
+      if (!isTriggerPassed)
+      {
+        string condition{};
+        for (auto const & triggerCondition : conditions)
+        {
+          condition += (condition.empty() ? "(" : " || (") + triggerCondition + ")";
+        }
+        out
+          << "    if (!(" << condition << "))\n"
+          << "    {\n"
+          << "      return " << nothing << ";\n"
+          << "    }\n";
+        return;
+      }
+      out << "    Signal trigger{};\n";
+      char const * keyword{"if"};
+      for (size_t idx{0}; idx < triggers.size(); ++idx)
+      {
+        out
+          << "    " << keyword << " (" << conditions[idx] << ")\n"
+          << "    {\n"
+          << "      trigger = " << signal(triggers[idx]) << ";\n"
+          << "    }\n";
+        keyword = "else if";
+      }
+      out
+        << "    else\n"
+        << "    {\n"
+        << "      return " << nothing << ";\n"
+        << "    }\n";
+    }
+  };
+  auto const returnIf
+  {
+    [&](string const & condition, char const * const nothing)
+    {
+      out
+        << "    if (" << condition << ")\n"
+        << "    {\n"
+        << "      return " << nothing << ";\n"
+        << "    }\n";
+    }
+  };
+
+  switch (transition.kind)
+  {
+  case ImageFormat::TransitionKind::AUTO:
+  {
+    out
+      << "  // Auto transition " << id << " from " << source.path
+      << " to " << m_components[transition.target].path << ".\n"
+      << "  ExecStat\n"
+      << "  transition" << id << "()\n"
+      << "  {\n";
+    char const * const nothing{"ExecStat{false, noRegion}"};
+    if (max1Bit != none)
+    {
+      returnIf(isBitSet("m_haveExecuted", max1Bit), nothing);
+    }
+    if (isSourceState)
+    {
+      returnIf(isBitSet("m_isPaused", source.bit), nothing);
+    }
+    string const guards{this->guards(transition, "")};
+    if (!guards.empty())
+    {
+      returnIf("!(" + guards + ")", nothing);
+    }
+    generateSpecs(out, transition, "", "    ");
+    if (max1Bit != none)
+    {
+      out << "    " << setBit("m_haveExecuted", max1Bit) << "\n";
+    }
+    if (isSourceState)
+    {
+      out
+        << "    finalizeState" << transition.source << "();\n"
+        << "    " << clearBit("m_isFrozen", source.bit) << "\n";
+    }
+    generateExternalPart(out, transition);
+    break;
+  }
+
+  case ImageFormat::TransitionKind::STEP:
+  {
+    out
+      << "  // Step transition " << id << " from " << source.path
+      << " to " << m_components[transition.target].path << ".\n"
+      << "  ExecStat\n"
+      << "  transition" << id << "()\n"
+      << "  {\n";
+    char const * const nothing{"ExecStat{false, noRegion}"};
+    if (triggers.empty())
+    {
+      out << "    return " << nothing << ";\n";
+      break;
+    }
+    if (isSourceState)
+    {
+      returnIf(isBitSet("m_isPaused", source.bit), nothing);
+    }
+    if (max1Bit != none)
+    {
+      returnIf(isBitSet("m_haveExecuted", max1Bit), nothing);
+    }
+    chooseTrigger(nothing);
+    if (max1Bit != none)
+    {
+      out << "    " << setBit("m_haveExecuted", max1Bit) << "\n";
+    }
+    generateSpecs(out, transition, "trigger", "    ");
+    if (isSourceState)
+    {
+      // The first freeze flag prevails, for the engine adds specs from the last one onwards.
+      uint32_t freezeDepth{none};
+      for (uint32_t specIdx{transition.firstSpec}; specIdx < transition.firstSpec + transition.nrOfSpecs; ++specIdx)
+      {
+        if ((m_specs[specIdx].kind == ImageFormat::SpecKind::FREEZE_FLAG) && (freezeDepth == none))
+        {
+          freezeDepth = m_specs[specIdx].arg;
+        }
+      }
+      if (freezeDepth == none)
+      {
+        out
+          << "    finalizeState" << transition.source << "();\n"
+          << "    " << clearBit("m_isFrozen", source.bit) << "\n";
+      }
+      else if (freezeDepth == FULL)
+      {
+        out
+          << "    " << setBit("m_isFrozen", source.bit) << "\n"
+          << "    " << clearBit("m_isFrozenShallowly", source.bit) << "\n";
+      }
+      else
+      {
+        for (auto const region : source.regions)
+        {
+          out << "    finalizeRegion" << m_regions[region].id << "();\n";
+        }
+        out
+          << "    " << setBit("m_isFrozen", source.bit) << "\n"
+          << "    " << setBit("m_isFrozenShallowly", source.bit) << "\n";
+      }
+    }
+    generateExternalPart(out, transition);
+    break;
+  }
+
+  case ImageFormat::TransitionKind::INTERNAL_AUTO:
+  {
+    out
+      << "  // Internal auto transition " << id << " of " << source.path << ".\n"
+      << "  bool\n"
+      << "  transition" << id << "()\n"
+      << "  {\n";
+    if (max1Bit != none)
+    {
+      returnIf(isBitSet("m_haveExecuted", max1Bit), "false");
+      out << "    " << setBit("m_haveExecuted", max1Bit) << "\n";
+    }
+    string const guards{this->guards(transition, "")};
+    if (!guards.empty())
+    {
+      returnIf("!(" + guards + ")", "false");
+    }
+    generateSpecs(out, transition, "", "    ");
+    out << "    return true;\n";
+    break;
+  }
+
+  case ImageFormat::TransitionKind::INTERNAL_STEP:
+  {
+    out
+      << "  // Internal step transition " << id << " of " << source.path << ".\n"
+      << "  bool\n"
+      << "  transition" << id << "()\n"
+      << "  {\n";
+    if (triggers.empty())
+    {
+      out << "    return false;\n";
+      break;
+    }
+    if (max1Bit != none)
+    {
+      returnIf(isBitSet("m_haveExecuted", max1Bit), "false");
+    }
+    chooseTrigger("false");
+    if (max1Bit != none)
+    {
+      out << "    " << setBit("m_haveExecuted", max1Bit) << "\n";
+    }
+    generateSpecs(out, transition, "trigger", "    ");
+    out << "    return true;\n";
+    break;
+  }
+
+  default:
+    // Enter and exit transitions are part of entering and exiting their hosts.
+    return;
+  }
+  out
+    << "  }\n"
+    << "\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateExternalPart(ostream & out, ImageFormat::Transition const & transition)
+const
+{
+  vector<uint32_t> const exitRegions{this->exitRegions(transition)};
+  for (auto const exitRegion : exitRegions)
+  {
+    Image::Idx const parentState{m_regions[exitRegion].parent};
+    for (auto const region : m_components[parentState].regions)
+    {
+      if ((region != exitRegion) || (transition.target == parentState))
+      {
+        out << "    finalizeRegion" << m_regions[region].id << "();\n";
+      }
+    }
+    out << "    exitState" << parentState << "();\n";
+  }
+  for (auto const entryRegion : entryRegions(transition))
+  {
+    Image::Idx const parentState{m_regions[entryRegion].parent};
+    out
+      << "    " << current(m_regions[m_components[parentState].region]) << " = " << state(parentState) << ";\n"
+      << "    enterState" << parentState << "();\n";
+    for (auto const region : m_components[parentState].regions)
+    {
+      if (region != entryRegion)
+      {
+        out << "    initRegion" << m_regions[region].id << "();\n";
+      }
+    }
+  }
+  Region const & targetRegion{m_regions[m_components[transition.target].region]};
+  out << "    " << current(targetRegion) << " = " << state(transition.target) << ";\n";
+  generateInit(out, transition.target);
+  out
+    << "    return ExecStat{true, "
+    << (exitRegions.empty() ? string{"noRegion"} : to_string(targetRegion.id)) << "};\n";
+}
+
+void
+ImageCodeGeneratorImpl
+::generateSpecs
+(
+  ostream & out
+, ImageFormat::Transition const & transition
+, string const & trigger
+, char const * const indent
+)
+const
+{
+  // Outputs come before actions, each in the order of the image.
+  for (auto const specKind : {ImageFormat::SpecKind::OUTPUT, ImageFormat::SpecKind::ACTION})
+  {
+    for (uint32_t specIdx{transition.firstSpec}; specIdx < transition.firstSpec + transition.nrOfSpecs; ++specIdx)
+    {
+      ImageFormat::Spec const & spec{m_specs[specIdx]};
+      if (spec.kind != specKind)
+      {
+        continue;
+      }
+      if (specKind == ImageFormat::SpecKind::OUTPUT)
+      {
+        out << indent << setBit("m_isActive", m_components[spec.arg].bit) << "\n";
+      }
+      else
+      {
+        out << indent << "m_bindings.action(" << spec.arg << (trigger.empty() ? "" : ", ") << trigger << ");\n";
+      }
+    }
+  }
+}
+
+void
+ImageCodeGeneratorImpl
+::generateBoundaryTransitions(ostream & out, vector<Image::Idx> const & transitions)
+const
+{
+  if (transitions.empty())
+  {
+    out << "    // This space intentionally left empty\n";
+  }
+  for (auto const idx : transitions)
+  {
+    ImageFormat::Transition const & transition{m_transitions[idx]};
+    string const guards{this->guards(transition, "")};
+    char const * const kind{(transition.kind == ImageFormat::TransitionKind::ENTER) ? "Enter" : "Exit"};
+    out << "    // " << kind << " transition " << idx << ".\n";
+    if (!guards.empty())
+    {
+      out << "    if (" << guards << ")\n";
+    }
+    out << "    {\n";
+    generateSpecs(out, transition, "", "      ");
+    out << "    }\n";
+  }
+}
+
+void
+ImageCodeGeneratorImpl
+::generateInit(ostream & out, Image::Idx const idx)
+const
+{
+  // Only states do anything on being initialized.
+  if (m_components[idx].kind == ImageFormat::ComponentKind::STATE)
+  {
+    out << "    initState" << idx << "();\n";
+  }
+}
+
+string
+ImageCodeGeneratorImpl
+::guards(ImageFormat::Transition const & transition, string const & trigger)
+const
+{
+  // Completion flags are guards of their own, which take effect at their positions among the guards.
+  string guards{};
+  for (uint32_t specIdx{transition.firstSpec}; specIdx < transition.firstSpec + transition.nrOfSpecs; ++specIdx)
+  {
+    ImageFormat::Spec const & spec{m_specs[specIdx]};
+    string term{};
+    if (spec.kind == ImageFormat::SpecKind::GUARD)
+    {
+      term = "m_bindings.guard(" + to_string(spec.arg) + (trigger.empty() ? "" : ", ") + trigger + ")";
+    }
+    else if (spec.kind == ImageFormat::SpecKind::COMPLETION_FLAG)
+    {
+      term = "(" + hasTerminated(transition.source) + ")";
+    }
+    else
+    {
+      continue;
+    }
+    guards += (guards.empty() ? "" : " && ") + term;
+  }
+  return guards;
+}
+
+string
+ImageCodeGeneratorImpl
+::hasTerminated(Image::Idx const idx)
+const
+{
+  Component const & component{m_components[idx]};
+  if ((component.kind != ImageFormat::ComponentKind::STATE) || component.regions.empty())
+  {
+    return "true";
+  }
+  string hasTerminated{};
+  for (auto const region : component.regions)
+  {
+    hasTerminated += (hasTerminated.empty() ? "" : " && ") + this->hasTerminated(m_regions[region]);
+  }
+  return hasTerminated;
+}
+
+string
+ImageCodeGeneratorImpl
+::hasTerminated(Region const & region)
+const
+{
+  string hasTerminated{};
+  for (auto const subState : region.subStates)
+  {
+    if (m_components[subState].kind == ImageFormat::ComponentKind::FINAL)
+    {
+      hasTerminated += (hasTerminated.empty() ? "" : " || ") + ("(" + current(region) + " == " + state(subState) + ")");
+    }
+  }
+  return hasTerminated.empty() ? "false" : "(" + hasTerminated + ")";
+}
+
+string
+ImageCodeGeneratorImpl
+::current(Region const & region)
+const
+{
+  return "m_current_" + region.identifier;
+}
+
+string
+ImageCodeGeneratorImpl
+::state(Image::Idx const idx)
+const
+{
+  return "State::" + m_components[idx].identifier;
+}
+
+string
+ImageCodeGeneratorImpl
+::signal(Image::Idx const idx)
+const
+{
+  return "Signal::" + m_components[idx].identifier;
+}
+
+string
+ImageCodeGeneratorImpl
+::isBitSet(char const * const flags, uint32_t const bit)
+{
+  return "(" + word(flags, bit) + " & " + mask(bit) + ") != 0";
+}
+
+string
+ImageCodeGeneratorImpl
+::isBitClear(char const * const flags, uint32_t const bit)
+{
+  return "(" + word(flags, bit) + " & " + mask(bit) + ") == 0";
+}
+
+string
+ImageCodeGeneratorImpl
+::setBit(char const * const flags, uint32_t const bit)
+{
+  return word(flags, bit) + " |= " + mask(bit) + ";";
+}
+
+string
+ImageCodeGeneratorImpl
+::clearBit(char const * const flags, uint32_t const bit)
+{
+  return word(flags, bit) + " &= ~" + mask(bit) + ";";
+}
+
+size_t
+ImageCodeGeneratorImpl
+::nrOfWords(uint32_t const nrOfBits)
+{
+  // Arrays of no words at all are not valid C++.
+  return max(size_t{1}, (size_t{nrOfBits} + 63) / 64);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
@@ -0,0 +1,133 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGECODEGENERATORIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGECODEGENERATORIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ImageFormat.h"
+
+namespace state_diagram
+{
+
+class ImageImpl;
+
+class ImageCodeGeneratorImpl
+{
+public:
+  ImageCodeGeneratorImpl(ImageImpl const * const image, string const & className);
+  ImageCodeGeneratorImpl(ImageCodeGeneratorImpl const &) = delete;
+
+  void operator=(ImageCodeGeneratorImpl const &) = delete;
+
+  string const & code() const;
+  void write(char const * const path) const;
+
+private:
+  static uint32_t constexpr none{UINT32_MAX};
+
+  // Components are held by their indices within the image. States and signals additionally have dense bit numbers,
+  // by which the generated code keeps their runtime flags in arrays of words.
+  struct Component
+  {
+    ImageFormat::ComponentKind kind;
+    Image::Idx parent;
+    uint32_t region;
+    uint32_t defaultRegion;
+    vector<uint32_t> regions;
+    uint32_t bit;
+    string identifier;
+    string path;
+    vector<Image::Idx> autoTransitions;
+    vector<Image::Idx> stepTransitions;
+    vector<Image::Idx> enterTransitions;
+    vector<Image::Idx> exitTransitions;
+    vector<Image::Idx> internalTransitions;
+  };
+
+  // Regions are held by dense numbers of their own, since default regions have no index within the image.
+  // The ID of a region is the value of its enumerator, which is the index of its parent for default regions.
+  struct Region
+  {
+    Image::Idx id;
+    Image::Idx parent;
+    Image::Idx init;
+    vector<Image::Idx> subStates;
+    string identifier;
+    string path;
+  };
+
+  void model(ImageImpl const * const image);
+  void addComponent(ImageImpl const * const image, Image::Idx const idx);
+  void addTransition(ImageImpl const * const image, Image::Idx const idx);
+  uint32_t regionWithin(Image::Idx const parent);
+  void nameIdentifiers();
+  bool isDeepMemberOf(Image::Idx const subState, uint32_t const region) const;
+  vector<uint32_t> exitRegions(ImageFormat::Transition const & transition) const;
+  vector<uint32_t> entryRegions(ImageFormat::Transition const & transition) const;
+
+  void generate(ostream & out, string const & className) const;
+  void generatePublic(ostream & out, string const & className) const;
+  void generateRegion(ostream & out, Region const & region) const;
+  void generateState(ostream & out, Image::Idx const idx) const;
+  void generateSource(ostream & out, Image::Idx const idx) const;
+  void generateTransition(ostream & out, Image::Idx const idx) const;
+  void generateExternalPart(ostream & out, ImageFormat::Transition const & transition) const;
+  void
+  generateSpecs
+  (
+    ostream & out
+  , ImageFormat::Transition const & transition
+  , string const & trigger
+  , char const * const indent
+  )
+  const;
+  void generateBoundaryTransitions(ostream & out, vector<Image::Idx> const & transitions) const;
+  void generateInit(ostream & out, Image::Idx const idx) const;
+
+  string guards(ImageFormat::Transition const & transition, string const & trigger) const;
+  string hasTerminated(Image::Idx const idx) const;
+  string hasTerminated(Region const & region) const;
+  string current(Region const & region) const;
+  string state(Image::Idx const idx) const;
+  string signal(Image::Idx const idx) const;
+
+  static string isBitSet(char const * const flags, uint32_t const bit);
+  static string isBitClear(char const * const flags, uint32_t const bit);
+  static string setBit(char const * const flags, uint32_t const bit);
+  static string clearBit(char const * const flags, uint32_t const bit);
+  static size_t nrOfWords(uint32_t const nrOfBits);
+
+  string m_topName;
+  vector<Component> m_components;
+  vector<Region> m_regions;
+  vector<ImageFormat::Transition> m_transitions;
+  vector<ImageFormat::Spec> m_specs;
+  vector<uint32_t> m_max1Bits;
+  uint32_t m_nrOfStateBits;
+  uint32_t m_nrOfSignalBits;
+  uint32_t m_nrOfMax1Bits;
+  string m_code;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGECODEGENERATORIMPL_H_
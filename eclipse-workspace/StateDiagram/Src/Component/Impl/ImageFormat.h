@@ -0,0 +1,142 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGEFORMAT_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGEFORMAT_H_
+
+#include <cstdint>
+#include <type_traits>
+
+namespace state_diagram
+{
+
+using namespace std;
+
+// An image starts with a header, which is followed by sections of fixed size records, all of them at offsets
+// from the start of the image. Names are kept in a section of characters and are referred to by offset and length.
+// Nothing in an image is a pointer, so that it can be used wherever it happens to be mapped.
+class ImageFormat
+{
+public:
+  static uint32_t constexpr magic{0x4d494453}; // "SDIM", as stored on a little-endian host
+  static uint32_t constexpr version{1};
+
+  class String
+  {
+  public:
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  class Section
+  {
+  public:
+    uint32_t offset;
+    uint32_t count;
+  };
+
+  class Header
+  {
+  public:
+    uint32_t magic;
+    uint32_t version;
+    uint64_t size;
+    String topName;
+    Section chars;
+    Section components;
+    Section transitions;
+    Section specs;
+  };
+
+  enum class ComponentKind : uint32_t
+  {
+    TOP
+  , REGION
+  , INIT
+  , FINAL
+  , STATE
+  , CONNECTOR
+  , EXTERNAL_SIGNAL
+  , LOCAL_SIGNAL
+  , EXTERNAL_VAR
+  , LOCAL_VAR
+  , END
+  };
+
+  class Component
+  {
+  public:
+    ComponentKind kind;
+    uint32_t parent;
+    String name;
+    uint32_t typeId;
+  };
+
+  enum class TransitionKind : uint32_t
+  {
+    AUTO
+  , STEP
+  , ENTER
+  , EXIT
+  , INTERNAL_STEP
+  , INTERNAL_AUTO
+  , END
+  };
+
+  // Single-state transitions have their host as both source and target.
+  class Transition
+  {
+  public:
+    TransitionKind kind;
+    uint32_t source;
+    uint32_t target;
+    uint32_t firstSpec;
+    uint32_t nrOfSpecs;
+  };
+
+  enum class SpecKind : uint32_t
+  {
+    TRIGGER
+  , AFTER
+  , AT
+  , GUARD
+  , ACTION
+  , OUTPUT
+  , BOUND_OUTPUT
+  , FREEZE_FLAG
+  , MAX1_FLAG
+  , COMPLETION_FLAG
+  , END
+  };
+
+  // The argument is a component index, a slot ID or a freeze depth, the ticks are nanoseconds of a timer spec.
+  class Spec
+  {
+  public:
+    SpecKind kind;
+    uint32_t arg;
+    int64_t ticks;
+  };
+
+  static_assert(is_trivially_copyable_v<Header> && (sizeof(Header) == 56));
+  static_assert(is_trivially_copyable_v<Component> && (sizeof(Component) == 20));
+  static_assert(is_trivially_copyable_v<Transition> && (sizeof(Transition) == 20));
+  static_assert(is_trivially_copyable_v<Spec> && (sizeof(Spec) == 16));
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGEFORMAT_H_
@@ -0,0 +1,334 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ImageImpl.h"
+
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace state_diagram
+{
+
+ImageImpl
+::ImageImpl(char const * const path)
+:
+  m_bytes{nullptr}
+, m_size{0}
+, m_isMapped{false}
+{
+  int const fd{open(path, O_RDONLY)};
+  struct stat status;
+  if ((fd < 0) || (fstat(fd, &status) != 0))
+  {
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+#ifndef STATE_DIAGRAM_STRINGLESS
+    throw Image::FileError(path);
+#else
+    STATE_DIAGRAM_HANDLE_ERROR(Image::fileError);
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+  m_size = static_cast<size_t>(status.st_size);
+  if (m_size > 0)
+  {
+    // Mapping privately and read-only shares the pages with every other process that maps the same file.
+    void * const bytes{mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    close(fd);
+    if (bytes == MAP_FAILED)
+    {
+#ifndef STATE_DIAGRAM_STRINGLESS
+      throw Image::FileError(path);
+#else
+      STATE_DIAGRAM_HANDLE_ERROR(Image::fileError);
+#endif // STATE_DIAGRAM_STRINGLESS
+    }
+    m_bytes = static_cast<char const *>(bytes);
+    m_isMapped = true;
+  }
+  else
+  {
+    close(fd);
+  }
+  try
+  {
+    validate();
+  }
+  catch (...)
+  {
+    if (m_isMapped)
+    {
+      munmap(const_cast<char *>(m_bytes), m_size);
+    }
+    throw;
+  }
+}
+
+ImageImpl
+::ImageImpl(void const * const bytes, size_t const size)
+:
+  m_bytes{static_cast<char const *>(bytes)}
+, m_size{size}
+, m_isMapped{false}
+{
+  validate();
+}
+
+ImageImpl
+::~ImageImpl()
+{
+  if (m_isMapped)
+  {
+    munmap(const_cast<char *>(m_bytes), m_size);
+  }
+}
+
+size_t
+ImageImpl
+::size()
+const
+{
+  return m_size;
+}
+
+ImageFormat::Header const &
+ImageImpl
+::header()
+const
+{
+  return *reinterpret_cast<ImageFormat::Header const *>(m_bytes);
+}
+
+ImageFormat::Component const &
+ImageImpl
+::component(uint32_t const idx)
+const
+{
+  return records<ImageFormat::Component>(header().components)[idx];
+}
+
+ImageFormat::Transition const &
+ImageImpl
+::transition(uint32_t const idx)
+const
+{
+  return records<ImageFormat::Transition>(header().transitions)[idx];
+}
+
+ImageFormat::Spec const &
+ImageImpl
+::spec(uint32_t const idx)
+const
+{
+  return records<ImageFormat::Spec>(header().specs)[idx];
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+string
+ImageImpl
+::str(ImageFormat::String const & name)
+const
+{
+  return string(m_bytes + header().chars.offset + name.offset, name.length);
+}
+#endif // STATE_DIAGRAM_STRINGLESS
+
+void
+ImageImpl
+::validate()
+const
+{
+  using Kind = ImageFormat::ComponentKind;
+
+  // Every check is made before anything it guards is read, so that no malformed image is read out of bounds.
+  check(m_size >= sizeof(ImageFormat::Header), "the image is shorter than its header");
+  check(reinterpret_cast<uintptr_t>(m_bytes) % alignof(ImageFormat::Header) == 0, "the image is not aligned to 8 bytes");
+  ImageFormat::Header const & header{this->header()};
+  check(header.magic == ImageFormat::magic, "the magic number does not match, the image may stem from a host of other byte order");
+  check(header.version == ImageFormat::version, "the format version is not supported");
+  check(header.size == m_size, "the size of the image differs from the size recorded in its header");
+  check
+  (
+    isSection(header.chars, 1, 1)
+    && isSection(header.components, sizeof(ImageFormat::Component), alignof(ImageFormat::Component))
+    && isSection(header.transitions, sizeof(ImageFormat::Transition), alignof(ImageFormat::Transition))
+    && isSection(header.specs, sizeof(ImageFormat::Spec), alignof(ImageFormat::Spec))
+  , "a section lies outside of the image"
+  );
+  check(isString(header.topName), "the name of the top state lies outside of the characters");
+  check(isKind(Image::topIdx, {Kind::TOP}), "the first component is not the top state");
+
+  for (uint32_t idx{1}; idx < header.components.count; ++idx)
+  {
+    ImageFormat::Component const & component{this->component(idx)};
+    check(component.parent < idx, "a component precedes its parent");
+    check(isString(component.name), "the name of a component lies outside of the characters");
+    switch (component.kind)
+    {
+    case Kind::REGION:
+      check(isKind(component.parent, {Kind::TOP, Kind::STATE}), "a region has a parent other than a compound state");
+      break;
+
+    case Kind::INIT:
+    case Kind::FINAL:
+    case Kind::STATE:
+    case Kind::CONNECTOR:
+    case Kind::LOCAL_SIGNAL:
+    case Kind::LOCAL_VAR:
+      check
+      (
+        isKind(component.parent, {Kind::TOP, Kind::STATE, Kind::REGION})
+      , "a component has a parent other than a compound state or a region"
+      );
+      break;
+
+    case Kind::EXTERNAL_SIGNAL:
+    case Kind::EXTERNAL_VAR:
+      check(component.parent == Image::topIdx, "an external signal or variable has a parent other than the top state");
+      break;
+
+    default:
+      check(false, "a component is of unknown kind");
+    }
+  }
+
+  for (uint32_t idx{0}; idx < header.transitions.count; ++idx)
+  {
+    ImageFormat::Transition const & transition{this->transition(idx)};
+    switch (transition.kind)
+    {
+    case ImageFormat::TransitionKind::AUTO:
+    case ImageFormat::TransitionKind::STEP:
+      check
+      (
+        isKind(transition.source, {Kind::INIT, Kind::STATE, Kind::CONNECTOR})
+        && isKind(transition.target, {Kind::FINAL, Kind::STATE, Kind::CONNECTOR})
+      , "a transition has a source other than a source state or a target other than a target state"
+      );
+      break;
+
+    case ImageFormat::TransitionKind::ENTER:
+    case ImageFormat::TransitionKind::EXIT:
+    case ImageFormat::TransitionKind::INTERNAL_STEP:
+    case ImageFormat::TransitionKind::INTERNAL_AUTO:
+      check
+      (
+        isKind(transition.source, {Kind::STATE}) && (transition.target == transition.source)
+      , "a single-state transition has a host other than a regular state"
+      );
+      break;
+
+    default:
+      check(false, "a transition is of unknown kind");
+    }
+    check
+    (
+      uint64_t{transition.firstSpec} + transition.nrOfSpecs <= header.specs.count
+    , "the specs of a transition lie outside of the specs"
+    );
+  }
+
+  for (uint32_t idx{0}; idx < header.specs.count; ++idx)
+  {
+    ImageFormat::Spec const & spec{this->spec(idx)};
+    switch (spec.kind)
+    {
+    case ImageFormat::SpecKind::TRIGGER:
+      check(isKind(spec.arg, {Kind::EXTERNAL_SIGNAL, Kind::LOCAL_SIGNAL}), "a trigger spec refers to something other than a signal");
+      break;
+
+    case ImageFormat::SpecKind::OUTPUT:
+      check(isKind(spec.arg, {Kind::LOCAL_SIGNAL}), "an output spec refers to something other than a local signal");
+      break;
+
+    case ImageFormat::SpecKind::FREEZE_FLAG:
+      check((spec.arg == FULL) || (spec.arg == SHALLOW), "a freeze flag is of unknown depth");
+      break;
+
+    case ImageFormat::SpecKind::AFTER:
+    case ImageFormat::SpecKind::AT:
+    case ImageFormat::SpecKind::GUARD:
+    case ImageFormat::SpecKind::ACTION:
+    case ImageFormat::SpecKind::BOUND_OUTPUT:
+    case ImageFormat::SpecKind::MAX1_FLAG:
+    case ImageFormat::SpecKind::COMPLETION_FLAG:
+      break;
+
+    default:
+      check(false, "a spec is of unknown kind");
+    }
+  }
+}
+
+void
+ImageImpl
+::check(bool const condition, char const * const reason)
+const
+{
+  if (!condition)
+  {
+#ifndef STATE_DIAGRAM_STRINGLESS
+    throw Image::FormatError(reason);
+#else
+    static_cast<void>(reason);
+    STATE_DIAGRAM_HANDLE_ERROR(Image::formatError);
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+}
+
+bool
+ImageImpl
+::isSection(ImageFormat::Section const & section, size_t const recordSize, size_t const alignment)
+const
+{
+  return
+    (section.offset % alignment == 0)
+    && (section.offset >= sizeof(ImageFormat::Header))
+    && (uint64_t{section.offset} + uint64_t{section.count} * recordSize <= m_size);
+}
+
+bool
+ImageImpl
+::isString(ImageFormat::String const & name)
+const
+{
+  return uint64_t{name.offset} + name.length <= header().chars.count;
+}
+
+bool
+ImageImpl
+::isKind(uint32_t const idx, initializer_list<ImageFormat::ComponentKind> const kinds)
+const
+{
+  if (idx >= header().components.count)
+  {
+    return false;
+  }
+  for (auto const kind : kinds)
+  {
+    if (component(idx).kind == kind)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace state_diagram
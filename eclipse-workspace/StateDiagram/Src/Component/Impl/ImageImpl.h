@@ -0,0 +1,71 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGEIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGEIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstddef>
+#include <initializer_list>
+
+#include "ImageFormat.h"
+
+namespace state_diagram
+{
+
+class ImageImpl
+{
+public:
+  ImageImpl(char const * const path);
+  ImageImpl(void const * const bytes, size_t const size);
+  ImageImpl(ImageImpl const &) = delete;
+  ~ImageImpl();
+
+  void operator=(ImageImpl const &) = delete;
+
+  size_t size() const;
+  ImageFormat::Header const & header() const;
+  ImageFormat::Component const & component(uint32_t const idx) const;
+  ImageFormat::Transition const & transition(uint32_t const idx) const;
+  ImageFormat::Spec const & spec(uint32_t const idx) const;
+#ifndef STATE_DIAGRAM_STRINGLESS
+  string str(ImageFormat::String const & name) const;
+#endif // STATE_DIAGRAM_STRINGLESS
+
+private:
+  void validate() const;
+  void check(bool const condition, char const * const reason) const;
+  bool isSection(ImageFormat::Section const & section, size_t const recordSize, size_t const alignment) const;
+  bool isString(ImageFormat::String const & name) const;
+  bool isKind(uint32_t const idx, initializer_list<ImageFormat::ComponentKind> const kinds) const;
+
+  template<class Record>
+  Record const *
+  records(ImageFormat::Section const & section)
+  const
+  {
+    return reinterpret_cast<Record const *>(m_bytes + section.offset);
+  }
+
+  char const * m_bytes;
+  size_t m_size;
+  bool m_isMapped;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGEIMPL_H_
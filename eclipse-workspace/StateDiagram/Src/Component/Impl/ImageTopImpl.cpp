@@ -0,0 +1,654 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ImageTopImpl.h"
+
+#include "Arena.h"
+#include "ImageBindingsImpl.h"
+#include "ImageImpl.h"
+
+namespace state_diagram
+{
+
+namespace
+{
+  template<class C>
+  void
+  destructAt(void * const at)
+  {
+    static_cast<C *>(at)->~C();
+  }
+
+  size_t
+  alignUp(size_t const offset, size_t const alignment)
+  {
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+}
+
+ImageTopImpl
+::ImageTopImpl(ImageImpl const * const image, ImageBindingsImpl const * const bindings)
+:
+  m_top{STATE_DIAGRAM_STRING_ARG(image->str(image->header().topName))}
+, m_components{}
+, m_transitions{}
+{
+  try
+  {
+    load(image, bindings);
+  }
+  catch (...)
+  {
+    destruct();
+    throw;
+  }
+}
+
+ImageTopImpl
+::~ImageTopImpl()
+{
+  destruct();
+}
+
+Top const &
+ImageTopImpl
+::top()
+const
+{
+  return m_top;
+}
+
+SubState const &
+ImageTopImpl
+::subState(Image::Idx const idx)
+const
+{
+  ImageFormat::ComponentKind const kind{(idx < m_components.size()) ? m_components[idx].kind : ImageFormat::ComponentKind::END};
+  if
+  (
+    (kind != ImageFormat::ComponentKind::INIT)
+    && (kind != ImageFormat::ComponentKind::FINAL)
+    && (kind != ImageFormat::ComponentKind::STATE)
+    && (kind != ImageFormat::ComponentKind::CONNECTOR)
+  )
+  {
+    throwComponentError(idx, "a sub-state");
+  }
+  void * const at{m_components[idx].at};
+  switch (kind)
+  {
+  case ImageFormat::ComponentKind::INIT:
+    return *static_cast<Init const *>(at);
+
+  case ImageFormat::ComponentKind::FINAL:
+    return *static_cast<Final const *>(at);
+
+  case ImageFormat::ComponentKind::STATE:
+    return *static_cast<State const *>(at);
+
+  default:
+    return *static_cast<Connector const *>(at);
+  }
+}
+
+ExternalEvent const &
+ImageTopImpl
+::externalEvent(Image::Idx const idx)
+const
+{
+  if ((idx >= m_components.size()) || (m_components[idx].kind != ImageFormat::ComponentKind::EXTERNAL_SIGNAL))
+  {
+    throwComponentError(idx, "an external signal");
+  }
+  return *m_components[idx].externalEvent;
+}
+
+void *
+ImageTopImpl
+::component
+(
+  Image::Idx const idx
+, ImageFormat::ComponentKind const kind
+, PayloadTypeId const payloadType
+, char const * const expected
+)
+const
+{
+  if
+  (
+    (idx >= m_components.size())
+    || (m_components[idx].kind != kind)
+    || (m_components[idx].payloadType != payloadType)
+  )
+  {
+    throwComponentError(idx, expected);
+  }
+  return m_components[idx].at;
+}
+
+void
+ImageTopImpl
+::load(ImageImpl const * const image, ImageBindingsImpl const * const bindings)
+{
+  ImageFormat::Header const & header{image->header()};
+
+  // Everything is laid out, and every binding is looked up, before anything is constructed, so that an image
+  // with unbound IDs is rejected as a whole.
+  vector<Layout> layouts;
+  layouts.reserve(header.components.count + header.transitions.count);
+  for (Image::Idx idx{0}; idx < header.components.count; ++idx)
+  {
+    layouts.push_back(layOut(image, bindings, idx));
+  }
+  for (Image::Idx idx{0}; idx < header.transitions.count; ++idx)
+  {
+    layouts.push_back(layOut(image->transition(idx)));
+  }
+  for (Image::Idx idx{0}; idx < header.specs.count; ++idx)
+  {
+    checkBound(image->spec(idx), bindings);
+  }
+
+  size_t size{0};
+  size_t alignment{alignof(max_align_t)};
+  for (auto const & layout : layouts)
+  {
+    size = alignUp(size, layout.alignment) + layout.size;
+    alignment = max(alignment, layout.alignment);
+  }
+
+  // All components and transitions share a single block, whose memory is released along with the top state.
+  // So are the implementations that they allocate while being constructed.
+  ArenaScope const arenaScope{m_top};
+  char * const block{static_cast<char *>(Arena::current->allocate(size, alignment))};
+  size_t offset{0};
+  auto const place
+  {
+    [&](Layout const & layout)->void *
+    {
+      offset = alignUp(offset, layout.alignment);
+      void * const at{block + offset};
+      offset += layout.size;
+      return at;
+    }
+  };
+
+  m_components.reserve(header.components.count);
+  m_components.push_back(Component{ImageFormat::ComponentKind::TOP, nullptr, nullptr, nullptr, nullptr, nullptr});
+  for (Image::Idx idx{1}; idx < header.components.count; ++idx)
+  {
+    constructComponent(image, bindings, idx, place(layouts[idx]));
+  }
+  m_transitions.reserve(header.transitions.count);
+  for (Image::Idx idx{0}; idx < header.transitions.count; ++idx)
+  {
+    ImageFormat::Transition const & record{image->transition(idx)};
+    Transition const & transition{constructTransition(record, place(layouts[header.components.count + idx]))};
+    // Specs are added from the last one onwards, just like the constructors of transitions add theirs, so that
+    // they are held in the order of the image.
+    for (uint32_t specIdx{record.firstSpec + record.nrOfSpecs}; specIdx > record.firstSpec; --specIdx)
+    {
+      addSpec(transition, image->spec(specIdx - 1), bindings);
+    }
+  }
+}
+
+ImageTopImpl::Layout
+ImageTopImpl
+::layOut(ImageImpl const * const image, ImageBindingsImpl const * const bindings, Image::Idx const idx)
+const
+{
+  ImageFormat::Component const & record{image->component(idx)};
+  switch (record.kind)
+  {
+  case ImageFormat::ComponentKind::REGION:
+    return Layout{sizeof(Region), alignof(Region)};
+
+  case ImageFormat::ComponentKind::INIT:
+    return Layout{sizeof(Init), alignof(Init)};
+
+  case ImageFormat::ComponentKind::FINAL:
+    return Layout{sizeof(Final), alignof(Final)};
+
+  case ImageFormat::ComponentKind::STATE:
+    return Layout{sizeof(State), alignof(State)};
+
+  case ImageFormat::ComponentKind::CONNECTOR:
+    return Layout{sizeof(Connector), alignof(Connector)};
+
+  case ImageFormat::ComponentKind::EXTERNAL_SIGNAL:
+  {
+    auto const & signalType{bound(bindings->signalType(record.typeId), "signal type", record.typeId)};
+    return Layout{signalType.externalSize, signalType.externalAlignment};
+  }
+
+  case ImageFormat::ComponentKind::LOCAL_SIGNAL:
+  {
+    auto const & signalType{bound(bindings->signalType(record.typeId), "signal type", record.typeId)};
+    return Layout{signalType.localSize, signalType.localAlignment};
+  }
+
+  case ImageFormat::ComponentKind::EXTERNAL_VAR:
+  {
+    auto const & varType{bound(bindings->varType(record.typeId), "variable type", record.typeId)};
+    return Layout{varType.externalSize, varType.externalAlignment};
+  }
+
+  case ImageFormat::ComponentKind::LOCAL_VAR:
+  {
+    auto const & varType{bound(bindings->varType(record.typeId), "variable type", record.typeId)};
+    return Layout{varType.localSize, varType.localAlignment};
+  }
+
+  default:
+    return Layout{0, 1};
+  }
+}
+
+ImageTopImpl::Layout
+ImageTopImpl
+::layOut(ImageFormat::Transition const & transition)
+const
+{
+  switch (transition.kind)
+  {
+  case ImageFormat::TransitionKind::AUTO:
+    return Layout{sizeof(Auto), alignof(Auto)};
+
+  case ImageFormat::TransitionKind::STEP:
+    return Layout{sizeof(Step), alignof(Step)};
+
+  case ImageFormat::TransitionKind::ENTER:
+    return Layout{sizeof(Enter), alignof(Enter)};
+
+  case ImageFormat::TransitionKind::EXIT:
+    return Layout{sizeof(Exit), alignof(Exit)};
+
+  case ImageFormat::TransitionKind::INTERNAL_STEP:
+    return Layout{sizeof(InternalStep), alignof(InternalStep)};
+
+  default:
+    return Layout{sizeof(InternalAuto), alignof(InternalAuto)};
+  }
+}
+
+void
+ImageTopImpl
+::checkBound(ImageFormat::Spec const & spec, ImageBindingsImpl const * const bindings)
+const
+{
+  switch (spec.kind)
+  {
+  case ImageFormat::SpecKind::GUARD:
+    bound(bindings->guard(spec.arg), "guard slot", spec.arg);
+    break;
+
+  case ImageFormat::SpecKind::ACTION:
+    bound(bindings->action(spec.arg), "action slot", spec.arg);
+    break;
+
+  case ImageFormat::SpecKind::BOUND_OUTPUT:
+    bound(bindings->output(spec.arg), "output slot", spec.arg);
+    break;
+
+  default:
+    break;
+  }
+}
+
+void
+ImageTopImpl
+::constructComponent(ImageImpl const * const image, ImageBindingsImpl const * const bindings, Image::Idx const idx, void * const at)
+{
+  ImageFormat::Component const & record{image->component(idx)};
+  bool const isInRegion{image->component(record.parent).kind == ImageFormat::ComponentKind::REGION};
+#ifndef STATE_DIAGRAM_STRINGLESS
+  string const name{image->str(record.name)};
+#endif // STATE_DIAGRAM_STRINGLESS
+  Component component{record.kind, at, nullptr, nullptr, nullptr, nullptr};
+  switch (record.kind)
+  {
+  case ImageFormat::ComponentKind::REGION:
+    new (at) Region{STATE_DIAGRAM_STRING_ARG_COMMA(name) compoundState(record.parent)};
+    component.destruct = &destructAt<Region>;
+    break;
+
+  case ImageFormat::ComponentKind::INIT:
+    if (isInRegion)
+    {
+      new (at) Init{region(record.parent)};
+    }
+    else
+    {
+      new (at) Init{compoundState(record.parent)};
+    }
+    component.destruct = &destructAt<Init>;
+    break;
+
+  case ImageFormat::ComponentKind::FINAL:
+    if (isInRegion)
+    {
+      new (at) Final{region(record.parent)};
+    }
+    else
+    {
+      new (at) Final{compoundState(record.parent)};
+    }
+    component.destruct = &destructAt<Final>;
+    break;
+
+  case ImageFormat::ComponentKind::STATE:
+    if (isInRegion)
+    {
+      new (at) State{STATE_DIAGRAM_STRING_ARG_COMMA(name) region(record.parent)};
+    }
+    else
+    {
+      new (at) State{STATE_DIAGRAM_STRING_ARG_COMMA(name) compoundState(record.parent)};
+    }
+    component.destruct = &destructAt<State>;
+    break;
+
+  case ImageFormat::ComponentKind::CONNECTOR:
+    if (isInRegion)
+    {
+      new (at) Connector{STATE_DIAGRAM_STRING_ARG_COMMA(name) region(record.parent)};
+    }
+    else
+    {
+      new (at) Connector{STATE_DIAGRAM_STRING_ARG_COMMA(name) compoundState(record.parent)};
+    }
+    component.destruct = &destructAt<Connector>;
+    break;
+
+  case ImageFormat::ComponentKind::EXTERNAL_SIGNAL:
+  {
+    auto const & signalType{*bindings->signalType(record.typeId)};
+    component.externalEvent = signalType.constructExternal(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) m_top);
+    component.destruct = signalType.destructExternal;
+    component.payloadType = signalType.payloadType;
+    break;
+  }
+
+  case ImageFormat::ComponentKind::LOCAL_SIGNAL:
+  {
+    auto const & signalType{*bindings->signalType(record.typeId)};
+    component.localEvent =
+      isInRegion
+      ? signalType.constructLocalInRegion(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) region(record.parent))
+      : signalType.constructLocalInCompoundState(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) compoundState(record.parent));
+    component.destruct = signalType.destructLocal;
+    component.payloadType = signalType.payloadType;
+    break;
+  }
+
+  case ImageFormat::ComponentKind::EXTERNAL_VAR:
+  {
+    auto const & varType{*bindings->varType(record.typeId)};
+    varType.constructExternal(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) m_top);
+    component.destruct = varType.destructExternal;
+    component.payloadType = varType.payloadType;
+    break;
+  }
+
+  case ImageFormat::ComponentKind::LOCAL_VAR:
+  {
+    auto const & varType{*bindings->varType(record.typeId)};
+    if (isInRegion)
+    {
+      varType.constructLocalInRegion(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) region(record.parent));
+    }
+    else
+    {
+      varType.constructLocalInCompoundState(at, STATE_DIAGRAM_STRING_ARG_COMMA(name) compoundState(record.parent));
+    }
+    component.destruct = varType.destructLocal;
+    component.payloadType = varType.payloadType;
+    break;
+  }
+
+  default:
+    break;
+  }
+  m_components.push_back(component);
+}
+
+Transition const &
+ImageTopImpl
+::constructTransition(ImageFormat::Transition const & transition, void * const at)
+{
+  switch (transition.kind)
+  {
+  case ImageFormat::TransitionKind::AUTO:
+  {
+    Auto const * const constructed{new (at) Auto{sourceState(transition.source), targetState(transition.target)}};
+    m_transitions.push_back(Placement{at, &destructAt<Auto>});
+    return *constructed;
+  }
+
+  case ImageFormat::TransitionKind::STEP:
+  {
+    Step const * const constructed{new (at) Step{sourceState(transition.source), targetState(transition.target)}};
+    m_transitions.push_back(Placement{at, &destructAt<Step>});
+    return *constructed;
+  }
+
+  case ImageFormat::TransitionKind::ENTER:
+  {
+    Enter const * const constructed{new (at) Enter{state(transition.source)}};
+    m_transitions.push_back(Placement{at, &destructAt<Enter>});
+    return *constructed;
+  }
+
+  case ImageFormat::TransitionKind::EXIT:
+  {
+    Exit const * const constructed{new (at) Exit{state(transition.source)}};
+    m_transitions.push_back(Placement{at, &destructAt<Exit>});
+    return *constructed;
+  }
+
+  case ImageFormat::TransitionKind::INTERNAL_STEP:
+  {
+    InternalStep const * const constructed{new (at) InternalStep{state(transition.source)}};
+    m_transitions.push_back(Placement{at, &destructAt<InternalStep>});
+    return *constructed;
+  }
+
+  default:
+  {
+    InternalAuto const * const constructed{new (at) InternalAuto{state(transition.source)}};
+    m_transitions.push_back(Placement{at, &destructAt<InternalAuto>});
+    return *constructed;
+  }
+  }
+}
+
+void
+ImageTopImpl
+::addSpec(Transition const & transition, ImageFormat::Spec const & spec, ImageBindingsImpl const * const bindings)
+const
+{
+  switch (spec.kind)
+  {
+  case ImageFormat::SpecKind::TRIGGER:
+  {
+    Component const & signal{m_components[spec.arg]};
+    if (signal.kind == ImageFormat::ComponentKind::EXTERNAL_SIGNAL)
+    {
+      transition.add(Trigger{*signal.externalEvent});
+    }
+    else
+    {
+      transition.add(Trigger{*signal.localEvent});
+    }
+    break;
+  }
+
+  case ImageFormat::SpecKind::AFTER:
+    transition.add(After{Top::Duration{spec.ticks}});
+    break;
+
+  case ImageFormat::SpecKind::AT:
+    transition.add(At{Top::TimePoint{Top::Duration{spec.ticks}}});
+    break;
+
+  case ImageFormat::SpecKind::GUARD:
+    transition.add(*bindings->guard(spec.arg));
+    break;
+
+  case ImageFormat::SpecKind::ACTION:
+    transition.add(*bindings->action(spec.arg));
+    break;
+
+  case ImageFormat::SpecKind::OUTPUT:
+    transition.add(Output{*m_components[spec.arg].localEvent});
+    break;
+
+  case ImageFormat::SpecKind::BOUND_OUTPUT:
+    transition.add(*bindings->output(spec.arg));
+    break;
+
+  case ImageFormat::SpecKind::FREEZE_FLAG:
+    transition.add(FreezeFlag{static_cast<FreezeDepth>(spec.arg)});
+    break;
+
+  case ImageFormat::SpecKind::MAX1_FLAG:
+    transition.add(Max1Flag{});
+    break;
+
+  default:
+    transition.add(CompletionFlag{});
+    break;
+  }
+}
+
+void
+ImageTopImpl
+::destruct()
+{
+  // Transitions refer to components, and components to their parents, so everything goes in reverse order.
+  while (!m_transitions.empty())
+  {
+    m_transitions.back().destruct(m_transitions.back().at);
+    m_transitions.pop_back();
+  }
+  while (!m_components.empty())
+  {
+    if (m_components.back().destruct != nullptr)
+    {
+      m_components.back().destruct(m_components.back().at);
+    }
+    m_components.pop_back();
+  }
+}
+
+template<class Binding>
+Binding const &
+ImageTopImpl
+::bound(Binding const * const binding, char const * const idKind, uint32_t const id)
+{
+  if (binding == nullptr)
+  {
+#ifndef STATE_DIAGRAM_STRINGLESS
+    throw ImageTop::UnboundError(idKind, id);
+#else
+    static_cast<void>(idKind);
+    static_cast<void>(id);
+    STATE_DIAGRAM_HANDLE_ERROR(ImageTop::unboundError);
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+  return *binding;
+}
+
+CompoundState const &
+ImageTopImpl
+::compoundState(Image::Idx const idx)
+const
+{
+  if (idx == Image::topIdx)
+  {
+    return m_top;
+  }
+  return *static_cast<State const *>(m_components[idx].at);
+}
+
+Region const &
+ImageTopImpl
+::region(Image::Idx const idx)
+const
+{
+  return *static_cast<Region const *>(m_components[idx].at);
+}
+
+SourceState const &
+ImageTopImpl
+::sourceState(Image::Idx const idx)
+const
+{
+  switch (m_components[idx].kind)
+  {
+  case ImageFormat::ComponentKind::INIT:
+    return *static_cast<Init const *>(m_components[idx].at);
+
+  case ImageFormat::ComponentKind::STATE:
+    return *static_cast<State const *>(m_components[idx].at);
+
+  default:
+    return *static_cast<Connector const *>(m_components[idx].at);
+  }
+}
+
+TargetState const &
+ImageTopImpl
+::targetState(Image::Idx const idx)
+const
+{
+  switch (m_components[idx].kind)
+  {
+  case ImageFormat::ComponentKind::FINAL:
+    return *static_cast<Final const *>(m_components[idx].at);
+
+  case ImageFormat::ComponentKind::STATE:
+    return *static_cast<State const *>(m_components[idx].at);
+
+  default:
+    return *static_cast<Connector const *>(m_components[idx].at);
+  }
+}
+
+State const &
+ImageTopImpl
+::state(Image::Idx const idx)
+const
+{
+  return *static_cast<State const *>(m_components[idx].at);
+}
+
+void
+ImageTopImpl
+::throwComponentError(Image::Idx const idx, char const * const expected)
+const
+{
+#ifndef STATE_DIAGRAM_STRINGLESS
+  throw ImageTop::ComponentError(idx, expected);
+#else
+  static_cast<void>(idx);
+  static_cast<void>(expected);
+  STATE_DIAGRAM_HANDLE_ERROR(ImageTop::componentError);
+#endif // STATE_DIAGRAM_STRINGLESS
+}
+
+} // namespace state_diagram
@@ -0,0 +1,108 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGETOPIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGETOPIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "ImageFormat.h"
+
+namespace state_diagram
+{
+
+class ImageBindingsImpl;
+class ImageImpl;
+
+class ImageTopImpl
+{
+public:
+  ImageTopImpl(ImageImpl const * const image, ImageBindingsImpl const * const bindings);
+  ImageTopImpl(ImageTopImpl const &) = delete;
+  ~ImageTopImpl();
+
+  void operator=(ImageTopImpl const &) = delete;
+
+  Top const & top() const;
+  SubState const & subState(Image::Idx const idx) const;
+  ExternalEvent const & externalEvent(Image::Idx const idx) const;
+  void *
+  component
+  (
+    Image::Idx const idx
+  , ImageFormat::ComponentKind const kind
+  , PayloadTypeId const payloadType
+  , char const * const expected
+  )
+  const;
+
+private:
+  class Component
+  {
+  public:
+    ImageFormat::ComponentKind kind;
+    void * at;
+    void (* destruct)(void * const at);
+    PayloadTypeId payloadType;
+    ExternalEvent const * externalEvent;
+    LocalEvent const * localEvent;
+  };
+
+  class Placement
+  {
+  public:
+    void * at;
+    void (* destruct)(void * const at);
+  };
+
+  class Layout
+  {
+  public:
+    size_t size;
+    size_t alignment;
+  };
+
+  void load(ImageImpl const * const image, ImageBindingsImpl const * const bindings);
+  Layout layOut(ImageImpl const * const image, ImageBindingsImpl const * const bindings, Image::Idx const idx) const;
+  Layout layOut(ImageFormat::Transition const & transition) const;
+  void checkBound(ImageFormat::Spec const & spec, ImageBindingsImpl const * const bindings) const;
+  void
+  constructComponent(ImageImpl const * const image, ImageBindingsImpl const * const bindings, Image::Idx const idx, void * const at);
+  Transition const & constructTransition(ImageFormat::Transition const & transition, void * const at);
+  void addSpec(Transition const & transition, ImageFormat::Spec const & spec, ImageBindingsImpl const * const bindings) const;
+  void destruct();
+
+  template<class Binding>
+  static Binding const & bound(Binding const * const binding, char const * const idKind, uint32_t const id);
+
+  CompoundState const & compoundState(Image::Idx const idx) const;
+  Region const & region(Image::Idx const idx) const;
+  SourceState const & sourceState(Image::Idx const idx) const;
+  TargetState const & targetState(Image::Idx const idx) const;
+  State const & state(Image::Idx const idx) const;
+  void throwComponentError(Image::Idx const idx, char const * const expected) const;
+
+  Top const m_top;
+  vector<Component> m_components;
+  vector<Placement> m_transitions;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGETOPIMPL_H_
@@ -0,0 +1,179 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ImageWriterImpl.h"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+
+#include "ImageImpl.h"
+
+namespace state_diagram
+{
+
+namespace
+{
+  uint32_t
+  alignUp(size_t const offset, size_t const alignment)
+  {
+    return static_cast<uint32_t>((offset + alignment - 1) / alignment * alignment);
+  }
+}
+
+ImageWriterImpl
+::ImageWriterImpl(STATE_DIAGRAM_STRING_PARAM(topName))
+:
+  m_chars{}
+#ifndef STATE_DIAGRAM_STRINGLESS
+, m_strings{}
+#endif // STATE_DIAGRAM_STRINGLESS
+, m_topName{0, 0}
+, m_components{}
+, m_transitions{}
+, m_specs{}
+{
+#ifndef STATE_DIAGRAM_STRINGLESS
+  m_topName = intern(topName);
+#endif // STATE_DIAGRAM_STRINGLESS
+  m_components.push_back(ImageFormat::Component{ImageFormat::ComponentKind::TOP, Image::topIdx, m_topName, 0});
+}
+
+Image::Idx
+ImageWriterImpl
+::addComponent
+(
+  ImageFormat::ComponentKind const kind
+, STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent
+, uint32_t const typeId
+)
+{
+#ifndef STATE_DIAGRAM_STRINGLESS
+  ImageFormat::String const nameString{intern(name)};
+#else
+  ImageFormat::String const nameString{0, 0};
+#endif // STATE_DIAGRAM_STRINGLESS
+  m_components.push_back(ImageFormat::Component{kind, parent, nameString, typeId});
+  return static_cast<Image::Idx>(m_components.size() - 1);
+}
+
+Image::Idx
+ImageWriterImpl
+::addTransition(ImageFormat::TransitionKind const kind, Image::Idx const source, Image::Idx const target)
+{
+  m_transitions.push_back(ImageFormat::Transition{kind, source, target, 0, 0});
+  m_specs.emplace_back();
+  return static_cast<Image::Idx>(m_transitions.size() - 1);
+}
+
+void
+ImageWriterImpl
+::addSpec(Image::Idx const transition, ImageFormat::SpecKind const kind, uint32_t const arg, int64_t const ticks)
+{
+  assert(transition < m_specs.size());
+  m_specs[transition].push_back(ImageFormat::Spec{kind, arg, ticks});
+}
+
+vector<char>
+ImageWriterImpl
+::bytes()
+const
+{
+  size_t nrOfSpecs{0};
+  for (auto const & specs : m_specs)
+  {
+    nrOfSpecs += specs.size();
+  }
+
+  ImageFormat::Header header{};
+  header.magic = ImageFormat::magic;
+  header.version = ImageFormat::version;
+  header.topName = m_topName;
+  header.components.offset = alignUp(sizeof(ImageFormat::Header), alignof(ImageFormat::Component));
+  header.components.count = static_cast<uint32_t>(m_components.size());
+  header.transitions.offset =
+    alignUp
+    (
+      header.components.offset + m_components.size() * sizeof(ImageFormat::Component)
+    , alignof(ImageFormat::Transition)
+    );
+  header.transitions.count = static_cast<uint32_t>(m_transitions.size());
+  header.specs.offset =
+    alignUp(header.transitions.offset + m_transitions.size() * sizeof(ImageFormat::Transition), alignof(ImageFormat::Spec));
+  header.specs.count = static_cast<uint32_t>(nrOfSpecs);
+  header.chars.offset = static_cast<uint32_t>(header.specs.offset + nrOfSpecs * sizeof(ImageFormat::Spec));
+  header.chars.count = static_cast<uint32_t>(m_chars.size());
+  header.size = alignUp(header.chars.offset + m_chars.size(), alignof(ImageFormat::Header));
+
+  vector<char> bytes(header.size, 0);
+  memcpy(bytes.data(), &header, sizeof(header));
+  memcpy(bytes.data() + header.components.offset, m_components.data(), m_components.size() * sizeof(ImageFormat::Component));
+  auto * transition{reinterpret_cast<ImageFormat::Transition *>(bytes.data() + header.transitions.offset)};
+  auto * spec{reinterpret_cast<ImageFormat::Spec *>(bytes.data() + header.specs.offset)};
+  uint32_t firstSpec{0};
+  for (size_t idx{0}; idx < m_transitions.size(); ++idx)
+  {
+    // The specs of each transition are laid out contiguously, whenever they have been added.
+    *transition = m_transitions[idx];
+    transition->firstSpec = firstSpec;
+    transition->nrOfSpecs = static_cast<uint32_t>(m_specs[idx].size());
+    spec = copy(m_specs[idx].begin(), m_specs[idx].end(), spec);
+    firstSpec += transition->nrOfSpecs;
+    ++transition;
+  }
+  copy(m_chars.begin(), m_chars.end(), bytes.data() + header.chars.offset);
+
+  ImageImpl const validated{bytes.data(), bytes.size()};
+  return bytes;
+}
+
+void
+ImageWriterImpl
+::write(char const * const path)
+const
+{
+  vector<char> const bytes{this->bytes()};
+  ofstream file{path, ios::binary | ios::trunc};
+  file.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+  file.close();
+  if (!file)
+  {
+#ifndef STATE_DIAGRAM_STRINGLESS
+    throw Image::FileError(path);
+#else
+    STATE_DIAGRAM_HANDLE_ERROR(Image::fileError);
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+ImageFormat::String
+ImageWriterImpl
+::intern(string const & name)
+{
+  auto const interned{m_strings.find(name)};
+  if (interned != m_strings.end())
+  {
+    return interned->second;
+  }
+  ImageFormat::String const chars{static_cast<uint32_t>(m_chars.size()), static_cast<uint32_t>(name.size())};
+  m_chars.insert(m_chars.end(), name.begin(), name.end());
+  m_strings.emplace(name, chars);
+  return chars;
+}
+#endif // STATE_DIAGRAM_STRINGLESS
+
+} // namespace state_diagram
@@ -0,0 +1,71 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_IMAGEWRITERIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_IMAGEWRITERIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+#ifndef STATE_DIAGRAM_STRINGLESS
+#include <unordered_map>
+#endif // STATE_DIAGRAM_STRINGLESS
+#include <vector>
+
+#include "ImageFormat.h"
+
+namespace state_diagram
+{
+
+class ImageWriterImpl
+{
+public:
+  ImageWriterImpl(STATE_DIAGRAM_STRING_PARAM(topName));
+  ImageWriterImpl(ImageWriterImpl const &) = delete;
+
+  void operator=(ImageWriterImpl const &) = delete;
+
+  Image::Idx
+  addComponent
+  (
+    ImageFormat::ComponentKind const kind
+  , STATE_DIAGRAM_STRING_PARAM_COMMA(name) Image::Idx const parent
+  , uint32_t const typeId
+  );
+  Image::Idx addTransition(ImageFormat::TransitionKind const kind, Image::Idx const source, Image::Idx const target);
+  void addSpec(Image::Idx const transition, ImageFormat::SpecKind const kind, uint32_t const arg, int64_t const ticks);
+
+  vector<char> bytes() const;
+  void write(char const * const path) const;
+
+private:
+#ifndef STATE_DIAGRAM_STRINGLESS
+  ImageFormat::String intern(string const & name);
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  vector<char> m_chars;
+#ifndef STATE_DIAGRAM_STRINGLESS
+  unordered_map<string, ImageFormat::String> m_strings;
+#endif // STATE_DIAGRAM_STRINGLESS
+  ImageFormat::String m_topName;
+  vector<ImageFormat::Component> m_components;
+  vector<ImageFormat::Transition> m_transitions;
+  vector<vector<ImageFormat::Spec>> m_specs;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_IMAGEWRITERIMPL_H_
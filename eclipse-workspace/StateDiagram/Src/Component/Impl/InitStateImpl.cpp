@@ -32,7 +32,7 @@ InitStateImpl
 InitStateImpl
 ::InitStateImpl(RegionImpl * const _parent)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG(Init::name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Init::name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
 , SubStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Init::name) _parent}
 , SourceStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(Init::name) _parent}
 {
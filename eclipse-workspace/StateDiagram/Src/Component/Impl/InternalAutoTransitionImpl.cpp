@@ -49,6 +49,7 @@ InternalAutoTransitionImpl
     return ExecStat{};
   }
   max1Disable();
+  host->touch();
   return TriggerlessTransitionImpl::exec();
 }
 
@@ -54,5 +54,12 @@ InternalStepTransitionImpl
   TriggeredTransitionImpl::reload();
 }
 
+void
+InternalStepTransitionImpl
+::armAtOrigin()
+{
+  // This space intentionally left empty
+}
+
 } // namespace state_diagram
 
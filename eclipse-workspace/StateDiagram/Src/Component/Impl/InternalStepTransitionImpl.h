@@ -53,6 +53,9 @@ public:
 
   ExecStat exec() override;
   void reload() override;
+
+private:
+  void armAtOrigin() override;
 };
 
 } // namespace state_diagram
@@ -0,0 +1,504 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "JsonDocument.h"
+
+#include <limits>
+
+namespace state_diagram
+{
+
+class JsonDocument::Parser
+{
+public:
+  Parser(string const & text, vector<Value> & values, string & chars)
+  :
+    m_text{text}
+  , m_values{values}
+  , m_chars{chars}
+  , m_pos{0}
+  , m_line{1}
+  , m_column{1}
+  {
+    // This space intentionally left empty
+  }
+
+  void
+  parseDocument()
+  {
+    parseValue();
+    skipWhitespace();
+    if (m_pos != m_text.size())
+    {
+      throwSyntaxError("text follows the end of the document");
+    }
+  }
+
+private:
+  void
+  parseValue()
+  {
+    skipWhitespace();
+    if (m_pos == m_text.size())
+    {
+      throwSyntaxError("a value is missing");
+    }
+    switch (m_text[m_pos])
+    {
+    case '{':
+      parseChildren(Kind::OBJECT, '}');
+      break;
+
+    case '[':
+      parseChildren(Kind::ARRAY, ']');
+      break;
+
+    case '"':
+      {
+        uint32_t const valueIdx{append(Kind::STRING)};
+        uint32_t const strOffset{parseString()};
+        m_values[valueIdx].strOffset = strOffset;
+        m_values[valueIdx].strLength = static_cast<uint32_t>(m_chars.size() - strOffset);
+      }
+      break;
+
+    case 't':
+      parseLiteral("true", Kind::BOOLEAN, 1);
+      break;
+
+    case 'f':
+      parseLiteral("false", Kind::BOOLEAN, 0);
+      break;
+
+    case 'n':
+      parseLiteral("null", Kind::NUL, 0);
+      break;
+
+    default:
+      parseNumber();
+      break;
+    }
+  }
+
+  // Children are appended right after their parent, each of them along with all of its own children, so they are
+  // chained by the indices of their successors.
+  void
+  parseChildren(Kind const kind, char const closing)
+  {
+    uint32_t const parentIdx{append(kind)};
+    advance();
+    skipWhitespace();
+    if (accept(closing))
+    {
+      return;
+    }
+    uint32_t prevChildIdx{0};
+    do
+    {
+      skipWhitespace();
+      uint32_t nameOffset{0};
+      uint32_t nameLength{0};
+      if (kind == Kind::OBJECT)
+      {
+        if ((m_pos == m_text.size()) || (m_text[m_pos] != '"'))
+        {
+          throwSyntaxError("a member name is missing");
+        }
+        nameOffset = parseString();
+        nameLength = static_cast<uint32_t>(m_chars.size() - nameOffset);
+        skipWhitespace();
+        expect(':');
+        skipWhitespace();
+      }
+      uint32_t const childIdx{static_cast<uint32_t>(m_values.size())};
+      parseValue();
+      m_values[childIdx].nameOffset = nameOffset;
+      m_values[childIdx].nameLength = nameLength;
+      if (prevChildIdx != 0)
+      {
+        m_values[prevChildIdx].next = childIdx;
+      }
+      prevChildIdx = childIdx;
+      ++m_values[parentIdx].nrOfChildren;
+      skipWhitespace();
+    }
+    while (accept(','));
+    expect(closing);
+  }
+
+  uint32_t
+  parseString()
+  {
+    uint32_t const offset{static_cast<uint32_t>(m_chars.size())};
+    advance();
+    for (;;)
+    {
+      if (m_pos == m_text.size())
+      {
+        throwSyntaxError("a string is not terminated");
+      }
+      // Plain characters are appended in runs, as they cannot be line breaks.
+      size_t end{m_pos};
+      while ((end != m_text.size()) && isPlain(m_text[end]))
+      {
+        ++end;
+      }
+      m_chars.append(m_text, m_pos, end - m_pos);
+      m_column += static_cast<uint32_t>(end - m_pos);
+      m_pos = end;
+      if (m_pos == m_text.size())
+      {
+        continue;
+      }
+      char const c{m_text[m_pos]};
+      if (c == '"')
+      {
+        advance();
+        return offset;
+      }
+      if (c != '\\')
+      {
+        throwSyntaxError("a string contains a control character");
+      }
+      advance();
+      if (m_pos == m_text.size())
+      {
+        throwSyntaxError("a string is not terminated");
+      }
+      char const escaped{m_text[m_pos]};
+      advance();
+      switch (escaped)
+      {
+      case '"':
+      case '\\':
+      case '/':
+        m_chars += escaped;
+        break;
+
+      case 'b':
+        m_chars += '\b';
+        break;
+
+      case 'f':
+        m_chars += '\f';
+        break;
+
+      case 'n':
+        m_chars += '\n';
+        break;
+
+      case 'r':
+        m_chars += '\r';
+        break;
+
+      case 't':
+        m_chars += '\t';
+        break;
+
+      case 'u':
+        appendCodePoint(m_chars, parseCodePoint());
+        break;
+
+      default:
+        throwSyntaxError("a string contains an invalid escape sequence");
+      }
+    }
+  }
+
+  static
+  bool
+  isPlain(char const c)
+  {
+    return (c != '"') && (c != '\\') && (static_cast<unsigned char>(c) >= 0x20);
+  }
+
+  uint32_t
+  parseCodePoint()
+  {
+    uint32_t codePoint{parseHex4()};
+    if ((codePoint >= 0xd800) && (codePoint < 0xdc00))
+    {
+      // A high surrogate must be followed by an escaped low surrogate.
+      if ((m_text.compare(m_pos, 2, "\\u") != 0))
+      {
+        throwSyntaxError("a string contains an unpaired surrogate");
+      }
+      advance();
+      advance();
+      uint32_t const low{parseHex4()};
+      if ((low < 0xdc00) || (low >= 0xe000))
+      {
+        throwSyntaxError("a string contains an unpaired surrogate");
+      }
+      codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+    }
+    else if ((codePoint >= 0xdc00) && (codePoint < 0xe000))
+    {
+      throwSyntaxError("a string contains an unpaired surrogate");
+    }
+    return codePoint;
+  }
+
+  uint32_t
+  parseHex4()
+  {
+    uint32_t value{0};
+    for (int idx{0}; idx < 4; ++idx)
+    {
+      if (m_pos == m_text.size())
+      {
+        throwSyntaxError("a string is not terminated");
+      }
+      char const c{m_text[m_pos]};
+      uint32_t digit{0};
+      if ((c >= '0') && (c <= '9'))
+      {
+        digit = c - '0';
+      }
+      else if ((c >= 'a') && (c <= 'f'))
+      {
+        digit = c - 'a' + 10;
+      }
+      else if ((c >= 'A') && (c <= 'F'))
+      {
+        digit = c - 'A' + 10;
+      }
+      else
+      {
+        throwSyntaxError("a string contains an invalid escape sequence");
+      }
+      value = (value << 4) | digit;
+      advance();
+    }
+    return value;
+  }
+
+  static
+  void
+  appendCodePoint(string & str, uint32_t const codePoint)
+  {
+    if (codePoint < 0x80)
+    {
+      str += static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+      str += static_cast<char>(0xc0 | (codePoint >> 6));
+      str += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else if (codePoint < 0x10000)
+    {
+      str += static_cast<char>(0xe0 | (codePoint >> 12));
+      str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+      str += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else
+    {
+      str += static_cast<char>(0xf0 | (codePoint >> 18));
+      str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+      str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+      str += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+  }
+
+  void
+  parseLiteral(char const * const literal, Kind const kind, int64_t const number)
+  {
+    uint32_t const valueIdx{append(kind)};
+    for (char const * c{literal}; *c != '\0'; ++c)
+    {
+      if ((m_pos == m_text.size()) || (m_text[m_pos] != *c))
+      {
+        throwSyntaxError("a value is invalid");
+      }
+      advance();
+    }
+    m_values[valueIdx].number = number;
+  }
+
+  void
+  parseNumber()
+  {
+    uint32_t const valueIdx{append(Kind::NUMBER)};
+    bool const isNegative{accept('-')};
+    if ((m_pos == m_text.size()) || (m_text[m_pos] < '0') || (m_text[m_pos] > '9'))
+    {
+      throwSyntaxError("a value is invalid");
+    }
+    // Accumulating the magnitude unsigned lets the most negative integer through as well.
+    uint64_t const limit{static_cast<uint64_t>(numeric_limits<int64_t>::max()) + (isNegative ? 1 : 0)};
+    uint64_t magnitude{0};
+    while ((m_pos != m_text.size()) && (m_text[m_pos] >= '0') && (m_text[m_pos] <= '9'))
+    {
+      uint64_t const digit{static_cast<uint64_t>(m_text[m_pos] - '0')};
+      if (magnitude > (limit - digit) / 10)
+      {
+        throwSyntaxError("a number is out of range");
+      }
+      magnitude = 10 * magnitude + digit;
+      advance();
+    }
+    if ((m_pos != m_text.size()) && ((m_text[m_pos] == '.') || (m_text[m_pos] == 'e') || (m_text[m_pos] == 'E')))
+    {
+      throwSyntaxError("a number is not an integer");
+    }
+    m_values[valueIdx].number = isNegative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+  }
+
+  uint32_t
+  append(Kind const kind)
+  {
+    // A document has fewer values than characters, so their indices fit into 32 bits just like all offsets.
+    m_values.push_back(Value{kind, m_line, m_column, 0, 0, 0, 0, 0, 0, 0});
+    return static_cast<uint32_t>(m_values.size() - 1);
+  }
+
+  void
+  skipWhitespace()
+  {
+    while
+    (
+      (m_pos != m_text.size())
+    && ((m_text[m_pos] == ' ') || (m_text[m_pos] == '\t') || (m_text[m_pos] == '\n') || (m_text[m_pos] == '\r'))
+    )
+    {
+      advance();
+    }
+  }
+
+  bool
+  accept(char const c)
+  {
+    if ((m_pos == m_text.size()) || (m_text[m_pos] != c))
+    {
+      return false;
+    }
+    advance();
+    return true;
+  }
+
+  void
+  expect(char const c)
+  {
+    if (!accept(c))
+    {
+      throwSyntaxError(string{"'"} + c + "' is missing");
+    }
+  }
+
+  void
+  advance()
+  {
+    if (m_text[m_pos] == '\n')
+    {
+      ++m_line;
+      m_column = 1;
+    }
+    else
+    {
+      ++m_column;
+    }
+    ++m_pos;
+  }
+
+  void
+  throwSyntaxError(string const & reason)
+  const
+  {
+    throw TextTop::SyntaxError(m_line, m_column, reason);
+  }
+
+  string const & m_text;
+  vector<Value> & m_values;
+  string & m_chars;
+  size_t m_pos;
+  uint32_t m_line;
+  uint32_t m_column;
+};
+
+void
+JsonDocument::Value
+::throwSyntaxError(string const & reason)
+const
+{
+  throw TextTop::SyntaxError(line, column, reason);
+}
+
+JsonDocument
+::JsonDocument(string const & text)
+:
+  m_values{}
+, m_chars{}
+{
+  // Offsets and counts are 32 bits wide, and can hold all of a document up to 4 GB.
+  if (text.size() > numeric_limits<uint32_t>::max())
+  {
+    throw TextTop::SyntaxError(1, 1, "the document is too large");
+  }
+  // Documents hardly ever have more values than a tenth of their characters, nor more string characters than half.
+  m_values.reserve(text.size() / 10);
+  m_chars.reserve(text.size() / 2);
+  Parser{text, m_values, m_chars}.parseDocument();
+}
+
+JsonDocument::Value const &
+JsonDocument
+::root()
+const
+{
+  return m_values.front();
+}
+
+string_view
+JsonDocument
+::name(Value const & member)
+const
+{
+  return string_view{m_chars}.substr(member.nameOffset, member.nameLength);
+}
+
+string_view
+JsonDocument
+::str(Value const & value)
+const
+{
+  return string_view{m_chars}.substr(value.strOffset, value.strLength);
+}
+
+JsonDocument::Value const *
+JsonDocument
+::member(Value const & object, string_view const name)
+const
+{
+  Value const * child{&object + 1};
+  for (uint32_t childIdx{0}; childIdx < object.nrOfChildren; ++childIdx)
+  {
+    if (this->name(*child) == name)
+    {
+      return child;
+    }
+    child = &m_values[child->next];
+  }
+  return nullptr;
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
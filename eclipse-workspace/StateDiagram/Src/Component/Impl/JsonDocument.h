@@ -0,0 +1,97 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_JSONDOCUMENT_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_JSONDOCUMENT_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace state_diagram
+{
+
+// Parsed JSON documents. All values are kept in a single array in document order, where every array and object is
+// directly followed by its first element or member, and all strings, decoded, are kept in a single array of
+// characters. Each value remembers where it starts in the text, so that errors found while interpreting the document
+// can be reported there. Numbers are restricted to integers, as diagram texts need nothing else.
+class JsonDocument
+{
+public:
+  enum class Kind : uint32_t
+  {
+    NUL
+  , BOOLEAN
+  , NUMBER
+  , STRING
+  , ARRAY
+  , OBJECT
+  };
+
+  class Value
+  {
+  public:
+    Kind kind;
+    uint32_t line;
+    uint32_t column;
+    uint32_t nrOfChildren;
+    uint32_t next;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t strOffset;
+    uint32_t strLength;
+    int64_t number;
+
+    void throwSyntaxError(string const & reason) const;
+  };
+
+  JsonDocument(string const & text);
+  JsonDocument(JsonDocument const &) = delete;
+
+  void operator=(JsonDocument const &) = delete;
+
+  Value const & root() const;
+  string_view name(Value const & member) const;
+  string_view str(Value const & value) const;
+  Value const * member(Value const & object, string_view const name) const;
+
+  template<class F>
+  void
+  forEachChild(Value const & value, F const & f)
+  const
+  {
+    Value const * child{&value + 1};
+    for (uint32_t childIdx{0}; childIdx < value.nrOfChildren; ++childIdx)
+    {
+      f(*child);
+      child = &m_values[child->next];
+    }
+  }
+
+private:
+  class Parser;
+
+  vector<Value> m_values;
+  string m_chars;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_JSONDOCUMENT_H_
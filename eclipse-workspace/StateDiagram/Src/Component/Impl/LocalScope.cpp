@@ -16,8 +16,12 @@
 
 #include "LocalScope.h"
 
+#include <cassert>
+
+#include "ExecutionPlan.h"
 #include "LocalSignalDelegateImpl.h"
 #include "LocalVarDelegateImpl.h"
+#include "TopStateImpl.h"
 
 namespace state_diagram
 {
@@ -25,26 +29,46 @@ namespace state_diagram
 LocalScope
 ::LocalScope(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) LocalScope const * const up, TopStateImpl * const _topState)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_topState->namePool)}
 , topState{_topState}
 , m_up{up}
-#ifndef STATE_DIAGRAM_STRINGLESS
-, m_localSignalNames{}
-, m_localVarNames{}
-#endif // STATE_DIAGRAM_STRINGLESS
+, m_scopeBegin{0}
+, m_scopeEnd{0}
 , m_localSignals{}
 , m_localVars{}
+, m_nrOfTouchedLocalVars{0}
 {
   // This space intentionally left empty
 }
 
+bool
+LocalScope
+::encloses(LocalScope const * const scope)
+const
+{
+  if (topState->isCompiled())
+  {
+    // Scopes are numbered in pre-order while compiling, so the numbers of all scopes enclosed by a scope, itself
+    // included, make up one interval.
+    return (m_scopeBegin <= scope->m_scopeBegin) && (scope->m_scopeBegin <= m_scopeEnd);
+  }
+  // Scopes added since the plan was compiled have not been numbered yet.
+  for (LocalScope const * up{scope}; up != nullptr; up = up->m_up)
+  {
+    if (up == this)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 void
 LocalScope
 ::insertLocalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) LocalSignalDelegateImpl * const localSignal)
 {
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_localSignalNames.insert(_name).second};
-  if (!stat)
+  if (!topState->claimName(this, TopStateImpl::NameKind::LOCAL_SIGNAL, localSignal->nameId))
   {
     throwSignalNameClashError
     (
@@ -60,15 +84,7 @@ LocalScope
 ::hasInScope(LocalSignalDelegateImpl const * const localSignal)
 const
 {
-  if (containsItem(m_localSignals, localSignal))
-  {
-    return true;
-  }
-  if (m_up != nullptr)
-  {
-    return m_up->hasInScope(localSignal);
-  }
-  return false;
+  return localSignal->scope()->encloses(this);
 }
 
 void
@@ -76,8 +92,7 @@ LocalScope
 ::insertLocalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) LocalVarDelegateImpl * const localVar)
 {
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_localVarNames.insert(_name).second};
-  if (!stat)
+  if (!topState->claimName(this, TopStateImpl::NameKind::LOCAL_VAR, localVar->nameId))
   {
     throwVarNameClashError
     (
@@ -86,22 +101,34 @@ LocalScope
   }
 #endif // STATE_DIAGRAM_STRINGLESS
   m_localVars.emplace_front(localVar);
+  topState->registerComponent();
 }
 
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
 bool
 LocalScope
 ::hasInScope(LocalVarDelegateImpl const * const localVar)
 const
 {
-  if (containsItem(m_localVars, localVar))
-  {
-    return true;
-  }
-  if (m_up != nullptr)
-  {
-    return m_up->hasInScope(localVar);
-  }
-  return false;
+  return localVar->scope()->encloses(this);
+}
+
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+void
+LocalScope
+::touchLocalVar()
+{
+  ++m_nrOfTouchedLocalVars;
+}
+
+void
+LocalScope
+::untouchLocalVar()
+{
+  assert (m_nrOfTouchedLocalVars > 0);
+  --m_nrOfTouchedLocalVars;
 }
 
 void
@@ -109,19 +136,48 @@ LocalScope
 ::unsetLocalVars()
 const
 {
-  auto const unsetLocalVar{[](LocalVarDelegateImpl * const localVar){localVar->unset();}};
+  // A local variable that has not been touched since the last reload has neither a next data value to be committed
+  // nor any flags to be reset, so entering a scope whose local variables are all untouched costs nothing.
+  if (m_nrOfTouchedLocalVars == 0)
+  {
+    return;
+  }
+  auto const unsetLocalVar
+  {
+    [](LocalVarDelegateImpl * const localVar)
+    {
+      if (localVar->isTouched())
+      {
+        localVar->unset();
+      }
+    }
+  };
   forEachItem<LocalVarDelegateImpl>(m_localVars, unsetLocalVar);
 }
 
 void
 LocalScope
-::reload()
-const
+::openScope(ExecutionPlan & plan)
 {
-  auto const resetLocalSignalToAbsent{[](LocalSignalDelegateImpl * const localSignal){localSignal->deactivate();}};
-  forEachItem<LocalSignalDelegateImpl>(m_localSignals, resetLocalSignalToAbsent);
+  m_scopeBegin = plan.nrOfScopes++;
+}
+
+void
+LocalScope
+::closeScope(ExecutionPlan const & plan)
+{
+  m_scopeEnd = plan.nrOfScopes - 1;
+}
 
-  unsetLocalVars();
+void
+LocalScope
+::compileLocalVars(ExecutionPlan & plan)
+const
+{
+  for (auto const & localVar : m_localVars)
+  {
+    localVar->planIdx = plan.vars.push(localVar);
+  }
 }
 
 } // namespace state_diagram
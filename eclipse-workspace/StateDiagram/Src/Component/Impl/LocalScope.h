@@ -19,9 +19,7 @@
 
 #include "state_diagram/state_diagram.h"
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-#include <set>
-#endif // STATE_DIAGRAM_STRINGLESS
+#include <cstdint>
 
 #include "Util/ListAlgorithm.hpp"
 #include "NamePathImpl.h"
@@ -29,6 +27,7 @@
 namespace state_diagram
 {
 
+class ExecutionPlan;
 class LocalSignalDelegateImpl;
 class LocalVarDelegateImpl;
 class TopStateImpl;
@@ -45,17 +44,25 @@ private:
   void operator=(LocalScope const &) = delete;
 
 public:
+  bool encloses(LocalScope const * const scope) const;
+
   void insertLocalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) LocalSignalDelegateImpl * const localSignal);
   bool hasInScope(LocalSignalDelegateImpl const * const localSignal) const;
 
   void insertLocalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) LocalVarDelegateImpl * const localVar);
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   bool hasInScope(LocalVarDelegateImpl const * const localVar) const;
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  void touchLocalVar();
+  void untouchLocalVar();
 
   TopStateImpl * const topState;
 
 protected:
   void unsetLocalVars() const;
-  void reload() const;
+  void openScope(ExecutionPlan & plan);
+  void closeScope(ExecutionPlan const & plan);
+  void compileLocalVars(ExecutionPlan & plan) const;
 
 #ifndef STATE_DIAGRAM_STRINGLESS
   virtual
@@ -79,13 +86,12 @@ protected:
 
 private:
   LocalScope const * const m_up;
+  uint32_t m_scopeBegin;
+  uint32_t m_scopeEnd;
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-  set<string> m_localSignalNames;
-  set<string> m_localVarNames;
-#endif // STATE_DIAGRAM_STRINGLESS
-  ForwardList<LocalSignalDelegateImpl * const> m_localSignals;
-  ForwardList<LocalVarDelegateImpl * const> m_localVars;
+  SmallVector<LocalSignalDelegateImpl * const> m_localSignals;
+  SmallVector<LocalVarDelegateImpl * const> m_localVars;
+  uint32_t m_nrOfTouchedLocalVars;
 };
 
 } // namespace state_diagram
@@ -27,7 +27,7 @@ namespace state_diagram
 LocalSignalDelegateImpl
 ::LocalSignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) CompoundStateImpl * const _scope)
 :
-  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _scope->topState}
 , m_scope{_scope}
 {
   m_scope->insertLocalSignal(STATE_DIAGRAM_STRING_ARG_COMMA(name) this);
@@ -36,7 +36,7 @@ LocalSignalDelegateImpl
 LocalSignalDelegateImpl
 ::LocalSignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const _scope)
 :
-  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _scope->topState}
 , m_scope{_scope}
 {
   m_scope->insertLocalSignal(STATE_DIAGRAM_STRING_ARG_COMMA(name) this);
@@ -53,6 +53,14 @@ LocalSignalDelegateImpl
   onLocal(this);
 }
 
+LocalScope const *
+LocalSignalDelegateImpl
+::scope()
+const
+{
+  return m_scope;
+}
+
 #ifndef STATE_DIAGRAM_STRINGLESS
 
 void
@@ -47,6 +47,8 @@ public:
   )
   override;
 
+  LocalScope const * scope() const;
+
 #ifndef STATE_DIAGRAM_STRINGLESS
   void path(ostream & to) const override;
   using NamePathImpl::path;
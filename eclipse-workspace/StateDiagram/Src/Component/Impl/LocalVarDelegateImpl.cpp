@@ -26,7 +26,7 @@ namespace state_diagram
 LocalVarDelegateImpl
 ::LocalVarDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) CompoundStateImpl * const scope, LocalVarDelegate * const _interface)
 :
-  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface}
+  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface, scope->topState, scope}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_scope{scope}
 #endif
@@ -37,7 +37,7 @@ LocalVarDelegateImpl
 LocalVarDelegateImpl
 ::LocalVarDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const scope, LocalVarDelegate * const _interface)
 :
-  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface}
+  VarDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _interface, scope->topState, scope}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_scope{scope}
 #endif
@@ -79,6 +79,14 @@ const
   return m_scope->topState->isUnderExecution();
 }
 
+LocalScope const *
+LocalVarDelegateImpl
+::scope()
+const
+{
+  return m_scope;
+}
+
 bool
 LocalVarDelegateImpl
 ::isInCurLocalScope()
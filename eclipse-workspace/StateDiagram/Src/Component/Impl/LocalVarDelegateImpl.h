@@ -54,6 +54,7 @@ public:
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   bool isUnderExecution() const override;
 
+  LocalScope const * scope() const;
   bool isInCurLocalScope() const;
 #ifndef STATE_DIAGRAM_STRINGLESS
   string curLocalScopePath() const override;
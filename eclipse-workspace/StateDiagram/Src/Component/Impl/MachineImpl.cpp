@@ -0,0 +1,269 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "MachineImpl.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "ExecutionPlan.h"
+#include "RegionImpl.h"
+#include "StateImpl.h"
+#include "TopStateImpl.h"
+#include "VarDelegateImpl.h"
+
+namespace state_diagram
+{
+
+MachineImpl::Layout
+::Layout()
+:
+  size{0}
+, stateOffset{0}
+, varOffset{0}
+, varDataOffsets{}
+, hasTrivialData{true}
+{
+  // This space intentionally left empty
+}
+
+void
+MachineImpl::Layout
+::compute(ExecutionPlan const & plan)
+{
+  // The current sub-states of the regions come first, then the flags of the states and the variables, and finally
+  // the data values of the variables, each aligned as required by its type.
+  stateOffset = plan.regions.size() * sizeof(uint32_t);
+  varOffset = stateOffset + plan.states.size() * sizeof(uint8_t);
+  size_t offset{varOffset + plan.vars.size() * sizeof(uint8_t)};
+  varDataOffsets.clear();
+  hasTrivialData = true;
+  for (auto const & var : plan.vars.all())
+  {
+    size_t const alignment{var->runtimeDataAlignment()};
+    assert (alignment <= alignof(max_align_t));
+    offset = (offset + alignment - 1) / alignment * alignment;
+    varDataOffsets.push_back(offset);
+    offset += var->runtimeDataSize();
+    hasTrivialData &= var->hasTrivialRuntimeData();
+  }
+  size = (offset + sizeof(max_align_t) - 1) / sizeof(max_align_t);
+}
+
+MachineImpl
+::MachineImpl(TopStateImpl * const topState)
+:
+  m_topState{topState}
+, m_block{}
+{
+  m_topState->compileIfStale();
+  ExecutionPlan const & plan{m_topState->plan()};
+  Layout const & layout{m_topState->machineLayout()};
+  m_block.reset(new max_align_t[layout.size]);
+  for (uint32_t idx{0}; idx < plan.regions.size(); ++idx)
+  {
+    regionStates()[idx] = plan.regions[idx]->runtimeState();
+  }
+  for (uint32_t idx{0}; idx < plan.states.size(); ++idx)
+  {
+    stateStates()[idx] = plan.states[idx]->runtimeState();
+  }
+  for (uint32_t idx{0}; idx < plan.vars.size(); ++idx)
+  {
+    varStates()[idx] = plan.vars[idx]->runtimeState();
+    plan.vars[idx]->copyRuntimeData(bytes() + layout.varDataOffsets[idx], nullptr);
+  }
+}
+
+MachineImpl
+::MachineImpl(MachineImpl const * const other)
+:
+  m_topState{other->m_topState}
+, m_block{}
+{
+  ExecutionPlan const & plan{m_topState->plan()};
+  Layout const & layout{m_topState->machineLayout()};
+  m_block.reset(new max_align_t[layout.size]);
+  if (layout.hasTrivialData)
+  {
+    memcpy(m_block.get(), other->m_block.get(), layout.size * sizeof(max_align_t));
+    return;
+  }
+  memcpy(m_block.get(), other->m_block.get(), layout.varOffset + plan.vars.size() * sizeof(uint8_t));
+  for (uint32_t idx{0}; idx < plan.vars.size(); ++idx)
+  {
+    size_t const offset{layout.varDataOffsets[idx]};
+    plan.vars[idx]->copyRuntimeData(bytes() + offset, other->bytes() + offset);
+  }
+}
+
+MachineImpl
+::~MachineImpl()
+{
+  ExecutionPlan const & plan{m_topState->plan()};
+  Layout const & layout{m_topState->machineLayout()};
+  if (layout.hasTrivialData)
+  {
+    return;
+  }
+  for (uint32_t idx{0}; idx < plan.vars.size(); ++idx)
+  {
+    plan.vars[idx]->destroyRuntimeData(bytes() + layout.varDataOffsets[idx]);
+  }
+}
+
+void
+MachineImpl
+::load()
+{
+  load(m_topState);
+}
+
+void
+MachineImpl
+::load(TopStateImpl * const topState)
+{
+  swap(topState);
+}
+
+void
+MachineImpl
+::activate(ExternalSignalDelegateImpl * const trigger)
+{
+  m_topState->activate(trigger);
+}
+
+void
+MachineImpl
+::activate(TopStateImpl * const topState, uint32_t const externalSignalIdx)
+{
+  topState->activate(topState->plan().externalSignals[externalSignalIdx]);
+}
+
+bool
+MachineImpl
+::execLoaded()
+{
+  return execLoaded(m_topState);
+}
+
+bool
+MachineImpl
+::execLoaded(TopStateImpl * const topState)
+{
+  class Unloader
+  {
+  public:
+    Unloader(MachineImpl * const subject, TopStateImpl * const topState)
+    :
+      m_subject{subject}
+    , m_topState{topState}
+    {
+      // This space intentionally left empty
+    }
+    Unloader(Unloader const &) = delete;
+
+    ~Unloader()
+    {
+      m_subject->swap(m_topState);
+    }
+
+    void operator=(Unloader const &) = delete;
+
+  private:
+    MachineImpl * const m_subject;
+    TopStateImpl * const m_topState;
+  };
+
+  Unloader const unloader(this, topState);
+
+  return topState->exec();
+}
+
+bool
+MachineImpl
+::isCurrent(SubStateImpl const * const subState)
+const
+{
+  return regionStates()[subState->parentRegion()->planIdx] == subState->planIdx;
+}
+
+void const *
+MachineImpl
+::data(VarDelegateImpl const * const var)
+const
+{
+  return bytes() + m_topState->machineLayout().varDataOffsets[var->planIdx];
+}
+
+void
+MachineImpl
+::swap(TopStateImpl * const topState)
+{
+  // Swapping rather than copying leaves the runtime state of the top state itself intact once swapped back. Any top
+  // state built the same way as the one the machine has been created from lays out its runtime state identically.
+  ExecutionPlan const & plan{topState->plan()};
+  Layout const & layout{topState->machineLayout()};
+  assert (layout.size == m_topState->machineLayout().size);
+  topState->forgetTouched();
+  topState->isHostingMachine = !topState->isHostingMachine;
+  for (uint32_t idx{0}; idx < plan.regions.size(); ++idx)
+  {
+    plan.regions[idx]->swapRuntimeState(regionStates()[idx]);
+  }
+  for (uint32_t idx{0}; idx < plan.states.size(); ++idx)
+  {
+    plan.states[idx]->swapRuntimeState(stateStates()[idx]);
+  }
+  for (uint32_t idx{0}; idx < plan.vars.size(); ++idx)
+  {
+    plan.vars[idx]->swapRuntimeState(varStates()[idx], bytes() + layout.varDataOffsets[idx]);
+  }
+}
+
+unsigned char *
+MachineImpl
+::bytes()
+const
+{
+  return reinterpret_cast<unsigned char *>(m_block.get());
+}
+
+uint32_t *
+MachineImpl
+::regionStates()
+const
+{
+  return reinterpret_cast<uint32_t *>(bytes());
+}
+
+uint8_t *
+MachineImpl
+::stateStates()
+const
+{
+  return bytes() + m_topState->machineLayout().stateOffset;
+}
+
+uint8_t *
+MachineImpl
+::varStates()
+const
+{
+  return bytes() + m_topState->machineLayout().varOffset;
+}
+
+} // namespace state_diagram
@@ -0,0 +1,87 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_MACHINEIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_MACHINEIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace state_diagram
+{
+
+class ExecutionPlan;
+class ExternalSignalDelegateImpl;
+class SubStateImpl;
+class TopStateImpl;
+class VarDelegateImpl;
+
+class MachineImpl
+{
+public:
+  class Layout
+  {
+  public:
+    Layout();
+    Layout(Layout const &) = delete;
+
+    void operator=(Layout const &) = delete;
+
+    void compute(ExecutionPlan const & plan);
+
+    size_t size;
+    size_t stateOffset;
+    size_t varOffset;
+    vector<size_t> varDataOffsets;
+    bool hasTrivialData;
+  };
+
+  MachineImpl(TopStateImpl * const topState);
+  MachineImpl(MachineImpl const * const other);
+  MachineImpl(MachineImpl const &) = delete;
+  ~MachineImpl();
+
+  void operator=(MachineImpl const &) = delete;
+
+  void load();
+  void load(TopStateImpl * const topState);
+  void activate(ExternalSignalDelegateImpl * const trigger);
+  void activate(TopStateImpl * const topState, uint32_t const externalSignalIdx);
+  bool execLoaded();
+  bool execLoaded(TopStateImpl * const topState);
+
+  bool isCurrent(SubStateImpl const * const subState) const;
+  void const * data(VarDelegateImpl const * const var) const;
+
+private:
+  void swap(TopStateImpl * const topState);
+
+  unsigned char * bytes() const;
+  uint32_t * regionStates() const;
+  uint8_t * stateStates() const;
+  uint8_t * varStates() const;
+
+  TopStateImpl * const m_topState;
+  unique_ptr<max_align_t[]> m_block;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_MACHINEIMPL_H_
@@ -0,0 +1,281 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "MachinePoolImpl.h"
+
+#include <cassert>
+
+#include "ExternalSignalDelegateImpl.h"
+#include "MachineImpl.h"
+#include "TopStateImpl.h"
+
+namespace state_diagram
+{
+
+MachinePoolImpl::Worker
+::Worker(TopStateImpl * const _topState)
+:
+  topState{_topState}
+, tasksMutex{}
+, tasks{}
+, busyTime{}
+, nrOfSteals{0}
+, executor{}
+{
+  // This space intentionally left empty
+}
+
+MachinePoolImpl
+::MachinePoolImpl(Top const * const top, vector<TopStateImpl *> const topStates)
+:
+  m_top{top}
+, m_machines{}
+, m_batches{}
+, m_workers{}
+, m_mutex{}
+, m_hasStarted{}
+, m_hasFinished{}
+, m_runIdx{0}
+, m_nrOfRunningWorkers{0}
+, m_isStopping{false}
+, m_error{}
+, m_runTime{}
+{
+  assert (!topStates.empty());
+  for (auto const & topState : topStates)
+  {
+    topState->compileIfStale();
+    m_workers.push_back(make_unique<Worker>(topState));
+  }
+  for (size_t workerIdx{0}; workerIdx < m_workers.size(); ++workerIdx)
+  {
+    m_workers[workerIdx]->executor = thread{[this, workerIdx]{work(workerIdx);}};
+  }
+}
+
+MachinePoolImpl
+::~MachinePoolImpl()
+{
+  {
+    lock_guard<mutex> const lock{m_mutex};
+    m_isStopping = true;
+  }
+  m_hasStarted.notify_all();
+  for (auto const & worker : m_workers)
+  {
+    worker->executor.join();
+  }
+}
+
+size_t
+MachinePoolImpl
+::add()
+{
+  m_machines.push_back(make_unique<Machine const>(*m_top));
+  m_batches.emplace_back();
+  return m_machines.size() - 1;
+}
+
+Machine const &
+MachinePoolImpl
+::machine(size_t const machineIdx)
+const
+{
+  return *m_machines[machineIdx];
+}
+
+size_t
+MachinePoolImpl
+::size()
+const
+{
+  return m_machines.size();
+}
+
+void
+MachinePoolImpl
+::submit(size_t const machineIdx, vector<ExternalSignalDelegateImpl const *> const & triggers)
+{
+  Batch batch{};
+  batch.reserve(triggers.size());
+  for (auto const & trigger : triggers)
+  {
+    batch.push_back(trigger->planIdx);
+  }
+  m_batches[machineIdx].push_back(move(batch));
+}
+
+void
+MachinePoolImpl
+::run()
+{
+  // Each machine with submitted batches becomes a single task, so no two workers ever step the same machine.
+  size_t nrOfTasks{0};
+  for (size_t machineIdx{0}; machineIdx < m_machines.size(); ++machineIdx)
+  {
+    if (!m_batches[machineIdx].empty())
+    {
+      m_workers[nrOfTasks++ % m_workers.size()]->tasks.push_back(machineIdx);
+    }
+  }
+  if (nrOfTasks == 0)
+  {
+    return;
+  }
+
+  Clock::time_point const start{Clock::now()};
+  {
+    unique_lock<mutex> lock{m_mutex};
+    m_nrOfRunningWorkers = m_workers.size();
+    ++m_runIdx;
+    m_hasStarted.notify_all();
+    m_hasFinished.wait(lock, [&]{return m_nrOfRunningWorkers == 0;});
+  }
+  m_runTime += Clock::now() - start;
+
+  if (m_error != nullptr)
+  {
+    exception_ptr error{nullptr};
+    swap(error, m_error);
+    rethrow_exception(error);
+  }
+}
+
+size_t
+MachinePoolImpl
+::nrOfWorkers()
+const
+{
+  return m_workers.size();
+}
+
+double
+MachinePoolImpl
+::utilization(size_t const workerIdx)
+const
+{
+  if (m_runTime == Clock::duration::zero())
+  {
+    return 0.0;
+  }
+  return chrono::duration<double>(m_workers[workerIdx]->busyTime) / chrono::duration<double>(m_runTime);
+}
+
+size_t
+MachinePoolImpl
+::nrOfSteals(size_t const workerIdx)
+const
+{
+  return m_workers[workerIdx]->nrOfSteals;
+}
+
+void
+MachinePoolImpl
+::work(size_t const workerIdx)
+{
+  uint64_t runIdx{0};
+  for (;;)
+  {
+    {
+      unique_lock<mutex> lock{m_mutex};
+      m_hasStarted.wait(lock, [&]{return m_isStopping || (m_runIdx != runIdx);});
+      if (m_isStopping)
+      {
+        return;
+      }
+      runIdx = m_runIdx;
+    }
+
+    size_t machineIdx;
+    while (take(workerIdx, machineIdx))
+    {
+      Clock::time_point const start{Clock::now()};
+      try
+      {
+        step(workerIdx, machineIdx);
+      }
+      catch (...)
+      {
+        lock_guard<mutex> const lock{m_mutex};
+        if (m_error == nullptr)
+        {
+          m_error = current_exception();
+        }
+      }
+      m_workers[workerIdx]->busyTime += Clock::now() - start;
+    }
+
+    {
+      lock_guard<mutex> const lock{m_mutex};
+      if (--m_nrOfRunningWorkers == 0)
+      {
+        m_hasFinished.notify_all();
+      }
+    }
+  }
+}
+
+bool
+MachinePoolImpl
+::take(size_t const workerIdx, size_t & machineIdx)
+{
+  // Own tasks are taken from the back, whereas tasks of other workers are stolen from the front.
+  {
+    Worker & worker{*m_workers[workerIdx]};
+    lock_guard<mutex> const lock{worker.tasksMutex};
+    if (!worker.tasks.empty())
+    {
+      machineIdx = worker.tasks.back();
+      worker.tasks.pop_back();
+      return true;
+    }
+  }
+  for (size_t offset{1}; offset < m_workers.size(); ++offset)
+  {
+    Worker & victim{*m_workers[(workerIdx + offset) % m_workers.size()]};
+    lock_guard<mutex> const lock{victim.tasksMutex};
+    if (!victim.tasks.empty())
+    {
+      machineIdx = victim.tasks.front();
+      victim.tasks.pop_front();
+      ++m_workers[workerIdx]->nrOfSteals;
+      return true;
+    }
+  }
+  // No tasks are added while running, so once all deques are seen empty, the worker is done.
+  return false;
+}
+
+void
+MachinePoolImpl
+::step(size_t const workerIdx, size_t const machineIdx)
+{
+  TopStateImpl * const topState{m_workers[workerIdx]->topState};
+  MachineImpl * const machine{m_machines[machineIdx]->m_impl};
+  vector<Batch> batches{};
+  swap(batches, m_batches[machineIdx]);
+  for (auto const & batch : batches)
+  {
+    machine->load(topState);
+    for (auto const & externalSignalIdx : batch)
+    {
+      machine->activate(topState, externalSignalIdx);
+    }
+    machine->execLoaded(topState);
+  }
+}
+
+} // namespace state_diagram
@@ -0,0 +1,98 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_MACHINEPOOLIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_MACHINEPOOLIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace state_diagram
+{
+
+class TopStateImpl;
+
+class MachinePoolImpl
+{
+public:
+  MachinePoolImpl(Top const * const top, vector<TopStateImpl *> const topStates);
+  MachinePoolImpl(MachinePoolImpl const &) = delete;
+  ~MachinePoolImpl();
+
+  void operator=(MachinePoolImpl const &) = delete;
+
+  size_t add();
+  Machine const & machine(size_t const machineIdx) const;
+  size_t size() const;
+
+  void submit(size_t const machineIdx, vector<ExternalSignalDelegateImpl const *> const & triggers);
+  void run();
+
+  size_t nrOfWorkers() const;
+  double utilization(size_t const workerIdx) const;
+  size_t nrOfSteals(size_t const workerIdx) const;
+
+private:
+  using Clock = chrono::steady_clock;
+  using Batch = vector<uint32_t>;
+
+  class Worker
+  {
+  public:
+    Worker(TopStateImpl * const topState);
+    Worker(Worker const &) = delete;
+
+    void operator=(Worker const &) = delete;
+
+    TopStateImpl * const topState;
+    mutex tasksMutex;
+    deque<size_t> tasks;
+    Clock::duration busyTime;
+    size_t nrOfSteals;
+    thread executor;
+  };
+
+  void work(size_t const workerIdx);
+  bool take(size_t const workerIdx, size_t & machineIdx);
+  void step(size_t const workerIdx, size_t const machineIdx);
+
+  Top const * const m_top;
+  vector<unique_ptr<Machine const>> m_machines;
+  vector<vector<Batch>> m_batches;
+  vector<unique_ptr<Worker>> m_workers;
+
+  mutex m_mutex;
+  condition_variable m_hasStarted;
+  condition_variable m_hasFinished;
+  uint64_t m_runIdx;
+  size_t m_nrOfRunningWorkers;
+  bool m_isStopping;
+  exception_ptr m_error;
+  Clock::duration m_runTime;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_MACHINEPOOLIMPL_H_
@@ -23,15 +23,24 @@
 namespace state_diagram
 {
 
-NamePathImpl
-::NamePathImpl(STATE_DIAGRAM_STRING_PARAM(_name))
 #ifndef STATE_DIAGRAM_STRINGLESS
+NamePathImpl
+::NamePathImpl(string const & _name, NamePool & _namePool)
 :
-  name{_name}
-#endif // STATE_DIAGRAM_STRINGLESS
+  namePool{_namePool}
+, nameId{_namePool.intern(_name)}
+, name{_namePool[nameId]}
+, m_path{nullptr}
+{
+  // This space intentionally left empty
+}
+#else
+NamePathImpl
+::NamePathImpl()
 {
   // This space intentionally left empty
 }
+#endif // STATE_DIAGRAM_STRINGLESS
 
 NamePathImpl
 ::~NamePathImpl()
@@ -45,18 +54,25 @@ NamePathImpl
 ::pathPrefix(ostream & to)
 const
 {
-  path(to);
-  to << pathComponentSeparator;
+  to << path() << pathComponentSeparator;
 }
 
-string
+string const &
 NamePathImpl
 ::path()
 const
 {
-  stringstream ss;
-  path(ss);
-  return ss.str();
+  // Paths are built once, on first request, and are interned like names. Threads racing to build the same path
+  // intern the same string, so whichever of them stores it last stores the same pointer.
+  string const * cachedPath{m_path.load(memory_order_acquire)};
+  if (cachedPath == nullptr)
+  {
+    stringstream ss;
+    path(ss);
+    cachedPath = &namePool[namePool.intern(ss.str())];
+    m_path.store(cachedPath, memory_order_release);
+  }
+  return *cachedPath;
 }
 #endif // STATE_DIAGRAM_STRINGLESS
 
@@ -19,13 +19,23 @@
 
 #include "state_diagram/state_diagram.h"
 
+#ifndef STATE_DIAGRAM_STRINGLESS
+#include <atomic>
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#include "NamePool.h"
+
 namespace state_diagram
 {
 
 class NamePathImpl
 {
 protected:
-  NamePathImpl(STATE_DIAGRAM_STRING_PARAM(name));
+#ifndef STATE_DIAGRAM_STRINGLESS
+  NamePathImpl(string const & name, NamePool & namePool);
+#else
+  NamePathImpl();
+#endif // STATE_DIAGRAM_STRINGLESS
 
   virtual ~NamePathImpl();
 
@@ -33,9 +43,14 @@ public:
 #ifndef STATE_DIAGRAM_STRINGLESS
   virtual void pathPrefix(ostream & to) const;
   virtual void path(ostream & to) const = 0;
-  string path() const;
+  string const & path() const;
+
+  NamePool & namePool;
+  NameId const nameId;
+  string const & name;
 
-  string const name;
+private:
+  mutable atomic<string const *> m_path;
 #endif // STATE_DIAGRAM_STRINGLESS
 };
 
@@ -0,0 +1,63 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "NamePool.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+namespace state_diagram
+{
+
+NamePool
+::NamePool()
+:
+  m_mutex{}
+, m_names{}
+, m_nameIds{}
+{
+  // This space intentionally left empty
+}
+
+NameId
+NamePool
+::intern(string const & name)
+{
+  lock_guard<mutex> const lock{m_mutex};
+  auto const found{m_nameIds.find(name)};
+  if (found != m_nameIds.end())
+  {
+    return found->second;
+  }
+  // Deques never move their items, so the views used as keys stay valid.
+  auto const nameId{static_cast<NameId>(m_names.size())};
+  m_names.push_back(name);
+  m_nameIds.emplace(m_names.back(), nameId);
+  return nameId;
+}
+
+string const &
+NamePool
+::operator[](NameId const nameId)
+const
+{
+  lock_guard<mutex> const lock{m_mutex};
+  return m_names[nameId];
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
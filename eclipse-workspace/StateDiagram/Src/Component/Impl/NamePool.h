@@ -0,0 +1,57 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_NAMEPOOL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_NAMEPOOL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace state_diagram
+{
+
+using NameId = uint32_t;
+
+class NamePool
+{
+public:
+  NamePool();
+  NamePool(NamePool const &) = delete;
+
+  void operator=(NamePool const &) = delete;
+
+  NameId intern(string const & name);
+  string const & operator[](NameId const nameId) const;
+
+private:
+  mutable mutex m_mutex;
+  deque<string> m_names;
+  unordered_map<string_view, NameId> m_nameIds;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_NAMEPOOL_H_
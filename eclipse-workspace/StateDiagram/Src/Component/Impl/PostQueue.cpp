@@ -0,0 +1,107 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "PostQueue.h"
+
+#include <cassert>
+
+namespace state_diagram
+{
+
+PostQueue
+::PostQueue(size_t const capacity)
+:
+  m_mask{capacity - 1}
+, m_cells{make_unique<Cell[]>(capacity)}
+, m_tail{0}
+, m_head{0}
+{
+  assert ((capacity != 0) && ((capacity & m_mask) == 0));
+  for (size_t idx{0}; idx < capacity; ++idx)
+  {
+    m_cells[idx].sequence.store(idx, memory_order_relaxed);
+  }
+}
+
+PostQueue
+::~PostQueue()
+{
+  for (Entry const * entry{front()}; entry != nullptr; entry = front())
+  {
+    delete entry->post;
+    pop();
+  }
+}
+
+bool
+PostQueue
+::push(ExternalSignalDelegateImpl * const signal, Post * const post)
+{
+  // A cell is free for position pos once its sequence number has caught up with pos, and holds an entry for the
+  // consumer once its sequence number is pos + 1. Producers race for positions by advancing the tail.
+  size_t pos{m_tail.load(memory_order_relaxed)};
+  Cell * cell;
+  for (;;)
+  {
+    cell = &m_cells[pos & m_mask];
+    size_t const sequence{cell->sequence.load(memory_order_acquire)};
+    if (sequence == pos)
+    {
+      if (m_tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (sequence < pos)
+    {
+      // The consumer has not yet popped the entry written a full lap ago.
+      delete post;
+      return false;
+    }
+    else
+    {
+      pos = m_tail.load(memory_order_relaxed);
+    }
+  }
+  cell->entry = Entry{signal, post};
+  cell->sequence.store(pos + 1, memory_order_release);
+  return true;
+}
+
+PostQueue::Entry const *
+PostQueue
+::front()
+const
+{
+  Cell const & cell{m_cells[m_head & m_mask]};
+  if (cell.sequence.load(memory_order_acquire) != m_head + 1)
+  {
+    return nullptr;
+  }
+  return &cell.entry;
+}
+
+void
+PostQueue
+::pop()
+{
+  Cell & cell{m_cells[m_head & m_mask]};
+  cell.sequence.store(m_head + m_mask + 1, memory_order_release);
+  ++m_head;
+}
+
+} // namespace state_diagram
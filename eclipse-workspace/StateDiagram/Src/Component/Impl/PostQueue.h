@@ -0,0 +1,67 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_POSTQUEUE_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_POSTQUEUE_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace state_diagram
+{
+
+class PostQueue
+{
+public:
+  class Entry
+  {
+  public:
+    ExternalSignalDelegateImpl * signal;
+    Post * post;
+  };
+
+  PostQueue(size_t const capacity);
+  PostQueue(PostQueue const &) = delete;
+
+  ~PostQueue();
+
+  void operator=(PostQueue const &) = delete;
+
+  bool push(ExternalSignalDelegateImpl * const signal, Post * const post);
+  Entry const * front() const;
+  void pop();
+
+private:
+  class Cell
+  {
+  public:
+    atomic<size_t> sequence;
+    Entry entry;
+  };
+
+  size_t const m_mask;
+  unique_ptr<Cell[]> m_cells;
+  alignas(64) atomic<size_t> m_tail;
+  alignas(64) size_t m_head;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_POSTQUEUE_H_
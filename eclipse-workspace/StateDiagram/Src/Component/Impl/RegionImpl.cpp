@@ -16,28 +16,30 @@
 
 #include "RegionImpl.h"
 
-#include "Util/ListAlgorithm.hpp"
 #include "InitStateImpl.h"
 #include "SourceStateImpl.h"
 #include "TargetStateImpl.h"
 #include "StateImpl.h"
-#include "StackSeq/StackSeq_all.h"
+#include "TopStateImpl.h"
 
 namespace state_diagram
 {
 
+namespace
+{
+  uint32_t constexpr noCurrent{UINT32_MAX};
+}
+
 RegionImpl
 ::RegionImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) CompoundStateImpl * const _parent)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
 , SubComponent{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
 , LocalScope{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent, _parent->topState}
 , m_initState{nullptr}
 , m_subStates{}
-#ifndef STATE_DIAGRAM_STRINGLESS
-, m_subStateNames{}
-#endif // STATE_DIAGRAM_STRINGLESS
 , m_current{nullptr}
+, planIdx{}
 {
   _parent->insertRegion(STATE_DIAGRAM_STRING_ARG_COMMA(_name) this);
 }
@@ -70,45 +72,15 @@ void
 RegionImpl
 ::insertSubState(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) SubStateImpl * const subState)
 {
-  assert(!containsItem(m_subStates, subState));
+  assert(subState->parentRegion() == this);
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_subStateNames.insert(_name).second};
-  if (!stat)
+  if (!topState->claimName(this, TopStateImpl::NameKind::SUB_STATE, subState->nameId))
   {
     throw Region::Error::SubStateNameClash(path(), _name);
   }
 #endif // STATE_DIAGRAM_STRINGLESS
   m_subStates.emplace_front(subState);
-}
-
-bool
-RegionImpl
-::isParentOf(SubStateImpl const * const subState)
-const
-{
-  return containsItem(m_subStates, subState);
-}
-
-unique_ptr<StackSeq::Construct const>
-RegionImpl
-::makeStackSeqConstruct(TargetStateImpl * const target, RegionImpl * const sourceRegion)
-{
-  unique_ptr<StackSeq::Construct const> res
-  {
-    make_unique<StackSeq::Construct::Halt const>(target)
-  };
-  res = make_unique<StackSeq::Construct::Continue const>(target->parentRegion(), res.release());
-  for
-  (
-    // As per the invocation parent, there must be at least one level of nesting above the target region.
-    RegionImpl * transitiveTargetParentRegion{target->parentRegion()->parentState()->parentRegion()}
-  ; transitiveTargetParentRegion != sourceRegion
-  ; transitiveTargetParentRegion = transitiveTargetParentRegion->parentState()->parentRegion()
-  )
-  {
-    res = make_unique<StackSeq::Construct::Continue const>(transitiveTargetParentRegion, res.release());
-  }
-  return res;
+  topState->registerComponent();
 }
 
 void
@@ -145,24 +117,30 @@ const
 
 void
 RegionImpl
-::descendToTarget(StackSeq::Construct const * const stackSeq)
+::enterParentState()
 {
   auto const parentState{this->parentState()};
   parentState->parentRegion()->m_current = parentState;
   parentState->enter();
+  parentState->armTimers();
   parentState->initRegionsExcept(this);
   unsetLocalVars();
-  stackSeq->accept
-  (
-    [&](StackSeq::Construct::Continue const * const sscc)
-    {
-      sscc->exec();
-    }
-  , [&](StackSeq::Construct::Halt const * const ssch)
-    {
-      this->setAsCurrent(ssch->target);
-    }
-  );
+}
+
+void
+RegionImpl
+::exitParentState(TargetStateImpl const * const target)
+const
+{
+  if (target != parentState())
+  {
+    parentCompoundState()->finalizeRegionsExcept(this);
+  }
+  else
+  {
+    parentCompoundState()->finalize();
+  }
+  parentState()->exit();
 }
 
 void
@@ -194,37 +172,15 @@ RegionImpl
 
   assert (execStat.unwindCmd.action == UnwindCmd::Action::UNWIND);
 
+  // The transition has already exited the states in between and entered its target, so only the exec frames of the
+  // exited states are left to be skipped.
   if (this == execStat.unwindCmd.target->parentRegion())
   {
-    m_current = execStat.unwindCmd.target;
-    m_current->init();
     return ExecStat{UnwindCmd{}};
   }
-
-  if (execStat.unwindCmd.target != parentState())
-  {
-    this->parentCompoundState()->finalizeRegionsExcept(this);
-  }
-  else
-  {
-    this->parentCompoundState()->finalize();
-  }
-
-  parentState()->exit();
-
   return execStat;
 }
 
-void
-RegionImpl
-::reload()
-const
-{
-  LocalScope::reload();
-  auto const reloadSubState{[&](SubStateImpl * const subState){subState->reload();}};
-  forEachSubState(reloadSubState);
-}
-
 bool
 RegionImpl
 ::hasAsCurrent(SubStateImpl const * const subState)
@@ -235,26 +191,34 @@ const
 
 void
 RegionImpl
-::forEachSubState(function<void (SubStateImpl * const)> const & f)
+::compile(ExecutionPlan & plan)
+{
+  openScope(plan);
+  compileLocalVars(plan);
+  for (auto const & subState : m_subStates)
+  {
+    subState->planIdx = plan.subStates.push(subState);
+    subState->compile(plan);
+  }
+  closeScope(plan);
+}
+
+uint32_t
+RegionImpl
+::runtimeState()
 const
 {
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachItemRandomly(m_subStates, f);
-#else
-  forEachItem(m_subStates, f);
-#endif // STATE_DIAGRAM_NO_SHUFFLING
+  // Regions that have never been entered have no current sub-state.
+  return (m_current != nullptr) ? m_current->planIdx : noCurrent;
 }
 
 void
 RegionImpl
-::forEachCSubState(function<void (SubStateImpl const * const)> const & f)
-const
+::swapRuntimeState(uint32_t & _runtimeState)
 {
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-  forEachCItemRandomly(m_subStates, f);
-#else
-  forEachCItem(m_subStates, f);
-#endif // STATE_DIAGRAM_NO_SHUFFLING
+  uint32_t const ownRuntimeState{runtimeState()};
+  m_current = (_runtimeState != noCurrent) ? topState->plan().subStates[_runtimeState] : nullptr;
+  _runtimeState = ownRuntimeState;
 }
 
 #ifndef STATE_DIAGRAM_STRINGLESS
@@ -17,12 +17,9 @@
 #ifndef STATE_DIAGRAM_COMPONENT_IMPL_REGIONIMPL_H_
 #define STATE_DIAGRAM_COMPONENT_IMPL_REGIONIMPL_H_
 
-#ifndef STATE_DIAGRAM_STRINGLESS
-#include <set>
-#endif // STATE_DIAGRAM_STRINGLESS
+#include <cstdint>
 
-#include "StackSeq/StackSeq_all.h"
-#include "Util/ForwardList.hpp"
+#include "Util/SmallVector.hpp"
 #include "CompoundStateImpl.h"
 #include "ExecStat.h"
 #include "LocalScope.h"
@@ -32,6 +29,7 @@
 namespace state_diagram
 {
 
+class ExecutionPlan;
 class InitStateImpl;
 class StateImpl;
 
@@ -42,10 +40,7 @@ class RegionImpl
 {
 private:
   InitStateImpl * m_initState;
-  ForwardList<SubStateImpl * const> m_subStates;
-#ifndef STATE_DIAGRAM_STRINGLESS
-  set<string> m_subStateNames;
-#endif // STATE_DIAGRAM_STRINGLESS
+  SmallVector<SubStateImpl * const> m_subStates;
 
   SubStateImpl * m_current;
 
@@ -65,31 +60,25 @@ public:
   void insertInitState(STATE_DIAGRAM_STRING_PARAM_COMMA(name) InitStateImpl * const initState);
   void insertSubState(STATE_DIAGRAM_STRING_PARAM_COMMA(name) SubStateImpl * const subState);
 
-  bool isParentOf(SubStateImpl const * const subState) const;
-
-  unique_ptr<StackSeq::Construct const>
-  makeStackSeqConstruct
-  (
-    TargetStateImpl * const target
-  , RegionImpl * const sourceRegion
-  );
-
   void init();
   void shallowInit();
   void finalize() const;
   bool hasTerminated() const;
-  void descendToTarget(StackSeq::Construct const * const stackSeq);
+  void enterParentState();
+  void exitParentState(TargetStateImpl const * const target) const;
   void setAsCurrent(SubStateImpl * const target);
   ExecStat exec();
-  void reload() const;
 
   bool hasAsCurrent(SubStateImpl const * const subState) const;
 
-private:
-  void forEachSubState(function<void (SubStateImpl * const)> const & f) const;
-  void forEachCSubState(function<void (SubStateImpl const * const)> const & f) const;
+  void compile(ExecutionPlan & plan);
+  uint32_t runtimeState() const;
+  void swapRuntimeState(uint32_t & runtimeState);
+
+  uint32_t planIdx;
 
 #ifndef STATE_DIAGRAM_STRINGLESS
+private:
   void throwSignalNameClashError(string const & signalName) const override;
   void throwVarNameClashError(string const & varName) const override;
 #endif // STATE_DIAGRAM_STRINGLESS
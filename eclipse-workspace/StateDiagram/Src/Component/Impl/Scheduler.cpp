@@ -0,0 +1,66 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "Scheduler.h"
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+namespace state_diagram
+{
+
+Scheduler
+::Scheduler()
+:
+  m_policy{Top::SchedulingPolicy::SHUFFLED}
+, m_randomEngine{}
+, m_nrOfItemsExpected{0}
+, m_scratch{}
+{
+  // This space intentionally left empty
+}
+
+void
+Scheduler
+::setPolicy(Top::SchedulingPolicy const policy)
+{
+  m_policy = policy;
+}
+
+void
+Scheduler
+::seed(unsigned const seed)
+{
+  m_randomEngine.seed(seed);
+}
+
+void
+Scheduler
+::expect(size_t const nrOfItems)
+{
+  m_nrOfItemsExpected += nrOfItems;
+}
+
+void
+Scheduler
+::init()
+{
+  // No sequence can hold more items than the state machine consists of, even when nested.
+  m_scratch.reserve(m_nrOfItemsExpected);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -0,0 +1,230 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_SCHEDULER_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_SCHEDULER_H_
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace state_diagram
+{
+
+class Scheduler
+{
+public:
+  template<class Item, bool isHeldInDeclarationOrder = false> class Sequence;
+
+  Scheduler();
+  Scheduler(Scheduler const &) = delete;
+
+  void operator=(Scheduler const &) = delete;
+
+  void setPolicy(Top::SchedulingPolicy const policy);
+  void seed(unsigned const seed);
+
+  void expect(size_t const nrOfItems);
+  void init();
+
+  template<class Item> void order(vector<Item *> & items);
+  template<class Item> void reorder(vector<Item *> & items);
+
+private:
+  template<class Item> static Item * address(Item * const item);
+  template<class Item> static Item const * address(shared_ptr<Item const> const & item);
+
+  Top::SchedulingPolicy m_policy;
+  minstd_rand m_randomEngine;
+  size_t m_nrOfItemsExpected;
+  vector<void const *> m_scratch;
+};
+
+template<class Item, bool isHeldInDeclarationOrder>
+class Scheduler::Sequence
+{
+public:
+  class const_iterator
+  {
+  public:
+    const_iterator(Sequence const & sequence, size_t const idx)
+    :
+      m_sequence{sequence}
+    , m_idx{idx}
+    {
+      // This space intentionally left empty
+    }
+
+    Item *
+    operator*()
+    const
+    {
+      return m_sequence[m_idx];
+    }
+
+    const_iterator &
+    operator++()
+    {
+      ++m_idx;
+      return *this;
+    }
+
+    bool
+    operator!=(const_iterator const & rhs)
+    const
+    {
+      return m_idx != rhs.m_idx;
+    }
+
+  private:
+    Sequence const & m_sequence;
+    size_t m_idx;
+  };
+
+  template<class... Lists>
+  Sequence(Scheduler & scheduler, Lists const &... lists)
+  :
+    m_scheduler{scheduler}
+  , m_begin{scheduler.m_scratch.size()}
+  {
+    (push(lists), ...);
+    m_end = m_scheduler.m_scratch.size();
+    if (m_scheduler.m_policy == Top::SchedulingPolicy::SHUFFLED)
+    {
+      shuffle(m_scheduler.m_scratch.begin() + m_begin, m_scheduler.m_scratch.begin() + m_end, m_scheduler.m_randomEngine);
+    }
+  }
+
+  Sequence(Sequence const &) = delete;
+
+  ~Sequence()
+  {
+    // Sequences are strictly nested, so the scratch buffer is used as a stack.
+    m_scheduler.m_scratch.resize(m_begin);
+  }
+
+  void operator=(Sequence const &) = delete;
+
+  size_t
+  size()
+  const
+  {
+    return m_end - m_begin;
+  }
+
+  Item *
+  operator[](size_t const idx)
+  const
+  {
+    return static_cast<Item *>(const_cast<void *>(m_scheduler.m_scratch[m_begin + idx]));
+  }
+
+  const_iterator
+  begin()
+  const
+  {
+    return const_iterator{*this, 0};
+  }
+
+  const_iterator
+  end()
+  const
+  {
+    return const_iterator{*this, size()};
+  }
+
+private:
+  template<class List>
+  void
+  push(List const & list)
+  {
+    auto & scratch{m_scheduler.m_scratch};
+    size_t const begin{scratch.size()};
+    for (auto const & item : list)
+    {
+      // Upcast before erasing the type, so that items of derived types are stored at the right address.
+      Item const * const itemUpcast{address(item)};
+      scratch.push_back(itemUpcast);
+    }
+    // Lists are populated at the front, so most hold their items in reverse declaration order. Lists of specs
+    // are populated from the last spec onwards, so they hold their items in declaration order.
+    auto const reversingPolicy
+    {
+      isHeldInDeclarationOrder ? Top::SchedulingPolicy::REVERSE_ORDER : Top::SchedulingPolicy::DECLARATION_ORDER
+    };
+    if (m_scheduler.m_policy == reversingPolicy)
+    {
+      reverse(scratch.begin() + begin, scratch.end());
+    }
+  }
+
+  Scheduler & m_scheduler;
+  size_t const m_begin;
+  size_t m_end;
+};
+
+template<class Item>
+void
+Scheduler
+::order(vector<Item *> & items)
+{
+  if (m_policy == Top::SchedulingPolicy::SHUFFLED)
+  {
+    shuffle(items.begin(), items.end(), m_randomEngine);
+  }
+  else if (m_policy == Top::SchedulingPolicy::DECLARATION_ORDER)
+  {
+    reverse(items.begin(), items.end());
+  }
+}
+
+template<class Item>
+void
+Scheduler
+::reorder(vector<Item *> & items)
+{
+  if (m_policy == Top::SchedulingPolicy::SHUFFLED)
+  {
+    shuffle(items.begin(), items.end(), m_randomEngine);
+  }
+}
+
+template<class Item>
+Item *
+Scheduler
+::address(Item * const item)
+{
+  return item;
+}
+
+template<class Item>
+Item const *
+Scheduler
+::address(shared_ptr<Item const> const & item)
+{
+  return item.get();
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_SCHEDULER_H_
@@ -18,16 +18,23 @@
 
 #include <cassert>
 
+#include "TopStateImpl.h"
+#include "TriggeredTransitionImpl.h"
+
 namespace state_diagram
 {
 
 SignalDelegateImpl
-::SignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM(_name))
+::SignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) TopStateImpl * const topState)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(topState->namePool)}
+, m_topState{topState}
+, m_subscribers{}
+, m_isTouched{false}
 , m_isActive{false}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_isSet{false}
+, m_isTaken{false}
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 {
   // This space intentionally left empty
@@ -45,6 +52,13 @@ const
 
 #endif // STATE_DIAGRAM_STRINGLESS
 
+void
+SignalDelegateImpl
+::subscribe(TriggeredTransitionImpl * const subscriber)
+{
+  m_subscribers.emplace_front(subscriber);
+}
+
 bool
 SignalDelegateImpl
 ::isActive()
@@ -57,7 +71,17 @@ void
 SignalDelegateImpl
 ::activate()
 {
+  if (m_isActive)
+  {
+    return;
+  }
   m_isActive = true;
+  touch();
+  // Only the transitions naming this signal as a trigger need to be looked at during the macro step.
+  for (auto const & subscriber : m_subscribers)
+  {
+    subscriber->arm();
+  }
 }
 
 void
@@ -67,6 +91,7 @@ SignalDelegateImpl
   m_isActive = false;
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   m_isSet = false;
+  m_isTaken = false;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 }
 
@@ -85,8 +110,44 @@ SignalDelegateImpl
 ::markAsSet()
 {
   m_isSet = true;
+  touch();
+}
+
+bool
+SignalDelegateImpl
+::isTaken()
+const
+{
+  return m_isTaken;
+}
+
+void
+SignalDelegateImpl
+::markAsTaken()
+{
+  m_isTaken = true;
 }
 
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
+void
+SignalDelegateImpl
+::reload()
+{
+  m_isTouched = false;
+  deactivate();
+}
+
+void
+SignalDelegateImpl
+::touch()
+{
+  if (m_isTouched)
+  {
+    return;
+  }
+  m_isTouched = true;
+  m_topState->touch(this);
+}
+
 }
@@ -19,17 +19,20 @@
 
 #include "state_diagram/state_diagram.h"
 
+#include "Util/SmallVector.hpp"
 #include "NamePathImpl.h"
 
 namespace state_diagram
 {
 
+class TopStateImpl;
+
 class SignalDelegateImpl
 :
   public NamePathImpl
 {
 protected:
-  SignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM(name));
+  SignalDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) TopStateImpl * const topState);
 
 public:
   virtual
@@ -46,6 +49,8 @@ public:
   using NamePathImpl::path;
 #endif // STATE_DIAGRAM_STRINGLESS
 
+  void subscribe(TriggeredTransitionImpl * const subscriber);
+
   virtual bool isActive() const;
   void activate();
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -57,6 +62,8 @@ public:
 
   bool isSet() const;
   void markAsSet();
+  bool isTaken() const;
+  void markAsTaken();
 
   virtual bool isUnderExecution() const = 0;
 #ifndef STATE_DIAGRAM_STRINGLESS
@@ -65,11 +72,19 @@ public:
 
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
+  void reload();
+
 private:
+  void touch();
+
+  TopStateImpl * const m_topState;
+  SmallVector<TriggeredTransitionImpl * const> m_subscribers;
+  bool m_isTouched;
   bool m_isActive;
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   bool m_isSet;
+  bool m_isTaken;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 };
 
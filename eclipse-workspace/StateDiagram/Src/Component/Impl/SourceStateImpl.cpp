@@ -17,11 +17,9 @@
 #include "SourceStateImpl.h"
 
 #include <cassert>
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-#  include "Util/ShufflingAlgorithm.hpp"
-#endif // STATE_DIAGRAM_NO_SHUFFLING
 #include "AutoTransitionImpl.h"
 #include "StepTransitionImpl.h"
+#include "TimerImpl.h"
 #include "TopStateImpl.h"
 
 namespace state_diagram
@@ -30,10 +28,14 @@ namespace state_diagram
 SourceStateImpl
 ::SourceStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const _parent)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
 , SubStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
 , m_autoTransitions{}
+, m_autoTransitionSlice{}
 , m_stepTransitions{}
+, m_armedStepTransitions{}
+, m_timers{}
+, m_isTouched{false}
 {
   // This space intentionally left empty
 }
@@ -43,13 +45,60 @@ SourceStateImpl
 ::attach(AutoTransitionImpl * const autoTransition)
 {
   m_autoTransitions.emplace_front(autoTransition);
+  parentRegion()->topState->registerComponent();
 }
 
-void
+size_t
 SourceStateImpl
 ::attach(StepTransitionImpl * const stepTransition)
 {
   m_stepTransitions.emplace_front(stepTransition);
+  parentRegion()->topState->registerComponent();
+  return m_stepTransitions.size() - 1;
+}
+
+void
+SourceStateImpl
+::attach(TimerImpl * const timer)
+{
+  m_timers.emplace_front(timer);
+  parentRegion()->topState->registerComponent();
+}
+
+void
+SourceStateImpl
+::arm(StepTransitionImpl * const stepTransition)
+{
+  // Keep armed step transitions in the same relative order as m_stepTransitions, i.e., by descending rank.
+  m_armedStepTransitions.push_back(stepTransition);
+  for
+  (
+    size_t idx{m_armedStepTransitions.size() - 1}
+  ; (idx > 0) && (m_armedStepTransitions[idx - 1]->rank < m_armedStepTransitions[idx]->rank)
+  ; --idx
+  )
+  {
+    swap(m_armedStepTransitions[idx - 1], m_armedStepTransitions[idx]);
+  }
+}
+
+void
+SourceStateImpl
+::touch()
+{
+  if (m_isTouched)
+  {
+    return;
+  }
+  m_isTouched = true;
+  parentRegion()->topState->touch(this);
+}
+
+void
+SourceStateImpl
+::untouch()
+{
+  m_isTouched = false;
 }
 
 size_t
@@ -60,12 +109,12 @@ const
   return m_autoTransitions.size();
 }
 
-SourceStateImpl::AutoTransitions const &
+Table<AutoTransitionImpl *>::Range
 SourceStateImpl
 ::autoTransitions()
 const
 {
-  return m_autoTransitions;
+  return parentRegion()->topState->plan().autoTransitions[m_autoTransitionSlice];
 }
 
 size_t
@@ -84,6 +133,31 @@ const
   return m_stepTransitions;
 }
 
+vector<StepTransitionImpl *> const &
+SourceStateImpl
+::armedStepTransitions()
+const
+{
+  return m_armedStepTransitions;
+}
+
+void
+SourceStateImpl
+::init()
+{
+  armTimers();
+}
+
+void
+SourceStateImpl
+::armTimers()
+{
+  for (auto const & timer : m_timers)
+  {
+    timer->arm();
+  }
+}
+
 ExecStat
 SourceStateImpl
 ::exec()
@@ -93,22 +167,14 @@ const
   parentRegion()->topState->curLocalScope = parentRegion();
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  vector<ExternalTransitionImpl *> shuffler{autoTransitionsSize() + stepTransitionsSize()};
+  // Step transitions none of whose triggers have been activated cannot be enabled, so only armed ones are considered.
+  Scheduler::Sequence<ExternalTransitionImpl> const transitions
   {
-    size_t idx{0};
-    for (auto const & autoTransition : autoTransitions())
-    {
-      shuffler[idx] = autoTransition;
-      ++idx;
-    }
-    for (auto const & stepTransition : stepTransitions())
-    {
-      shuffler[idx] = stepTransition;
-      ++idx;
-    }
-  }
-  random_shuffle(shuffler.begin(), shuffler.end());
-  for (auto const & transition : shuffler)
+    parentRegion()->topState->scheduler()
+  , autoTransitions()
+  , armedStepTransitions()
+  };
+  for (auto const & transition : transitions)
   {
     ExecStat const execStat{transition->exec()};
     if (execStat.stat)
@@ -125,7 +191,7 @@ const
       return execStat;
     }
   }
-  for (auto & transition : stepTransitions())
+  for (auto & transition : armedStepTransitions())
   {
     ExecStat const execStat{transition->exec()};
     if (execStat.stat)
@@ -156,6 +222,7 @@ void
 SourceStateImpl
 ::reload()
 {
+  m_isTouched = false;
   for (auto & autoTransition : m_autoTransitions)
   {
     autoTransition->reload();
@@ -164,6 +231,22 @@ SourceStateImpl
   {
     stepTransition->reload();
   }
+  m_armedStepTransitions.clear();
+}
+
+void
+SourceStateImpl
+::compile(ExecutionPlan & plan)
+{
+  m_autoTransitionSlice = plan.autoTransitions.append(m_autoTransitions);
+  for (auto const & autoTransition : m_autoTransitions)
+  {
+    autoTransition->compile(plan);
+  }
+  for (auto const & stepTransition : m_stepTransitions)
+  {
+    stepTransition->compile(plan);
+  }
 }
 
 bool
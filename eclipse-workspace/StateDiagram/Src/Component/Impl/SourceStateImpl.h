@@ -19,21 +19,25 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "Util/ForwardList.hpp"
+#include <vector>
+
+#include "Util/SmallVector.hpp"
+#include "Util/Table.hpp"
 #include "SubStateImpl.h"
 
 namespace state_diagram
 {
 
 class AutoTransitionImpl;
+class TimerImpl;
 
 class SourceStateImpl
 :
   public virtual SubStateImpl
 {
 protected:
-  using AutoTransitions = ForwardList<AutoTransitionImpl * const>;
-  using StepTransitions = ForwardList<StepTransitionImpl * const>;
+  using AutoTransitions = SmallVector<AutoTransitionImpl * const>;
+  using StepTransitions = SmallVector<StepTransitionImpl * const>;
 
   SourceStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) RegionImpl * const parent);
 
@@ -43,27 +47,42 @@ public:
 #endif // STATE_DIAGRAM_STRINGLESS
 
   void attach(AutoTransitionImpl * const autoTransition);
-  void attach(StepTransitionImpl * const stepTransition);
+  size_t attach(StepTransitionImpl * const stepTransition);
+  void attach(TimerImpl * const timer);
+
+  void arm(StepTransitionImpl * const stepTransition);
+  void touch();
 
 protected:
   size_t autoTransitionsSize() const;
-  AutoTransitions const & autoTransitions() const;
+  Table<AutoTransitionImpl *>::Range autoTransitions() const;
 
   size_t stepTransitionsSize() const;
   StepTransitions const & stepTransitions() const;
 
+  vector<StepTransitionImpl *> const & armedStepTransitions() const;
+
+  void untouch();
+
 public:
+  void init() override;
+  void armTimers();
   ExecStat exec() const override;
   virtual void complete(bool const freeze, FreezeDepth const freezeDepth);
   virtual void finalize() const override;
   void reload() override;
+  void compile(ExecutionPlan & plan) override;
 
   virtual bool isPaused() const;
   virtual bool hasTerminated() const;
 
 private:
   AutoTransitions m_autoTransitions;
+  TableSlice m_autoTransitionSlice;
   StepTransitions m_stepTransitions;
+  vector<StepTransitionImpl *> m_armedStepTransitions;
+  SmallVector<TimerImpl * const> m_timers;
+  bool m_isTouched;
 };
 
 } // namespace state_diagram
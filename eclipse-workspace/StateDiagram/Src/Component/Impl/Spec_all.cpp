@@ -19,46 +19,6 @@
 namespace state_diagram
 {
 
-TriggeredActionSharable
-::TriggeredActionSharable(function<void (Event const &)> const & _triggeredAction)
-:
-  triggeredAction{_triggeredAction}
-{
-  // This space intentionally left empty
-}
-
-TriggeredGuardSharable
-::TriggeredGuardSharable(function<bool (Event const &)> const & _triggeredGuard)
-:
-  triggeredGuard{_triggeredGuard}
-{
-  // This space intentionally left empty
-}
-
-TriggeredOutputSharable
-::TriggeredOutputSharable(function<Output::LocalEventVector (Event const &)> const & _triggeredOutputs)
-:
-  triggeredOutputs{_triggeredOutputs}
-{
-  // This space intentionally left empty
-}
-
-TriggerlessActionSharable
-::TriggerlessActionSharable(function<void ()> const & _triggerlessAction)
-:
-  triggerlessAction{_triggerlessAction}
-{
-  // This space intentionally left empty
-}
-
-TriggerlessGuardSharable
-::TriggerlessGuardSharable(function<bool ()> const & _triggerlessGuard)
-:
-  triggerlessGuard{_triggerlessGuard}
-{
-  // This space intentionally left empty
-}
-
 TriggerlessOutputSharable
 ::TriggerlessOutputSharable(Output::LocalEventVector const & _triggerlessOutputs)
 :
@@ -67,13 +27,5 @@ TriggerlessOutputSharable
   // This space intentionally left empty
 }
 
-TriggerlessOutputFunSharable
-::TriggerlessOutputFunSharable(function<Output::LocalEventVector ()> const & _triggerlessOutputsFun)
-:
-  triggerlessOutputsFun{_triggerlessOutputsFun}
-{
-  // This space intentionally left empty
-}
-
 
 } // namespace state_diagram
@@ -22,46 +22,6 @@
 namespace state_diagram
 {
 
-class TriggeredActionSharable
-{
-public:
-  TriggeredActionSharable(function<void (Event const &)> const & triggeredAction);
-
-  function<void (Event const &)> const triggeredAction;
-};
-
-class TriggeredGuardSharable
-{
-public:
-  TriggeredGuardSharable(function<bool (Event const &)> const & triggeredGuard);
-
-  function<bool (Event const &)> const triggeredGuard;
-};
-
-class TriggeredOutputSharable
-{
-public:
-  TriggeredOutputSharable(function<Output::LocalEventVector (Event const &)> const & triggeredOutputs);
-
-  function<Output::LocalEventVector (Event const &)> const triggeredOutputs;
-};
-
-class TriggerlessActionSharable
-{
-public:
-  TriggerlessActionSharable(function<void ()> const & triggerlessAction);
-
-  function<void ()> const triggerlessAction;
-};
-
-class TriggerlessGuardSharable
-{
-public:
-  TriggerlessGuardSharable(function<bool ()> const & triggerlessGuard);
-
-  function<bool ()> const triggerlessGuard;
-};
-
 class TriggerlessOutputSharable
 {
 public:
@@ -70,14 +30,6 @@ public:
   Output::LocalEventVector triggerlessOutputs;
 };
 
-class TriggerlessOutputFunSharable
-{
-public:
-  TriggerlessOutputFunSharable(function<Output::LocalEventVector ()> const & triggerlessOutputsFun);
-
-  function<Output::LocalEventVector ()> const triggerlessOutputsFun;
-};
-
 } // namespace state_diagram
 
 #endif // STATE_DIAGRAM_COMPONENT_SPEC_ALL_H_
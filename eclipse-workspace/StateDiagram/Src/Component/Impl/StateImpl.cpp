@@ -18,7 +18,6 @@
 
 #include <cassert>
 
-#include "Util/ShufflingAlgorithm.hpp"
 #include "EnterTransitionImpl.h"
 #include "ExitTransitionImpl.h"
 #include "InternalAutoTransitionImpl.h"
@@ -30,8 +29,13 @@
 namespace state_diagram
 {
 
-void
-execBoundaryTransitions(ForwardList<BoundaryTransitionImpl * const> const & boundaryTransitions);
+namespace
+{
+  // Bits of the runtime state of a state as kept by a machine.
+  uint8_t constexpr isPausedBit{1 << 0};
+  uint8_t constexpr isFrozenBit{1 << 1};
+  uint8_t constexpr isFrozenShallowlyBit{1 << 2};
+}
 
 StateImpl
 ::StateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) CompoundStateImpl * const _parent)
@@ -44,7 +48,7 @@ StateImpl
 StateImpl
 ::StateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const _parent)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
 , SubStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
 , CompoundStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent, _parent->topState}
 , SourceStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
@@ -52,6 +56,9 @@ StateImpl
 , m_enterTransitions{}
 , m_exitTransitions{}
 , m_internalTransitions{}
+, m_enterTransitionSlice{}
+, m_exitTransitionSlice{}
+, m_internalTransitionSlice{}
 , m_isPaused{false}
 , m_isFrozen{false}
 , m_freezeDepth{}
@@ -79,6 +86,7 @@ StateImpl
 ::add(EnterTransitionImpl * const enterTransition)
 {
   m_enterTransitions.emplace_front(enterTransition);
+  topState->registerComponent();
 }
 
 void
@@ -86,6 +94,7 @@ StateImpl
 ::add(ExitTransitionImpl * const exitTransition)
 {
   m_exitTransitions.emplace_front(exitTransition);
+  topState->registerComponent();
 }
 
 void
@@ -93,6 +102,7 @@ StateImpl
 ::add(InternalAutoTransitionImpl * const internalAutoTransition)
 {
   m_internalTransitions.emplace_front(internalAutoTransition);
+  topState->registerComponent();
 }
 
 void
@@ -100,14 +110,7 @@ StateImpl
 ::add(InternalStepTransitionImpl * const internalStepTransition)
 {
   m_internalTransitions.emplace_front(internalStepTransition);
-}
-
-bool
-StateImpl
-::isDeepMemberOf(RegionImpl const * const region)
-const
-{
-  return SubStateImpl::isDeepMemberOf(region);
+  topState->registerComponent();
 }
 
 bool
@@ -123,6 +126,8 @@ StateImpl
 ::init()
 {
   m_isPaused = true;
+  touch();
+  armTimers();
   if (!m_isFrozen)
   {
     enter();
@@ -158,7 +163,7 @@ const
   topState->curLocalScope = this;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   unsetLocalVars();
-  execBoundaryTransitions(m_enterTransitions);
+  execBoundaryTransitions(m_enterTransitionSlice);
 }
 
 void
@@ -169,7 +174,7 @@ const
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   topState->curLocalScope = this;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  execBoundaryTransitions(m_exitTransitions);
+  execBoundaryTransitions(m_exitTransitionSlice);
 }
 
 ExecStat
@@ -183,12 +188,15 @@ const
     {
       bool sawSomeInternalTransitionExecuting{false};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-      vector<InternalTransitionImpl *> shuffler{m_internalTransitions.size()};
-      populateShuffle(shuffler, m_internalTransitions);
-      for (auto & internalTransition : shuffler)
+      Scheduler::Sequence<InternalTransitionImpl> const internalTransitions
+      {
+        topState->scheduler()
+      , topState->plan().internalTransitions[m_internalTransitionSlice]
+      };
+      for (auto const & internalTransition : internalTransitions)
 #else
-      for (auto & internalTransition : m_internalTransitions)
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+      for (auto const & internalTransition : topState->plan().internalTransitions[m_internalTransitionSlice])
+#endif // STATE_DIAGRAM_NO_SHUFFLING
       {
         sawSomeInternalTransitionExecuting |= internalTransition->exec().stat;
       }
@@ -198,12 +206,10 @@ const
 
   bool sawSomeRegionExecuting{false};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  vector<RegionImpl *> shuffler{regions().size()};
-  populateShuffle(shuffler, regions());
-  for (auto & region : shuffler)
+  for (auto const & region : Scheduler::Sequence<RegionImpl>{topState->scheduler(), regions()})
 #else
   for (auto & region : regions())
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+#endif // STATE_DIAGRAM_NO_SHUFFLING
   {
     ExecStat const execStat{region->exec()};
     if (execStat.stat)
@@ -254,7 +260,7 @@ const
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   topState->curLocalScope = this;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  execBoundaryTransitions(m_exitTransitions);
+  execBoundaryTransitions(m_exitTransitionSlice);
 }
 
 void
@@ -301,7 +307,6 @@ void
 StateImpl
 ::reload()
 {
-  CompoundStateImpl::reload();
   SourceStateImpl::reload();
   m_isPaused = false;
   for (auto const & internalTransition : m_internalTransitions)
@@ -310,6 +315,63 @@ StateImpl
   }
 }
 
+void
+StateImpl
+::compile(ExecutionPlan & plan)
+{
+  plan.states.push(this);
+  openScope(plan);
+  SourceStateImpl::compile(plan);
+  m_enterTransitionSlice = plan.boundaryTransitions.append(m_enterTransitions);
+  m_exitTransitionSlice = plan.boundaryTransitions.append(m_exitTransitions);
+  m_internalTransitionSlice = plan.internalTransitions.append(m_internalTransitions);
+  for (auto const & enterTransition : m_enterTransitions)
+  {
+    enterTransition->compile(plan);
+  }
+  for (auto const & exitTransition : m_exitTransitions)
+  {
+    exitTransition->compile(plan);
+  }
+  for (auto const & internalTransition : m_internalTransitions)
+  {
+    internalTransition->compile(plan);
+  }
+  compileLocalVars(plan);
+  compileRegions(plan);
+  closeScope(plan);
+}
+
+uint8_t
+StateImpl
+::runtimeState()
+const
+{
+  return static_cast<uint8_t>
+  (
+    (m_isPaused ? isPausedBit : 0)
+  | (m_isFrozen ? isFrozenBit : 0)
+  | ((m_freezeDepth == SHALLOW) ? isFrozenShallowlyBit : 0)
+  );
+}
+
+void
+StateImpl
+::swapRuntimeState(uint8_t & _runtimeState)
+{
+  uint8_t const ownRuntimeState{runtimeState()};
+  m_isPaused = (_runtimeState & isPausedBit) != 0;
+  m_isFrozen = (_runtimeState & isFrozenBit) != 0;
+  m_freezeDepth = ((_runtimeState & isFrozenShallowlyBit) != 0) ? SHALLOW : FULL;
+  // In between macro steps, only states that have just been entered are paused, and these are the ones touched.
+  untouch();
+  if (m_isPaused)
+  {
+    touch();
+  }
+  _runtimeState = ownRuntimeState;
+}
+
 bool
 StateImpl
 ::hasTerminated()
@@ -330,15 +392,16 @@ const
 }
 
 void
-execBoundaryTransitions(ForwardList<BoundaryTransitionImpl * const> const & boundaryTransitions)
+StateImpl
+::execBoundaryTransitions(TableSlice const boundaryTransitionSlice)
+const
 {
+  auto const boundaryTransitions{topState->plan().boundaryTransitions[boundaryTransitionSlice]};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  vector<BoundaryTransitionImpl *> shuffler{boundaryTransitions.size()};
-  populateShuffle(shuffler, boundaryTransitions);
-  for (auto const & boundaryTransition : shuffler)
+  for (auto const & boundaryTransition : Scheduler::Sequence<BoundaryTransitionImpl>{topState->scheduler(), boundaryTransitions})
 #else
   for (auto const & boundaryTransition : boundaryTransitions)
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+#endif // STATE_DIAGRAM_NO_SHUFFLING
   {
     boundaryTransition->exec();
   }
@@ -17,7 +17,9 @@
 #ifndef STATE_DIAGRAM_COMPONENT_IMPL_STATEIMPL_H_
 #define STATE_DIAGRAM_COMPONENT_IMPL_STATEIMPL_H_
 
-#include "Util/ForwardList.hpp"
+#include <cstdint>
+
+#include "Util/SmallVector.hpp"
 #include "CompoundStateImpl.h"
 #include "SourceStateImpl.h"
 #include "TargetStateImpl.h"
@@ -53,7 +55,6 @@ public:
   void add(InternalAutoTransitionImpl * const internalAutoTransition);
   void add(InternalStepTransitionImpl * const internalStepTransition);
 
-  bool isDeepMemberOf(RegionImpl const * const region) const override;
   bool hasInScope(LocalSignalDelegateImpl const * const signal) const override;
 
   void init() override;
@@ -63,27 +64,28 @@ public:
   void finalize() const override;
   void unfreeze() override;
   void complete(bool const freeze, FreezeDepth const freezeDepth) override;
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Woverloaded-virtual"
-#endif
   void reload() override;
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
+  void compile(ExecutionPlan & plan) override;
+  uint8_t runtimeState() const;
+  void swapRuntimeState(uint8_t & runtimeState);
 
   bool hasTerminated() const override;
 
 private:
-  ForwardList<BoundaryTransitionImpl * const> m_enterTransitions;
-  ForwardList<BoundaryTransitionImpl * const> m_exitTransitions;
-  ForwardList<InternalTransitionImpl * const> m_internalTransitions;
+  SmallVector<BoundaryTransitionImpl * const> m_enterTransitions;
+  SmallVector<BoundaryTransitionImpl * const> m_exitTransitions;
+  SmallVector<InternalTransitionImpl * const> m_internalTransitions;
+  TableSlice m_enterTransitionSlice;
+  TableSlice m_exitTransitionSlice;
+  TableSlice m_internalTransitionSlice;
 
   bool m_isPaused;
   bool isPaused() const override;
 
   bool m_isFrozen;
   FreezeDepth m_freezeDepth;
+
+  void execBoundaryTransitions(TableSlice const boundaryTransitionSlice) const;
 };
 
 } // namespace state_diagram
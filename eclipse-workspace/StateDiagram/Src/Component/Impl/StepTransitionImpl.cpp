@@ -27,10 +27,11 @@ StepTransitionImpl
 ::StepTransitionImpl(SourceStateImpl * const _source, TargetStateImpl * const _target)
 :
   ExternalTransitionImpl{_source, _target}
+, rank{source->attach(this)}
 , m_haveFreezeFlag{false}
 , m_freezeDepth{FreezeDepth()}
 {
-  source->attach(this);
+  // This space intentionally left empty
 }
 
 void
@@ -76,5 +77,12 @@ StepTransitionImpl
   TriggeredTransitionImpl::add(guard);
 }
 
+void
+StepTransitionImpl
+::armAtOrigin()
+{
+  source->arm(this);
+}
+
 } // namespace state_diagram
 
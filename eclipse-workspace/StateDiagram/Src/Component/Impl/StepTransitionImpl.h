@@ -55,11 +55,14 @@ public:
 
   ExecStat exec() override;
 
+  size_t const rank;
+
 private:
   bool m_haveFreezeFlag;
   FreezeDepth m_freezeDepth;
 
   void add(Guard const * const guard) override;
+  void armAtOrigin() override;
 };
 
 } // namespace state_diagram
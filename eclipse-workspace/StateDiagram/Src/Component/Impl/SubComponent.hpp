@@ -30,7 +30,7 @@ class SubComponent
 protected:
   SubComponent(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) Parent * const _parent)
   :
-    NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+    NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(_parent->namePool)}
   , parent{_parent}
   {
     // This space intentionally left empty
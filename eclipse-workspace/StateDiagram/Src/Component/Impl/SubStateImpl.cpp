@@ -18,6 +18,9 @@
 
 #include <cassert>
 
+#include "StateImpl.h"
+#include "TopStateImpl.h"
+
 namespace state_diagram
 {
 
@@ -25,6 +28,7 @@ SubStateImpl
 ::SubStateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) RegionImpl * const _parent)
 :
   SubComponent{STATE_DIAGRAM_STRING_ARG_COMMA(_name) _parent}
+, planIdx{}
 {
   // This space intentionally left empty
 }
@@ -42,11 +46,7 @@ SubStateImpl
 ::isDeepMemberOf(RegionImpl const * const region)
 const
 {
-  if (region->isParentOf(this))
-  {
-    return true;
-  }
-  return parentRegion()->parentCompoundState()->isDeepMemberOf(region);
+  return region->encloses(parentRegion());
 }
 
 bool
@@ -94,6 +94,13 @@ SubStateImpl
   // This space intentionally left empty
 }
 
+void
+SubStateImpl
+::compile(ExecutionPlan &)
+{
+  // This space intentionally left empty
+}
+
 bool
 SubStateImpl
 ::isCurrent()
@@ -102,5 +109,26 @@ const
   return parentRegion()->hasAsCurrent(this);
 }
 
+bool
+SubStateImpl
+::isDeeplyCurrent()
+const
+{
+  // Regions keep their current sub-state when their parent state is exited, so each ancestor needs to be checked too.
+  for (SubStateImpl const * subState{this};;)
+  {
+    if (!subState->isCurrent())
+    {
+      return false;
+    }
+    CompoundStateImpl * const parent{subState->parentRegion()->parentCompoundState()};
+    if (parent == parentRegion()->topState)
+    {
+      return true;
+    }
+    subState = parent->asState();
+  }
+}
+
 } // namespace std
 
@@ -19,7 +19,8 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "StackSeq/StackSeq_all.h"
+#include <cstdint>
+
 #include "ExecStat.h"
 #include "RegionImpl.h"
 #include "SubComponent.hpp"
@@ -27,6 +28,8 @@
 namespace state_diagram
 {
 
+class ExecutionPlan;
+
 class SubStateImpl
 :
   public SubComponent<RegionImpl>
@@ -51,8 +54,12 @@ public:
   virtual void finalize() const;
   virtual void unfreeze();
   virtual void reload();
+  virtual void compile(ExecutionPlan & plan);
 
   bool isCurrent() const;
+  bool isDeeplyCurrent() const;
+
+  uint32_t planIdx;
 };
 
 } // namespace state_diagram
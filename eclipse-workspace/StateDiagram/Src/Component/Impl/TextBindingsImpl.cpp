@@ -0,0 +1,116 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "TextBindingsImpl.h"
+
+namespace state_diagram
+{
+
+TextBindingsImpl
+::TextBindingsImpl()
+:
+  imageBindings{}
+, m_guardSlotIds{}
+, m_actionSlotIds{}
+, m_outputSlotIds{}
+, m_signalTypeIds{{"void", Image::voidTypeId}}
+, m_varTypeIds{}
+{
+  // This space intentionally left empty
+}
+
+void
+TextBindingsImpl
+::bind(string const & name, Guard const & guard)
+{
+  imageBindings.bind(idOf(m_guardSlotIds, name), guard);
+}
+
+void
+TextBindingsImpl
+::bind(string const & name, Action const & action)
+{
+  imageBindings.bind(idOf(m_actionSlotIds, name), action);
+}
+
+void
+TextBindingsImpl
+::bind(string const & name, Output const & output)
+{
+  imageBindings.bind(idOf(m_outputSlotIds, name), output);
+}
+
+uint32_t
+TextBindingsImpl
+::bindSignalType(string const & name)
+{
+  return idOf(m_signalTypeIds, name);
+}
+
+uint32_t
+TextBindingsImpl
+::bindVarType(string const & name)
+{
+  return idOf(m_varTypeIds, name);
+}
+
+uint32_t const *
+TextBindingsImpl
+::guardSlotId(string const & name)
+const
+{
+  return lookUp(m_guardSlotIds, name);
+}
+
+uint32_t const *
+TextBindingsImpl
+::actionSlotId(string const & name)
+const
+{
+  return lookUp(m_actionSlotIds, name);
+}
+
+uint32_t const *
+TextBindingsImpl
+::outputSlotId(string const & name)
+const
+{
+  return lookUp(m_outputSlotIds, name);
+}
+
+uint32_t const *
+TextBindingsImpl
+::signalTypeId(string const & name)
+const
+{
+  return lookUp(m_signalTypeIds, name);
+}
+
+uint32_t const *
+TextBindingsImpl
+::varTypeId(string const & name)
+const
+{
+  return lookUp(m_varTypeIds, name);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
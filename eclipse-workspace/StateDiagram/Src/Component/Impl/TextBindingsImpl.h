@@ -0,0 +1,77 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_TEXTBINDINGSIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_TEXTBINDINGSIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace state_diagram
+{
+
+class TextBindingsImpl
+{
+public:
+  TextBindingsImpl();
+  TextBindingsImpl(TextBindingsImpl const &) = delete;
+
+  void operator=(TextBindingsImpl const &) = delete;
+
+  void bind(string const & name, Guard const & guard);
+  void bind(string const & name, Action const & action);
+  void bind(string const & name, Output const & output);
+  uint32_t bindSignalType(string const & name);
+  uint32_t bindVarType(string const & name);
+
+  uint32_t const * guardSlotId(string const & name) const;
+  uint32_t const * actionSlotId(string const & name) const;
+  uint32_t const * outputSlotId(string const & name) const;
+  uint32_t const * signalTypeId(string const & name) const;
+  uint32_t const * varTypeId(string const & name) const;
+
+  ImageBindings const imageBindings;
+
+private:
+  // Names are given IDs in the order they are bound first, so that rebinding a name keeps its ID.
+  static
+  uint32_t
+  idOf(unordered_map<string, uint32_t> & ids, string const & name)
+  {
+    return ids.emplace(name, static_cast<uint32_t>(ids.size())).first->second;
+  }
+
+  static
+  uint32_t const *
+  lookUp(unordered_map<string, uint32_t> const & ids, string const & name)
+  {
+    auto const id{ids.find(name)};
+    return (id != ids.end()) ? &id->second : nullptr;
+  }
+
+  unordered_map<string, uint32_t> m_guardSlotIds;
+  unordered_map<string, uint32_t> m_actionSlotIds;
+  unordered_map<string, uint32_t> m_outputSlotIds;
+  unordered_map<string, uint32_t> m_signalTypeIds;
+  unordered_map<string, uint32_t> m_varTypeIds;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_TEXTBINDINGSIMPL_H_
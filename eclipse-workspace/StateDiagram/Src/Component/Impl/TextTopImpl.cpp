@@ -0,0 +1,661 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "TextTopImpl.h"
+
+#include <cassert>
+
+#include "TextBindingsImpl.h"
+
+namespace state_diagram
+{
+
+TextTopImpl
+::TextTopImpl(string const & text, TextBindingsImpl const * const bindings)
+:
+  m_nameIds{}
+, m_declarations{}
+, m_scopes{Image::topIdx}
+, m_loaded{}
+{
+  JsonDocument const document{text};
+  Loading const loading{document, bindings, as(document.root(), JsonDocument::Kind::OBJECT, "an object")};
+
+  // All components are added before any transition, so that transitions may refer to states, signals and
+  // variables wherever they are declared.
+  addComponents(loading, document.root(), ContainerKind::TOP, Image::topIdx);
+  addTransitions(loading, document.root(), Image::topIdx);
+
+  vector<char> const bytes{loading.writer.bytes()};
+  Image const image{bytes.data(), bytes.size()};
+  m_loaded = make_unique<ImageTop const>(image, bindings->imageBindings);
+}
+
+ImageTop const &
+TextTopImpl
+::loaded()
+const
+{
+  return *m_loaded;
+}
+
+Image::Idx
+TextTopImpl
+::idx(string const & nameKind, string const & path)
+const
+{
+  for (NameKind const kind : {NameKind::STATE, NameKind::SIGNAL, NameKind::VARIABLE})
+  {
+    Image::Idx idx{0};
+    if ((nameKind == str(kind)) && lookUp(kind, path, Image::topIdx, idx))
+    {
+      return idx;
+    }
+  }
+  throw TextTop::NameError(nameKind, path);
+}
+
+void
+TextTopImpl
+::addComponents
+(
+  Loading const & loading
+, Value const & container
+, ContainerKind const containerKind
+, Image::Idx const idx
+)
+{
+  switch (containerKind)
+  {
+  case ContainerKind::TOP:
+    loading.checkMembers(container, {"name", "signals", "vars", "states", "regions", "transitions"});
+    break;
+
+  case ContainerKind::STATE:
+    loading.checkMembers(container, {"name", "kind", "signals", "vars", "states", "regions", "transitions"});
+    break;
+
+  case ContainerKind::REGION:
+    loading.checkMembers(container, {"name", "signals", "vars", "states", "transitions"});
+    break;
+  }
+
+  if (Value const * const signals{loading.member(container, "signals")})
+  {
+    loading.forEachElement
+    (
+      *signals
+    , "an array of signals"
+    , [&](Value const & signal)
+      {
+        as(signal, JsonDocument::Kind::OBJECT, "an object describing a signal");
+        loading.checkMembers(signal, {"name", "type"});
+        Value const * const type{loading.member(signal, "type")};
+        string const typeName{(type != nullptr) ? loading.str(*type, "a type name") : "void"};
+        uint32_t const typeId{bound(loading.bindings->signalTypeId(typeName), "signal type", typeName)};
+        string const name{loading.name(signal)};
+        Image::Idx const signalIdx
+        {
+          (containerKind == ContainerKind::TOP)
+          ? loading.writer.addExternalSignal(name, typeId)
+          : loading.writer.addLocalSignal(name, idx, typeId)
+        };
+        declare(NameKind::SIGNAL, idx, signalIdx, signal, name);
+      }
+    );
+  }
+
+  if (Value const * const vars{loading.member(container, "vars")})
+  {
+    loading.forEachElement
+    (
+      *vars
+    , "an array of variables"
+    , [&](Value const & var)
+      {
+        as(var, JsonDocument::Kind::OBJECT, "an object describing a variable");
+        loading.checkMembers(var, {"name", "type"});
+        Value const * const type{loading.member(var, "type")};
+        if (type == nullptr)
+        {
+          var.throwSyntaxError("a variable has no type");
+        }
+        string const typeName{loading.str(*type, "a type name")};
+        uint32_t const typeId{bound(loading.bindings->varTypeId(typeName), "variable type", typeName)};
+        string const name{loading.name(var)};
+        Image::Idx const varIdx
+        {
+          (containerKind == ContainerKind::TOP)
+          ? loading.writer.addExternalVar(name, typeId)
+          : loading.writer.addLocalVar(name, idx, typeId)
+        };
+        declare(NameKind::VARIABLE, idx, varIdx, var, name);
+      }
+    );
+  }
+
+  if (Value const * const regions{loading.member(container, "regions")})
+  {
+    loading.forEachElement
+    (
+      *regions
+    , "an array of regions"
+    , [&](Value const & region)
+      {
+        as(region, JsonDocument::Kind::OBJECT, "an object describing a region");
+        string const name{loading.name(region)};
+        Image::Idx const regionIdx{loading.writer.addRegion(name, idx)};
+        declare(NameKind::REGION, idx, regionIdx, region, name);
+        addComponents(loading, region, ContainerKind::REGION, regionIdx);
+      }
+    );
+  }
+
+  if (Value const * const subStates{loading.member(container, "states")})
+  {
+    loading.forEachElement
+    (
+      *subStates
+    , "an array of states"
+    , [&](Value const & subState){addSubState(loading, subState, idx);}
+    );
+  }
+}
+
+void
+TextTopImpl
+::addSubState(Loading const & loading, Value const & subState, Image::Idx const parent)
+{
+  as(subState, JsonDocument::Kind::OBJECT, "an object describing a state");
+  Value const * const kind{loading.member(subState, "kind")};
+  string const kindName{(kind != nullptr) ? loading.str(*kind, "a kind of state") : "state"};
+  string const name{loading.name(subState)};
+  if (kindName == "state")
+  {
+    Image::Idx const idx{loading.writer.addState(name, parent)};
+    declare(NameKind::STATE, parent, idx, subState, name);
+    addComponents(loading, subState, ContainerKind::STATE, idx);
+    return;
+  }
+
+  // Pseudo-states have no members of their own, and initial and final states have their names in the text only.
+  loading.checkMembers(subState, {"name", "kind"});
+  if (kindName == "init")
+  {
+    declare(NameKind::STATE, parent, loading.writer.addInit(parent), subState, name);
+  }
+  else if (kindName == "final")
+  {
+    declare(NameKind::STATE, parent, loading.writer.addFinal(parent), subState, name);
+  }
+  else if (kindName == "connector")
+  {
+    declare(NameKind::STATE, parent, loading.writer.addConnector(name, parent), subState, name);
+  }
+  else
+  {
+    kind->throwSyntaxError("unknown kind of state \"" + kindName + "\"");
+  }
+}
+
+void
+TextTopImpl
+::addTransitions(Loading const & loading, Value const & container, Image::Idx const idx)
+const
+{
+  if (Value const * const transitions{loading.member(container, "transitions")})
+  {
+    loading.forEachElement
+    (
+      *transitions
+    , "an array of transitions"
+    , [&](Value const & transition){addTransition(loading, transition, idx);}
+    );
+  }
+  if (Value const * const regions{loading.member(container, "regions")})
+  {
+    loading.document.forEachChild
+    (
+      *regions
+    , [&](Value const & region)
+      {
+        addTransitions(loading, region, *lookUp(NameKind::REGION, loading.name(region), idx));
+      }
+    );
+  }
+  if (Value const * const subStates{loading.member(container, "states")})
+  {
+    loading.document.forEachChild
+    (
+      *subStates
+    , [&](Value const & subState)
+      {
+        addTransitions(loading, subState, *lookUp(NameKind::STATE, loading.name(subState), idx));
+      }
+    );
+  }
+}
+
+void
+TextTopImpl
+::addTransition(Loading const & loading, Value const & transition, Image::Idx const scope)
+const
+{
+  as(transition, JsonDocument::Kind::OBJECT, "an object describing a transition");
+  Value const * const kind{loading.member(transition, "kind")};
+  if (kind == nullptr)
+  {
+    transition.throwSyntaxError("a transition has no kind");
+  }
+  string const kindName{loading.str(*kind, "a kind of transition")};
+
+  bool const isSingleState{(kindName != "auto") && (kindName != "step")};
+  char const * const stateMembers[2]{isSingleState ? "host" : "source", isSingleState ? nullptr : "target"};
+  Image::Idx states[2]{0, 0};
+  for (size_t stateIdx{0}; (stateIdx < 2) && (stateMembers[stateIdx] != nullptr); ++stateIdx)
+  {
+    Value const * const state{loading.member(transition, stateMembers[stateIdx])};
+    if (state == nullptr)
+    {
+      transition.throwSyntaxError(string{"a transition has no "} + stateMembers[stateIdx]);
+    }
+    states[stateIdx] = resolve(NameKind::STATE, *state, loading.str(*state, "a path"), scope);
+  }
+
+  ImageWriter const & writer{loading.writer};
+  Image::Idx idx{0};
+  if (kindName == "auto")
+  {
+    idx = writer.addAuto(states[0], states[1]);
+  }
+  else if (kindName == "step")
+  {
+    idx = writer.addStep(states[0], states[1]);
+  }
+  else if (kindName == "enter")
+  {
+    idx = writer.addEnter(states[0]);
+  }
+  else if (kindName == "exit")
+  {
+    idx = writer.addExit(states[0]);
+  }
+  else if (kindName == "internalStep")
+  {
+    idx = writer.addInternalStep(states[0]);
+  }
+  else if (kindName == "internalAuto")
+  {
+    idx = writer.addInternalAuto(states[0]);
+  }
+  else
+  {
+    kind->throwSyntaxError("unknown kind of transition \"" + kindName + "\"");
+  }
+
+  // Specs are added in the order of the members, as the order of guards and actions matters.
+  loading.document.forEachChild
+  (
+    transition
+  , [&](Value const & spec)
+    {
+      string_view const name{loading.document.name(spec)};
+      bool const isStateMember
+      {
+        (name == stateMembers[0]) || ((stateMembers[1] != nullptr) && (name == stateMembers[1]))
+      };
+      if ((name != "kind") && !isStateMember)
+      {
+        addSpec(loading, idx, spec, scope);
+      }
+    }
+  );
+}
+
+void
+TextTopImpl
+::addSpec(Loading const & loading, Image::Idx const transition, Value const & spec, Image::Idx const scope)
+const
+{
+  ImageWriter const & writer{loading.writer};
+  TextBindingsImpl const * const bindings{loading.bindings};
+  string_view const kind{loading.document.name(spec)};
+  if (kind == "trigger")
+  {
+    loading.forEachName
+    (
+      spec
+    , [&](Value const & signal, string const & path)
+      {
+        writer.addTrigger(transition, resolve(NameKind::SIGNAL, signal, path, scope));
+      }
+    );
+  }
+  else if (kind == "after")
+  {
+    writer.addAfter(transition, Top::Duration{as(spec, JsonDocument::Kind::NUMBER, "a number of nanoseconds").number});
+  }
+  else if (kind == "at")
+  {
+    writer.addAt
+    (
+      transition
+    , Top::TimePoint{Top::Duration{as(spec, JsonDocument::Kind::NUMBER, "a number of nanoseconds").number}}
+    );
+  }
+  else if (kind == "guard")
+  {
+    loading.forEachName
+    (
+      spec
+    , [&](Value const &, string const & name)
+      {
+        writer.addGuard(transition, bound(bindings->guardSlotId(name), "guard", name));
+      }
+    );
+  }
+  else if (kind == "action")
+  {
+    loading.forEachName
+    (
+      spec
+    , [&](Value const &, string const & name)
+      {
+        writer.addAction(transition, bound(bindings->actionSlotId(name), "action", name));
+      }
+    );
+  }
+  else if (kind == "output")
+  {
+    loading.forEachName
+    (
+      spec
+    , [&](Value const & signal, string const & path)
+      {
+        writer.addOutput(transition, resolve(NameKind::SIGNAL, signal, path, scope));
+      }
+    );
+  }
+  else if (kind == "boundOutput")
+  {
+    loading.forEachName
+    (
+      spec
+    , [&](Value const &, string const & name)
+      {
+        writer.addBoundOutput(transition, bound(bindings->outputSlotId(name), "output", name));
+      }
+    );
+  }
+  else if (kind == "freeze")
+  {
+    string const depth{loading.str(spec, "a freeze depth")};
+    if ((depth != "full") && (depth != "shallow"))
+    {
+      spec.throwSyntaxError("unknown freeze depth \"" + depth + "\"");
+    }
+    writer.addFreezeFlag(transition, (depth == "full") ? FreezeDepth::FULL : FreezeDepth::SHALLOW);
+  }
+  else if ((kind == "max1") || (kind == "completion"))
+  {
+    if (as(spec, JsonDocument::Kind::BOOLEAN, "true or false").number == 0)
+    {
+      return;
+    }
+    if (kind == "max1")
+    {
+      writer.addMax1Flag(transition);
+    }
+    else
+    {
+      writer.addCompletionFlag(transition);
+    }
+  }
+  else
+  {
+    spec.throwSyntaxError("unknown member \"" + string{kind} + "\"");
+  }
+}
+
+void
+TextTopImpl
+::declare
+(
+  NameKind const nameKind
+, Image::Idx const scope
+, Image::Idx const idx
+, Value const & declaration
+, string const & name
+)
+{
+  assert (idx == m_scopes.size());
+  m_scopes.push_back(scope);
+  uint32_t const nameId{m_nameIds.emplace(name, static_cast<uint32_t>(m_nameIds.size())).first->second};
+  if (!m_declarations.insert(Declaration{scope, nameKind, nameId, idx}))
+  {
+    declaration.throwSyntaxError(string{"the "} + str(nameKind) + " \"" + name + "\" is declared twice");
+  }
+}
+
+Image::Idx
+TextTopImpl
+::resolve(NameKind const nameKind, Value const & reference, string const & path, Image::Idx const scope)
+const
+{
+  // References are resolved like names in nested scopes, starting with the innermost.
+  for (Image::Idx enclosingScope{scope}; ; enclosingScope = m_scopes[enclosingScope])
+  {
+    Image::Idx idx{0};
+    if (lookUp(nameKind, path, enclosingScope, idx))
+    {
+      return idx;
+    }
+    if (enclosingScope == Image::topIdx)
+    {
+      static_cast<void>(reference);
+      throw TextTop::NameError(str(nameKind), path);
+    }
+  }
+}
+
+bool
+TextTopImpl
+::lookUp(NameKind const nameKind, string const & path, Image::Idx const scope, Image::Idx & idx)
+const
+{
+  string name;
+  Image::Idx const * found{&scope};
+  size_t begin{0};
+  for (size_t end{path.find('.')}; end != string::npos; begin = end + 1, end = path.find('.', begin))
+  {
+    // Leading names of a path name states or regions.
+    name.assign(path, begin, end - begin);
+    Image::Idx const * const state{lookUp(NameKind::STATE, name, *found)};
+    found = (state != nullptr) ? state : lookUp(NameKind::REGION, name, *found);
+    if (found == nullptr)
+    {
+      return false;
+    }
+  }
+  name.assign(path, begin, string::npos);
+  found = lookUp(nameKind, name, *found);
+  if (found == nullptr)
+  {
+    return false;
+  }
+  idx = *found;
+  return true;
+}
+
+Image::Idx const *
+TextTopImpl
+::lookUp(NameKind const nameKind, string const & name, Image::Idx const scope)
+const
+{
+  auto const nameId{m_nameIds.find(name)};
+  if (nameId == m_nameIds.end())
+  {
+    return nullptr;
+  }
+  Declaration const * const declaration{m_declarations.find(Declaration{scope, nameKind, nameId->second, 0})};
+  return (declaration != nullptr) ? &declaration->idx : nullptr;
+}
+
+JsonDocument::Value const &
+TextTopImpl
+::as(Value const & value, JsonDocument::Kind const kind, char const * const expected)
+{
+  if (value.kind != kind)
+  {
+    value.throwSyntaxError(string{"expected "} + expected);
+  }
+  return value;
+}
+
+uint32_t
+TextTopImpl
+::bound(uint32_t const * const id, char const * const nameKind, string const & name)
+{
+  if (id == nullptr)
+  {
+    throw TextTop::NameError(nameKind, name);
+  }
+  return *id;
+}
+
+char const *
+TextTopImpl
+::str(NameKind const nameKind)
+{
+  switch (nameKind)
+  {
+  case NameKind::STATE:
+    return "state";
+
+  case NameKind::REGION:
+    return "region";
+
+  case NameKind::SIGNAL:
+    return "signal";
+
+  case NameKind::VARIABLE:
+    return "variable";
+
+  case NameKind::NONE:
+    break;
+  }
+  return "";
+}
+
+TextTopImpl::Loading
+::Loading(JsonDocument const & _document, TextBindingsImpl const * const _bindings, Value const & top)
+:
+  document{_document}
+, bindings{_bindings}
+, writer{name(top)}
+{
+  // This space intentionally left empty
+}
+
+string
+TextTopImpl::Loading
+::str(Value const & value, char const * const expected)
+const
+{
+  return string{document.str(as(value, JsonDocument::Kind::STRING, expected))};
+}
+
+string
+TextTopImpl::Loading
+::name(Value const & object)
+const
+{
+  Value const * const name{member(object, "name")};
+  if (name == nullptr)
+  {
+    object.throwSyntaxError("a name is missing");
+  }
+  string str{this->str(*name, "a name")};
+  if (str.empty() || (str.find('.') != string::npos))
+  {
+    name->throwSyntaxError("a name must be non-empty and must not contain dots");
+  }
+  return str;
+}
+
+JsonDocument::Value const *
+TextTopImpl::Loading
+::member(Value const & object, char const * const name)
+const
+{
+  return document.member(object, name);
+}
+
+void
+TextTopImpl::Loading
+::checkMembers(Value const & object, initializer_list<char const *> const names)
+const
+{
+  document.forEachChild
+  (
+    object
+  , [&](Value const & member)
+    {
+      string_view const name{document.name(member)};
+      bool isKnown{false};
+      for (char const * const knownName : names)
+      {
+        isKnown = isKnown || (name == knownName);
+      }
+      if (!isKnown)
+      {
+        member.throwSyntaxError("unknown member \"" + string{name} + "\"");
+      }
+    }
+  );
+}
+
+bool
+TextTopImpl
+::Declaration
+::operator==(Declaration const & other)
+const
+{
+  return (scope == other.scope) && (kind == other.kind) && (nameId == other.nameId);
+}
+
+size_t
+TextTopImpl
+::DeclarationHash
+::operator()(Declaration const & declaration)
+const
+{
+  // Scopes and name IDs are both small, so the bits are mixed to spread them over the whole hash.
+  uint64_t hash{(static_cast<uint64_t>(declaration.scope) << 32) | declaration.nameId};
+  hash ^= static_cast<uint64_t>(declaration.kind) << 61;
+  hash ^= hash >> 33;
+  hash *= UINT64_C(0xff51afd7ed558ccd);
+  hash ^= hash >> 33;
+  return static_cast<size_t>(hash);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
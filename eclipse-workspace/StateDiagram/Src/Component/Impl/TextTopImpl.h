@@ -0,0 +1,161 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_TEXTTOPIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_TEXTTOPIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Util/FlatSet.hpp"
+#include "JsonDocument.h"
+
+namespace state_diagram
+{
+
+class TextBindingsImpl;
+
+class TextTopImpl
+{
+public:
+  TextTopImpl(string const & text, TextBindingsImpl const * const bindings);
+  TextTopImpl(TextTopImpl const &) = delete;
+
+  void operator=(TextTopImpl const &) = delete;
+
+  ImageTop const & loaded() const;
+  Image::Idx idx(string const & nameKind, string const & path) const;
+
+private:
+  using Value = JsonDocument::Value;
+
+  enum class ContainerKind
+  {
+    TOP
+  , STATE
+  , REGION
+  };
+
+  enum class NameKind : uint32_t
+  {
+    NONE
+  , STATE
+  , REGION
+  , SIGNAL
+  , VARIABLE
+  };
+
+  // Everything that loading a text refers to, with the image writer being named after the top state.
+  class Loading
+  {
+  public:
+    Loading(JsonDocument const & _document, TextBindingsImpl const * const _bindings, Value const & top);
+
+    JsonDocument const & document;
+    TextBindingsImpl const * const bindings;
+    ImageWriter const writer;
+
+    string str(Value const & value, char const * const expected) const;
+    string name(Value const & object) const;
+    Value const * member(Value const & object, char const * const name) const;
+    void checkMembers(Value const & object, initializer_list<char const *> const names) const;
+
+    template<class F>
+    void
+    forEachElement(Value const & array, char const * const expected, F const & f)
+    const
+    {
+      as(array, JsonDocument::Kind::ARRAY, expected);
+      document.forEachChild(array, f);
+    }
+
+    template<class F>
+    void
+    forEachName(Value const & value, F const & f)
+    const
+    {
+      if (value.kind != JsonDocument::Kind::ARRAY)
+      {
+        f(value, str(value, "a name or an array of names"));
+        return;
+      }
+      document.forEachChild(value, [&](Value const & element){f(element, str(element, "a name"));});
+    }
+  };
+
+  void
+  addComponents
+  (
+    Loading const & loading
+  , Value const & container
+  , ContainerKind const containerKind
+  , Image::Idx const idx
+  );
+  void addSubState(Loading const & loading, Value const & subState, Image::Idx const parent);
+  void addTransitions(Loading const & loading, Value const & container, Image::Idx const idx) const;
+  void addTransition(Loading const & loading, Value const & transition, Image::Idx const scope) const;
+  void addSpec(Loading const & loading, Image::Idx const transition, Value const & spec, Image::Idx const scope) const;
+  void
+  declare
+  (
+    NameKind const nameKind
+  , Image::Idx const scope
+  , Image::Idx const idx
+  , Value const & declaration
+  , string const & name
+  );
+  Image::Idx
+  resolve(NameKind const nameKind, Value const & reference, string const & path, Image::Idx const scope) const;
+  bool lookUp(NameKind const nameKind, string const & path, Image::Idx const scope, Image::Idx & idx) const;
+  Image::Idx const * lookUp(NameKind const nameKind, string const & name, Image::Idx const scope) const;
+
+  static Value const & as(Value const & value, JsonDocument::Kind const kind, char const * const expected);
+  static uint32_t bound(uint32_t const * const id, char const * const nameKind, string const & name);
+  static char const * str(NameKind const nameKind);
+
+  // Names are declared per scope, that is to say, per state or region, and by the IDs of the names rather than by
+  // full paths, so that resolving a reference neither builds paths nor hashes them. Declarations are equal whenever
+  // they declare the same name in the same scope, whatever they refer to.
+  struct Declaration
+  {
+    Image::Idx scope;
+    NameKind kind;
+    uint32_t nameId;
+    Image::Idx idx;
+
+    bool operator==(Declaration const & other) const;
+  };
+
+  struct DeclarationHash
+  {
+    size_t operator()(Declaration const & declaration) const;
+  };
+
+  unordered_map<string, uint32_t> m_nameIds;
+  FlatSet<Declaration, DeclarationHash> m_declarations;
+  vector<Image::Idx> m_scopes;
+  unique_ptr<ImageTop const> m_loaded;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_TEXTTOPIMPL_H_
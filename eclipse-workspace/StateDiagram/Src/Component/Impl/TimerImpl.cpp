@@ -0,0 +1,199 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "TimerImpl.h"
+
+#include <cassert>
+
+#include "SourceStateImpl.h"
+#include "TopStateImpl.h"
+
+namespace state_diagram
+{
+
+TimerImpl
+::TimerImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) SourceStateImpl * const source, Top::Duration const delay)
+:
+  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) source->parentRegion()->topState}
+, m_source{source}
+, m_time{delay}
+, m_isRelative{true}
+, m_epoch{0}
+, m_timeout{this}
+{
+  m_source->attach(this);
+}
+
+TimerImpl
+::TimerImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) SourceStateImpl * const source, Top::TimePoint const deadline)
+:
+  SignalDelegateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) source->parentRegion()->topState}
+, m_source{source}
+, m_time{deadline.time_since_epoch()}
+, m_isRelative{false}
+, m_epoch{0}
+, m_timeout{this}
+{
+  m_source->attach(this);
+}
+
+void
+TimerImpl
+::accept
+(
+  function<void (ExternalSignalDelegateImpl * const)>
+, function<void (LocalSignalDelegateImpl * const)>
+)
+{
+  assert (false); // Never to be called
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+void
+TimerImpl
+::path(ostream & to)
+const
+{
+  m_source->pathPrefix(to);
+  to << name;
+}
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+bool
+TimerImpl
+::isUnderExecution()
+const
+{
+  return topState()->isUnderExecution();
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+string
+TimerImpl
+::curLocalScopePath()
+const
+{
+  return topState()->curLocalScope->path();
+}
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+Event const *
+TimerImpl
+::event()
+const
+{
+  return &m_timeout;
+}
+
+void
+TimerImpl
+::arm()
+{
+  TopStateImpl * const topState{this->topState()};
+  if (topState->isHostingMachine)
+  {
+    // Timers belong to the top state, so machines stepped against it leave them alone.
+    return;
+  }
+  // Arming anew outdates the entry of any earlier arming that is still in the wheel.
+  ++m_epoch;
+  Top::TimePoint const deadline{m_isRelative ? (topState->now() + m_time) : Top::TimePoint{m_time}};
+  topState->schedule(this, m_epoch, deadline);
+}
+
+bool
+TimerImpl
+::expire(uint32_t const epoch)
+{
+  // Leaving the source state cancels the timer, which is only noticed here rather than by searching the wheel.
+  if ((epoch != m_epoch) || !m_source->isDeeplyCurrent())
+  {
+    return false;
+  }
+  activate();
+  return true;
+}
+
+TopStateImpl *
+TimerImpl
+::topState()
+const
+{
+  return m_source->parentRegion()->topState;
+}
+
+TimerImpl::Timeout
+::Timeout(TimerImpl * const timer)
+:
+  m_timer{timer}
+{
+  // This space intentionally left empty
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+string
+TimerImpl::Timeout
+::path()
+const
+{
+  return m_timer->path();
+}
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+bool
+TimerImpl::Timeout
+::isUnderExecution()
+const
+{
+  return m_timer->isUnderExecution();
+}
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+string
+TimerImpl::Timeout
+::curLocalScopePath()
+const
+{
+  return m_timer->curLocalScopePath();
+}
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+SignalDelegateImpl *
+TimerImpl::Timeout
+::implUpcast()
+const
+{
+  return m_timer;
+}
+
+} // namespace state_diagram
@@ -0,0 +1,106 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_TIMERIMPL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_TIMERIMPL_H_
+
+#include "state_diagram/state_diagram.h"
+
+#include <cstdint>
+
+#include "SignalDelegateImpl.h"
+
+namespace state_diagram
+{
+
+class SourceStateImpl;
+class TopStateImpl;
+
+class TimerImpl
+:
+  public SignalDelegateImpl
+{
+public:
+  TimerImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) SourceStateImpl * const source, Top::Duration const delay);
+  TimerImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) SourceStateImpl * const source, Top::TimePoint const deadline);
+  TimerImpl(TimerImpl const &) = delete;
+
+  void operator=(TimerImpl const &) = delete;
+
+  void
+  accept
+  (
+    function<void (ExternalSignalDelegateImpl * const)> onExternal
+  , function<void (LocalSignalDelegateImpl * const)> onLocal
+  )
+  override;
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+  void path(ostream & to) const override;
+  using NamePathImpl::path;
+#endif // STATE_DIAGRAM_STRINGLESS
+
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  bool isUnderExecution() const override;
+#ifndef STATE_DIAGRAM_STRINGLESS
+  string curLocalScopePath() const override;
+#endif // STATE_DIAGRAM_STRINGLESS
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+  Event const * event() const;
+
+  void arm();
+  bool expire(uint32_t const epoch);
+
+private:
+  class Timeout
+  :
+    public Event
+  {
+  public:
+    Timeout(TimerImpl * const timer);
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+    string path() const override;
+#endif // STATE_DIAGRAM_STRINGLESS
+
+  protected:
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+    bool isUnderExecution() const override;
+#ifndef STATE_DIAGRAM_STRINGLESS
+    string curLocalScopePath() const override;
+#endif // STATE_DIAGRAM_STRINGLESS
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+
+  private:
+    SignalDelegateImpl * implUpcast() const override;
+
+    TimerImpl * const m_timer;
+  };
+
+  TopStateImpl * topState() const;
+
+  SourceStateImpl * const m_source;
+  Top::Duration const m_time;
+  bool const m_isRelative;
+  uint32_t m_epoch;
+  Timeout const m_timeout;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_TIMERIMPL_H_
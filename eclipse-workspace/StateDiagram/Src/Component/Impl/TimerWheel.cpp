@@ -0,0 +1,169 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#include "TimerWheel.h"
+
+#include <cassert>
+
+namespace state_diagram
+{
+
+TimerWheel
+::TimerWheel()
+:
+  m_levels{}
+, m_occupancy{}
+, m_overflow{}
+, m_due{}
+, m_scratch{}
+, m_curTick{0}
+{
+  // This space intentionally left empty
+}
+
+uint64_t
+TimerWheel
+::curTick()
+const
+{
+  return m_curTick;
+}
+
+void
+TimerWheel
+::insert(Entry const & entry)
+{
+  // Entries that are due already are handed out by the next advance, however far that goes.
+  place(entry, m_due);
+}
+
+void
+TimerWheel
+::advance(uint64_t const tick, vector<Entry> & expired)
+{
+  assert (tick >= m_curTick);
+  expired.insert(expired.end(), m_due.begin(), m_due.end());
+  m_due.clear();
+  for (;;)
+  {
+    // Ticks in between those of interest have nothing to expire or cascade, so they are skipped altogether.
+    uint64_t const nextTick{nextTickOfInterest()};
+    if (nextTick > tick)
+    {
+      m_curTick = tick;
+      return;
+    }
+    m_curTick = nextTick;
+    if (levelBase(m_curTick, nrOfLevels) == m_curTick)
+    {
+      m_scratch.swap(m_overflow);
+      cascade(m_scratch, expired);
+    }
+    for (unsigned level{nrOfLevels - 1}; level > 0; --level)
+    {
+      if (levelBase(m_curTick, level) == m_curTick)
+      {
+        unsigned const idx{slotIdx(m_curTick, level)};
+        m_scratch.swap(m_levels[level][idx]);
+        m_occupancy[level] &= ~(uint64_t{1} << idx);
+        cascade(m_scratch, expired);
+      }
+    }
+    unsigned const idx{slotIdx(m_curTick, 0)};
+    vector<Entry> & slot{m_levels[0][idx]};
+    expired.insert(expired.end(), slot.begin(), slot.end());
+    slot.clear();
+    m_occupancy[0] &= ~(uint64_t{1} << idx);
+  }
+}
+
+unsigned
+TimerWheel
+::slotIdx(uint64_t const tick, unsigned const level)
+{
+  return static_cast<unsigned>(tick >> (level * slotBits)) & (nrOfSlots - 1);
+}
+
+uint64_t
+TimerWheel
+::levelBase(uint64_t const tick, unsigned const level)
+{
+  // The first tick of the slot at the given level which the tick falls into.
+  return (level * slotBits >= 64) ? 0 : ((tick >> (level * slotBits)) << (level * slotBits));
+}
+
+void
+TimerWheel
+::place(Entry const & entry, vector<Entry> & expired)
+{
+  if (entry.expiry <= m_curTick)
+  {
+    expired.push_back(entry);
+    return;
+  }
+  // An entry goes to the lowest level at which its expiry and the current tick fall into the same slot of the level
+  // above. Its slot there is thus always ahead of the current tick.
+  for (unsigned level{0}; level < nrOfLevels; ++level)
+  {
+    if (levelBase(entry.expiry, level + 1) == levelBase(m_curTick, level + 1))
+    {
+      unsigned const idx{slotIdx(entry.expiry, level)};
+      m_levels[level][idx].push_back(entry);
+      m_occupancy[level] |= uint64_t{1} << idx;
+      return;
+    }
+  }
+  m_overflow.push_back(entry);
+}
+
+void
+TimerWheel
+::cascade(vector<Entry> & entries, vector<Entry> & expired)
+{
+  for (auto const & entry : entries)
+  {
+    place(entry, expired);
+  }
+  entries.clear();
+}
+
+uint64_t
+TimerWheel
+::nextTickOfInterest()
+const
+{
+  uint64_t nextTick{UINT64_MAX};
+  for (unsigned level{0}; level < nrOfLevels; ++level)
+  {
+    unsigned const curIdx{slotIdx(m_curTick, level)};
+    uint64_t const ahead{(curIdx + 1 < nrOfSlots) ? (m_occupancy[level] & ~((uint64_t{2} << curIdx) - 1)) : 0};
+    if (ahead != 0)
+    {
+      uint64_t const idx{static_cast<uint64_t>(__builtin_ctzll(ahead))};
+      uint64_t const tick{levelBase(m_curTick, level + 1) | (idx << (level * slotBits))};
+      nextTick = (tick < nextTick) ? tick : nextTick;
+    }
+  }
+  if (!m_overflow.empty())
+  {
+    uint64_t const tick{levelBase(m_curTick, nrOfLevels) + (uint64_t{1} << (nrOfLevels * slotBits))};
+    nextTick = (tick < nextTick) ? tick : nextTick;
+  }
+  return nextTick;
+}
+
+} // namespace state_diagram
@@ -0,0 +1,76 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_COMPONENT_IMPL_TIMERWHEEL_H_
+#define STATE_DIAGRAM_COMPONENT_IMPL_TIMERWHEEL_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace state_diagram
+{
+
+using namespace std;
+
+class TimerImpl;
+
+class TimerWheel
+{
+public:
+  class Entry
+  {
+  public:
+    TimerImpl * timer;
+    uint64_t expiry;
+    uint32_t epoch;
+  };
+
+  TimerWheel();
+  TimerWheel(TimerWheel const &) = delete;
+
+  void operator=(TimerWheel const &) = delete;
+
+  uint64_t curTick() const;
+  void insert(Entry const & entry);
+  void advance(uint64_t const tick, vector<Entry> & expired);
+
+private:
+  static unsigned constexpr nrOfLevels{6};
+  static unsigned constexpr slotBits{6};
+  static unsigned constexpr nrOfSlots{1 << slotBits};
+
+  using Slots = array<vector<Entry>, nrOfSlots>;
+
+  static unsigned slotIdx(uint64_t const tick, unsigned const level);
+  static uint64_t levelBase(uint64_t const tick, unsigned const level);
+
+  void place(Entry const & entry, vector<Entry> & expired);
+  void cascade(vector<Entry> & entries, vector<Entry> & expired);
+  uint64_t nextTickOfInterest() const;
+
+  array<Slots, nrOfLevels> m_levels;
+  array<uint64_t, nrOfLevels> m_occupancy;
+  vector<Entry> m_overflow;
+  vector<Entry> m_due;
+  vector<Entry> m_scratch;
+  uint64_t m_curTick;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_COMPONENT_IMPL_TIMERWHEEL_H_
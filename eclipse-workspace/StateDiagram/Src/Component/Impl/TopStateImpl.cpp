@@ -17,10 +17,13 @@
 #include "TopStateImpl.h"
 
 #include <cassert>
+#include <memory>
 
 #include "ExternalSignalDelegateImpl.h"
 #include "ExternalVarDelegateImpl.h"
 #include "LocalVarDelegateImpl.h"
+#include "SourceStateImpl.h"
+#include "TimerImpl.h"
 
 namespace state_diagram
 {
@@ -28,17 +31,36 @@ namespace state_diagram
 TopStateImpl
 ::TopStateImpl(STATE_DIAGRAM_STRING_PARAM(_name))
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  // The top state comes first, so it creates the name pool that all of its components intern their names into.
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(*new NamePool{})}
 , CompoundStateImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) this}
+, isHostingMachine{false}
+, arena{new Arena{}}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , curLocalScope{}
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 #ifndef STATE_DIAGRAM_STRINGLESS
-, m_externalSignalNames{}
-, m_externalVarNames{}
+, m_namePool{&namePool}
+, m_claimedNames{}
 #endif // STATE_DIAGRAM_STRINGLESS
 , m_externalSignals{}
 , m_externalVars{}
+, m_regionScheduling{Top::RegionScheduling::RESCAN}
+, m_plan{}
+, m_machineLayout{}
+, m_isCompiled{false}
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+, m_scheduler{}
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+, m_worklist{}
+, m_touchedSignals{}
+, m_touchedVars{}
+, m_reloadedVars{}
+, m_touchedSourceStates{}
+, m_postQueue{Top::postCapacity}
+, m_now{}
+, m_timerWheel{}
+, m_expiredTimers{}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_isUnderExecution{false}
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -73,19 +95,58 @@ const
 
 #endif // STATE_DIAGRAM_STRINGLESS
 
-bool
+void
 TopStateImpl
-::isDeepMemberOf(RegionImpl const * const)
-const
+::init()
 {
-  return false;
+  compile();
+  CompoundStateImpl::init();
 }
 
 void
 TopStateImpl
-::init()
+::compile()
 {
-  CompoundStateImpl::init();
+  // Lower the lists built during construction into contiguous tables, laid out in depth-first order, so that
+  // stepping walks memory linearly rather than chasing list nodes.
+  m_plan.clear();
+  openScope(m_plan);
+  for (auto const & externalSignal : m_externalSignals)
+  {
+    externalSignal->planIdx = m_plan.externalSignals.push(externalSignal);
+  }
+  for (auto const & externalVar : m_externalVars)
+  {
+    externalVar->planIdx = m_plan.vars.push(externalVar);
+  }
+  compileLocalVars(m_plan);
+  compileRegions(m_plan);
+  closeScope(m_plan);
+  m_machineLayout.compute(m_plan);
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  m_scheduler.init();
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+  m_worklist.reserve(regions().size());
+  m_isCompiled = true;
+}
+
+void
+TopStateImpl
+::compileIfStale()
+{
+  if (!m_isCompiled)
+  {
+    // Components have been added since init, so the plan is out of date.
+    compile();
+  }
+}
+
+bool
+TopStateImpl
+::isCompiled()
+const
+{
+  return m_isCompiled;
 }
 
 void
@@ -95,29 +156,185 @@ TopStateImpl
   trigger->activate();
 }
 
+bool
+TopStateImpl
+::post(ExternalSignalDelegateImpl * const signal, Post * const post)
+{
+  return m_postQueue.push(signal, post);
+}
+
 void
 TopStateImpl
-::reload()
+::drainPosts()
+{
+  for (PostQueue::Entry const * front{m_postQueue.front()}; front != nullptr; front = m_postQueue.front())
+  {
+    // A signal is activated at most once per macro step, so a repeated post ends the batch and is left to the next one.
+    if (front->signal->isActive())
+    {
+      break;
+    }
+    PostQueue::Entry const entry{*front};
+    m_postQueue.pop();
+    if (entry.post != nullptr)
+    {
+      unique_ptr<Post> const post{entry.post};
+      post->deliver();
+    }
+    activate(entry.signal);
+  }
+}
+
+Top::TimePoint
+TopStateImpl
+::now()
+const
+{
+  return m_now;
+}
+
+void
+TopStateImpl
+::schedule(TimerImpl * const timer, uint32_t const epoch, Top::TimePoint const deadline)
+{
+  // Deadlines are rounded up to whole ticks, so timers never expire early.
+  Top::Duration const sinceEpoch{deadline.time_since_epoch()};
+  uint64_t const expiry
+  {
+    (sinceEpoch.count() <= 0) ? 0 : static_cast<uint64_t>((sinceEpoch + Top::timerResolution - Top::Duration{1}) / Top::timerResolution)
+  };
+  m_timerWheel.insert(TimerWheel::Entry{timer, expiry, epoch});
+}
+
+bool
+TopStateImpl
+::advanceTime(Top::TimePoint const now)
+{
+  if (now > m_now)
+  {
+    m_now = now;
+  }
+  Top::Duration const sinceEpoch{m_now.time_since_epoch()};
+  uint64_t const tick{(sinceEpoch.count() <= 0) ? 0 : static_cast<uint64_t>(sinceEpoch / Top::timerResolution)};
+  m_timerWheel.advance(tick, m_expiredTimers);
+  bool sawTimerExpiring{false};
+  for (auto const & entry : m_expiredTimers)
+  {
+    sawTimerExpiring |= entry.timer->expire(entry.epoch);
+  }
+  m_expiredTimers.clear();
+  if (!sawTimerExpiring)
+  {
+    return false;
+  }
+  return exec();
+}
+
+void
+TopStateImpl
+::setRegionScheduling(Top::RegionScheduling const regionScheduling)
+{
+  m_regionScheduling = regionScheduling;
+}
+
+void
+TopStateImpl
+::registerComponent()
+{
+  m_isCompiled = false;
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  m_scheduler.expect(1);
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+}
+
+ExecutionPlan const &
+TopStateImpl
+::plan()
+const
+{
+  return m_plan;
+}
+
+MachineImpl::Layout const &
+TopStateImpl
+::machineLayout()
 const
 {
-  CompoundStateImpl::reload();
+  return m_machineLayout;
+}
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+Scheduler &
+TopStateImpl
+::scheduler()
+{
+  return m_scheduler;
+}
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
+void
+TopStateImpl
+::touch(SignalDelegateImpl * const signal)
+{
+  m_touchedSignals.push_back(signal);
+}
+
+void
+TopStateImpl
+::touch(VarDelegateImpl * const var)
+{
+  m_touchedVars.push_back(var);
+}
+
+void
+TopStateImpl
+::touch(SourceStateImpl * const sourceState)
+{
+  m_touchedSourceStates.push_back(sourceState);
+}
+
+void
+TopStateImpl
+::forgetTouched()
+{
+  m_touchedSourceStates.clear();
+  m_touchedVars.clear();
+}
+
+void
+TopStateImpl
+::reload()
+{
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   m_isUnderExecution = false;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  for (auto const & externalSignal : m_externalSignals)
+  // Only what has been touched since the previous reload needs to be reset, rather than the whole diagram.
+  for (auto const & sourceState : m_touchedSourceStates)
   {
-    externalSignal->deactivate();
+    sourceState->reload();
   }
-  for (auto const & externalVar : m_externalVars)
+  m_touchedSourceStates.clear();
+  for (auto const & signal : m_touchedSignals)
+  {
+    signal->reload();
+  }
+  m_touchedSignals.clear();
+  // Committing a next value touches a variable anew, for it remains set during the subsequent macro step.
+  m_reloadedVars.swap(m_touchedVars);
+  for (auto const & var : m_reloadedVars)
   {
-    externalVar->unset();
+    var->reload();
   }
+  m_reloadedVars.clear();
 }
 
 bool
 TopStateImpl
 ::exec()
 {
+  compileIfStale();
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   m_isUnderExecution = true;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -125,7 +342,7 @@ TopStateImpl
   class Reloader
   {
   public:
-    Reloader(TopStateImpl const * const subject)
+    Reloader(TopStateImpl * const subject)
     :
       m_subject{subject}
     {
@@ -141,11 +358,22 @@ TopStateImpl
     void operator=(Reloader const &) = delete;
 
   private:
-    TopStateImpl const * const m_subject;
+    TopStateImpl * const m_subject;
   };
 
   Reloader const reloader(this);
 
+  if (m_regionScheduling == Top::RegionScheduling::WORKLIST)
+  {
+    return execFromWorklist();
+  }
+  return execRescanning();
+}
+
+bool
+TopStateImpl
+::execRescanning()
+{
   bool sawAllRegionsTerminated;
 
   for (;;)
@@ -166,7 +394,7 @@ TopStateImpl
       }
     };
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    forEachRegionRandomly(stepRegion);
+    forEachRegionScheduled(stepRegion);
 #else
     forEachRegion(stepRegion);
 #endif // STATE_DIAGRAM_NO_SHUFFLING
@@ -179,6 +407,43 @@ TopStateImpl
   return sawAllRegionsTerminated;
 }
 
+bool
+TopStateImpl
+::execFromWorklist()
+{
+  m_worklist.assign(regions().begin(), regions().end());
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  m_scheduler.order(m_worklist);
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
+  while (!m_worklist.empty())
+  {
+    // Only the regions that have had a transition firing are kept, in their current order.
+    size_t nrOfActiveRegions{0};
+    for (size_t idx{0}; idx < m_worklist.size(); ++idx)
+    {
+      RegionImpl * const region{m_worklist[idx]};
+      ExecStat const execStat{region->exec()};
+      if (execStat.stat)
+      {
+        if (execStat.unwindCmd.action == UnwindCmd::Action::UNWIND)
+        {
+          assert (false);
+        }
+        m_worklist[nrOfActiveRegions++] = region;
+      }
+    }
+    m_worklist.resize(nrOfActiveRegions);
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+    m_scheduler.reorder(m_worklist);
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+  }
+
+  bool sawAllRegionsTerminated{true};
+  forEachCRegion([&](RegionImpl const * const region){sawAllRegionsTerminated &= region->hasTerminated();});
+  return sawAllRegionsTerminated;
+}
+
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
 bool
@@ -214,13 +479,13 @@ TopStateImpl
 ::insertExternalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) ExternalSignalDelegateImpl * const externalSignal)
 {
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_externalSignalNames.emplace(_name).second};
-  if (!stat)
+  if (!claimName(this, NameKind::EXTERNAL_SIGNAL, externalSignal->nameId))
   {
     throw ExternalSignalDelegate::NameClashError(_name);
   }
 #endif // STATE_DIAGRAM_STRINGLESS
   m_externalSignals.emplace_front(externalSignal);
+  registerComponent();
 }
 
 void
@@ -228,13 +493,50 @@ TopStateImpl
 ::insertExternalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) ExternalVarDelegateImpl * const externalVar)
 {
 #ifndef STATE_DIAGRAM_STRINGLESS
-  auto const stat{m_externalVarNames.emplace(_name).second};
-  if (!stat)
+  if (!claimName(this, NameKind::EXTERNAL_VAR, externalVar->nameId))
   {
     throw ExternalVarDelegate::NameClashError(_name);
   }
 #endif // STATE_DIAGRAM_STRINGLESS
   m_externalVars.emplace_front(externalVar);
+  registerComponent();
 }
 
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+bool
+TopStateImpl
+::claimName(LocalScope const * const owner, NameKind const kind, NameId const nameId)
+{
+  // Names only have to be unique per owner and kind, so all of them are claimed within a single set, which spares
+  // every scope a set of its own.
+  return m_claimedNames.insert(ClaimedName{owner, kind, nameId});
+}
+
+bool
+TopStateImpl
+::ClaimedName
+::operator==(ClaimedName const & other)
+const
+{
+  return (owner == other.owner) && (kind == other.kind) && (nameId == other.nameId);
+}
+
+size_t
+TopStateImpl
+::ClaimedNameHash
+::operator()(ClaimedName const & claimedName)
+const
+{
+  // Owners are aligned pointers and name IDs are small, so the bits are mixed to spread them over the whole hash.
+  uint64_t hash{reinterpret_cast<uintptr_t>(claimedName.owner)};
+  hash ^= (static_cast<uint64_t>(claimedName.nameId) << 3) ^ (static_cast<uint64_t>(claimedName.kind) << 61);
+  hash ^= hash >> 33;
+  hash *= UINT64_C(0xff51afd7ed558ccd);
+  hash ^= hash >> 33;
+  return static_cast<size_t>(hash);
+}
+
+#endif // STATE_DIAGRAM_STRINGLESS
+
 } // namespace state_diagram
@@ -19,17 +19,28 @@
 
 #include "state_diagram/state_diagram.h"
 
+#include <vector>
+
 #ifndef STATE_DIAGRAM_STRINGLESS
-#include <set>
+#include "Util/FlatSet.hpp"
 #endif // STATE_DIAGRAM_STRINGLESS
-
-#include "Util/ForwardList.hpp"
+#include "Util/SmallVector.hpp"
+#include "Arena.h"
 #include "CompoundStateImpl.h"
+#include "ExecutionPlan.h"
+#include "MachineImpl.h"
+#include "PostQueue.h"
+#include "Scheduler.h"
+#include "TimerWheel.h"
 
 namespace state_diagram
 {
 
 class LocalVarDelegateImpl;
+class SignalDelegateImpl;
+class SourceStateImpl;
+class TimerImpl;
+class VarDelegateImpl;
 
 class TopStateImpl
 :
@@ -49,13 +60,35 @@ public:
   void path(ostream & to) const override;
 #endif // STATE_DIAGRAM_STRINGLESS
 
-  bool isDeepMemberOf(RegionImpl const * const region) const override;
-
   void activate(ExternalSignalDelegateImpl * const trigger);
+  bool post(ExternalSignalDelegateImpl * const signal, Post * const post);
+  void drainPosts();
+
+  Top::TimePoint now() const;
+  void schedule(TimerImpl * const timer, uint32_t const epoch, Top::TimePoint const deadline);
+  bool advanceTime(Top::TimePoint const now);
+  bool isHostingMachine;
+  Arena * const arena;
+
+  void setRegionScheduling(Top::RegionScheduling const regionScheduling);
+
+  void registerComponent();
+  void compileIfStale();
+  bool isCompiled() const;
+  ExecutionPlan const & plan() const;
+  MachineImpl::Layout const & machineLayout() const;
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  Scheduler & scheduler();
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
+  void touch(SignalDelegateImpl * const signal);
+  void touch(VarDelegateImpl * const var);
+  void touch(SourceStateImpl * const sourceState);
+  void forgetTouched();
 
   void init() override;
   bool exec();
-  void reload() const override;
+  void reload();
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   LocalScope const * curLocalScope;
@@ -67,15 +100,64 @@ public:
   void insertExternalSignal(STATE_DIAGRAM_STRING_PARAM_COMMA(name) ExternalSignalDelegateImpl * const externalSignal);
   void insertExternalVar(STATE_DIAGRAM_STRING_PARAM_COMMA(name) ExternalVarDelegateImpl * const externalVar);
 
+#ifndef STATE_DIAGRAM_STRINGLESS
+  enum class NameKind : uint32_t
+  {
+    NONE
+  , SUB_STATE
+  , REGION
+  , LOCAL_SIGNAL
+  , LOCAL_VAR
+  , EXTERNAL_SIGNAL
+  , EXTERNAL_VAR
+  };
+
+  bool claimName(LocalScope const * const owner, NameKind const kind, NameId const nameId);
+#endif // STATE_DIAGRAM_STRINGLESS
+
 private:
+  void compile();
+  bool execRescanning();
+  bool execFromWorklist();
+
 #ifndef STATE_DIAGRAM_STRINGLESS
-  set<string> m_externalSignalNames;
-  set<string> m_externalVarNames;
+  struct ClaimedName
+  {
+    LocalScope const * owner;
+    NameKind kind;
+    NameId nameId;
+
+    bool operator==(ClaimedName const & other) const;
+  };
+
+  struct ClaimedNameHash
+  {
+    size_t operator()(ClaimedName const & claimedName) const;
+  };
+
+  unique_ptr<NamePool> const m_namePool;
+  FlatSet<ClaimedName, ClaimedNameHash> m_claimedNames;
 #endif // STATE_DIAGRAM_STRINGLESS
-  ForwardList<ExternalSignalDelegateImpl * const> m_externalSignals;
-  ForwardList<ExternalVarDelegateImpl * const> m_externalVars;
+  SmallVector<ExternalSignalDelegateImpl * const> m_externalSignals;
+  SmallVector<ExternalVarDelegateImpl * const> m_externalVars;
+  Top::RegionScheduling m_regionScheduling;
+  ExecutionPlan m_plan;
+  MachineImpl::Layout m_machineLayout;
+  bool m_isCompiled;
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+  Scheduler m_scheduler;
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+  vector<RegionImpl *> m_worklist;
+  vector<SignalDelegateImpl *> m_touchedSignals;
+  vector<VarDelegateImpl *> m_touchedVars;
+  vector<VarDelegateImpl *> m_reloadedVars;
+  vector<SourceStateImpl *> m_touchedSourceStates;
+  PostQueue m_postQueue;
+  Top::TimePoint m_now;
+  TimerWheel m_timerWheel;
+  vector<TimerWheel::Entry> m_expiredTimers;
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-  mutable bool m_isUnderExecution;
+  bool m_isUnderExecution;
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 };
 
@@ -17,6 +17,7 @@
 #include "TransitionImpl.h"
 
 #include "SubStateImpl.h"
+#include "TopStateImpl.h"
 
 namespace state_diagram
 {
@@ -27,5 +28,13 @@ TransitionImpl
   // This space intentionally left empty
 }
 
+TopStateImpl *
+TransitionImpl
+::topState()
+const
+{
+  return origin()->parentRegion()->topState;
+}
+
 } // namespace state_diagram
 
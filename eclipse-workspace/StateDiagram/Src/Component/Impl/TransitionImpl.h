@@ -30,6 +30,8 @@ class TriggeredTransitionImpl;
 class SingleStateTransitionImpl;
 class AutoTransitionImpl;
 class StepTransitionImpl;
+class ExecutionPlan;
+class TopStateImpl;
 
 class TransitionImpl
 {
@@ -64,8 +66,11 @@ public:
 #pragma GCC diagnostic pop
 #endif
 
+  virtual void compile(ExecutionPlan & plan) = 0;
+
 protected:
   virtual SubStateImpl const * outputScope() const = 0;
+  TopStateImpl * topState() const;
 };
 
 } // namespace state_diagram
@@ -17,9 +17,6 @@
 #include "TriggeredTransitionImpl.h"
 
 #include "Util/ListAlgorithm.hpp"
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-#  include "Util/ShufflingAlgorithm.hpp"
-#endif // STATE_DIAGRAM_NO_SHUFFLING
 #include "ExternalSignalDelegateImpl.h"
 #include "LocalSignalDelegateImpl.h"
 #include "Spec_all.h"
@@ -31,10 +28,16 @@ namespace state_diagram
 TriggeredTransitionImpl
 ::TriggeredTransitionImpl()
 :
-  m_triggers{}
+  m_isArmed{false}
+, m_triggers{}
 , m_guards{}
 , m_outputs{}
 , m_actions{}
+, m_timers{}
+, m_triggerSlice{}
+, m_guardSlice{}
+, m_outputSlice{}
+, m_actionSlice{}
 {
   // This space intentionally left empty
 }
@@ -72,6 +75,8 @@ TriggeredTransitionImpl
   if (!containsItem(m_triggers, trigger))
   {
     m_triggers.emplace_front(trigger);
+    trigger->implUpcast()->subscribe(this);
+    topState()->registerComponent();
   }
 }
 
@@ -82,11 +87,26 @@ TriggeredTransitionImpl
   add(&trigger->signal);
 }
 
+void
+TriggeredTransitionImpl
+::add(After const * const after)
+{
+  add(ComponentPtr<TimerImpl>{makeComponent<TimerImpl>(STATE_DIAGRAM_STRING_ARG_COMMA("after") origin(), after->delay)});
+}
+
+void
+TriggeredTransitionImpl
+::add(At const * const at)
+{
+  add(ComponentPtr<TimerImpl>{makeComponent<TimerImpl>(STATE_DIAGRAM_STRING_ARG_COMMA("at") origin(), at->deadline)});
+}
+
 void
 TriggeredTransitionImpl
 ::add(Guard const * const guard)
 {
   m_guards.emplace_front(guard->triggered);
+  topState()->registerComponent();
 }
 
 void
@@ -109,6 +129,7 @@ TriggeredTransitionImpl
     }
   }
   m_outputs.emplace_front(output->triggered);
+  topState()->registerComponent();
 }
 
 void
@@ -116,83 +137,123 @@ TriggeredTransitionImpl
 ::add(Action const * const action)
 {
   m_actions.emplace_front(action->triggered);
+  topState()->registerComponent();
+}
+
+void
+TriggeredTransitionImpl
+::compile(ExecutionPlan & plan)
+{
+  m_triggerSlice = plan.triggers.append(m_triggers);
+  m_guardSlice = plan.triggeredGuards.append(m_guards, [](auto const & guard){return guard.get();});
+  m_outputSlice = plan.triggeredOutputs.append(m_outputs, [](auto const & output){return output.get();});
+  m_actionSlice = plan.triggeredActions.append(m_actions, [](auto const & action){return action.get();});
+}
+
+void
+TriggeredTransitionImpl
+::arm()
+{
+  if (m_isArmed)
+  {
+    return;
+  }
+  m_isArmed = true;
+  origin()->touch();
+  armAtOrigin();
+}
+
+bool
+TriggeredTransitionImpl
+::isArmed()
+const
+{
+  return m_isArmed;
 }
 
 ExecStat
 TriggeredTransitionImpl
 ::exec()
 {
+  if (!m_isArmed)
+  {
+    return ExecStat{};
+  }
   if (!isMax1Enabled())
   {
     return ExecStat{};
   }
-  Event const * const trigger{chooseTriggerCheckGuards()};
+  ExecutionPlan const & plan{topState()->plan()};
+  Event const * const trigger{chooseTriggerCheckGuards(plan)};
   if (trigger == nullptr)
   {
     return ExecStat{};
   }
   max1Disable();
+  origin()->touch();
   {
+    OutputEmitter const emit{outputScope()};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggeredOutputSharable const *> shuffler{m_outputs.size()};
-    populateShuffle(shuffler, m_outputs);
-    for (auto const & output : shuffler)
+    Scheduler::Sequence<TriggeredOutputSharable const, true> const outputs
+    {
+      topState()->scheduler()
+    , plan.triggeredOutputs[m_outputSlice]
+    };
+    for (auto const & output : outputs)
 #else
-    for (auto const & output : m_outputs)
+    for (auto const & output : plan.triggeredOutputs[m_outputSlice])
 #endif // STATE_DIAGRAM_NO_SHUFFLING
     {
-      auto const & outputEvents{output->triggeredOutputs(*trigger)};
-      for (auto const & outputEvent : outputEvents)
-      {
-#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-        // Check whether output signals, which must always be local, lie in scope.
-        if (!outputScope()->hasInScope(outputEvent.get().impl()))
-        {
-#ifndef STATE_DIAGRAM_STRINGLESS
-          throw Transition::ScopeError::Output(outputEvent.get().path(), outputScope()->parentRegion()->path());
-#else
-          STATE_DIAGRAM_HANDLE_ERROR(Transition::scopeError_output);
-#endif // STATE_DIAGRAM_STRINGLESS
-        }
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-        outputEvent.get().implUpcast()->activate();
-      }
+      (*output)(*trigger, emit);
     }
   }
   {
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggeredActionSharable const *> shuffler{m_actions.size()};
-    populateShuffle(shuffler, m_actions);
-    for (auto const & action : shuffler)
+    Scheduler::Sequence<TriggeredActionSharable const, true> const actions
+    {
+      topState()->scheduler()
+    , plan.triggeredActions[m_actionSlice]
+    };
+    for (auto const & action : actions)
 #else
-    for (auto const & action : m_actions)
+    for (auto const & action : plan.triggeredActions[m_actionSlice])
 #endif // STATE_DIAGRAM_NO_SHUFFLING
     {
-      action->triggeredAction(*trigger);
+      (*action)(*trigger);
     }
   }
   return ExecStat{UnwindCmd{}};
 }
 
+void
+TriggeredTransitionImpl
+::reload()
+{
+  MaxableTransition::reload();
+  m_isArmed = false;
+}
+
+void
+TriggeredTransitionImpl
+::add(ComponentPtr<TimerImpl> && timer)
+{
+  // A timer is a trigger of its own that no one else can refer to, so it needs no scope check.
+  m_triggers.emplace_front(timer->event());
+  timer->subscribe(this);
+  m_timers.emplace_front(move(timer));
+  topState()->registerComponent();
+}
+
 Event const *
 TriggeredTransitionImpl
-::chooseTriggerCheckGuards()
+::chooseTriggerCheckGuards(ExecutionPlan const & plan)
 const
 {
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-  vector<Event const *> shuffler{m_triggers.size()};
-  {
-    size_t idx{0};
-    for (auto const & trigger : m_triggers)
-    {
-      shuffler[idx] = trigger;
-      ++idx;
-    }
-  }
-  random_shuffle(shuffler.begin(), shuffler.end());
-  for (auto const & trigger : shuffler)
+  Scheduler::Sequence<Event const, true> const triggers{topState()->scheduler(), plan.triggers[m_triggerSlice]};
+  for (auto const & trigger : triggers)
 #else
-  for (auto const & trigger : m_triggers)
+  for (auto const & trigger : plan.triggers[m_triggerSlice])
 #endif // STATE_DIAGRAM_NO_SHUFFLING
   {
     if (!trigger->implUpcast()->isActive())
@@ -201,14 +262,17 @@ const
     }
     bool sawGuardYieldingFalseOnTrigger{false};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggeredGuardSharable const *> _shuffler{m_guards.size()};
-    populateShuffle(_shuffler, m_guards);
-    for (auto const & guard : _shuffler)
+    Scheduler::Sequence<TriggeredGuardSharable const, true> const guards
+    {
+      topState()->scheduler()
+    , plan.triggeredGuards[m_guardSlice]
+    };
+    for (auto const & guard : guards)
 #else
-    for (auto const & guard : m_guards)
+    for (auto const & guard : plan.triggeredGuards[m_guardSlice])
 #endif // STATE_DIAGRAM_NO_SHUFFLING
     {
-      if (!guard->triggeredGuard(*trigger))
+      if (!(*guard)(*trigger))
       {
         sawGuardYieldingFalseOnTrigger = true;
         break;
@@ -19,9 +19,12 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "Util/ForwardList.hpp"
+#include "Util/ComponentAllocator.hpp"
+#include "Util/SmallVector.hpp"
+#include "Util/Table.hpp"
 #include "MaxableTransition.h"
 #include "Spec_all.h"
+#include "TimerImpl.h"
 #include "TransitionImpl.h"
 
 namespace state_diagram
@@ -52,19 +55,38 @@ public:
 
   void add(Event const * const trigger);
   void add(Trigger const * const trigger);
+  void add(After const * const after);
+  void add(At const * const at);
   void add(Guard const * const guard);
   void add(Output const * const output);
   void add(Action const * const action);
 
+  void compile(ExecutionPlan & plan) override;
+
+  void arm();
+  bool isArmed() const;
+
   virtual ExecStat exec();
+  void reload();
 
 private:
-  Event const * chooseTriggerCheckGuards() const;
+  virtual void armAtOrigin() = 0;
+
+  Event const * chooseTriggerCheckGuards(ExecutionPlan const & plan) const;
+  void add(ComponentPtr<TimerImpl> && timer);
+
+  bool m_isArmed;
+
+  SmallVector<Event const * const> m_triggers;
+  SmallVector<TriggeredGuard const> m_guards;
+  SmallVector<TriggeredOutput const> m_outputs;
+  SmallVector<TriggeredAction const> m_actions;
+  SmallVector<ComponentPtr<TimerImpl> const> m_timers;
 
-  ForwardList<Event const * const> m_triggers;
-  ForwardList<TriggeredGuard const> m_guards;
-  ForwardList<TriggeredOutput const> m_outputs;
-  ForwardList<TriggeredAction const> m_actions;
+  TableSlice m_triggerSlice;
+  TableSlice m_guardSlice;
+  TableSlice m_outputSlice;
+  TableSlice m_actionSlice;
 };
 
 }
@@ -17,9 +17,6 @@
 #include "TriggerlessTransitionImpl.h"
 
 #include <cassert>
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-#  include "Util/ShufflingAlgorithm.hpp"
-#endif // STATE_DIAGRAM_NO_SHUFFLING
 #include "LocalSignalDelegateImpl.h"
 #include "MaxableTransition.h"
 #include "Spec_all.h"
@@ -34,6 +31,9 @@ TriggerlessTransitionImpl
   m_guards{}
 , m_outputFuns{}
 , m_actions{}
+, m_guardSlice{}
+, m_outputFunSlice{}
+, m_actionSlice{}
 {
   // This space intentionally left empty
 }
@@ -60,6 +60,28 @@ TriggerlessTransitionImpl
 #endif // STATE_DIAGRAM_STRINGLESS
 }
 
+void
+TriggerlessTransitionImpl
+::add(After const * const)
+{
+#ifndef STATE_DIAGRAM_STRINGLESS
+  throw Transition::Spec::TriggerSpecOnTriggerlessTransitionError(transitionTypeIndicator(), origin()->path());
+#else
+  STATE_DIAGRAM_HANDLE_ERROR(Transition::Spec::triggerSpecOnTriggerlessTransitionError);
+#endif // STATE_DIAGRAM_STRINGLESS
+}
+
+void
+TriggerlessTransitionImpl
+::add(At const * const)
+{
+#ifndef STATE_DIAGRAM_STRINGLESS
+  throw Transition::Spec::TriggerSpecOnTriggerlessTransitionError(transitionTypeIndicator(), origin()->path());
+#else
+  STATE_DIAGRAM_HANDLE_ERROR(Transition::Spec::triggerSpecOnTriggerlessTransitionError);
+#endif // STATE_DIAGRAM_STRINGLESS
+}
+
 void
 TriggerlessTransitionImpl
 ::add(Guard const * const guard)
@@ -74,6 +96,7 @@ TriggerlessTransitionImpl
 #endif // STATE_DIAGRAM_STRINGLESS
   }
   m_guards.emplace_front(guard->triggerless);
+  topState()->registerComponent();
 }
 
 void
@@ -105,6 +128,7 @@ TriggerlessTransitionImpl
     }
   }
   m_outputFuns.emplace_front(output->triggerlessFun);
+  topState()->registerComponent();
 }
 
 void
@@ -121,64 +145,70 @@ TriggerlessTransitionImpl
 #endif // STATE_DIAGRAM_STRINGLESS
   }
   m_actions.emplace_front(action->triggerless);
+  topState()->registerComponent();
+}
+
+void
+TriggerlessTransitionImpl
+::compile(ExecutionPlan & plan)
+{
+  m_guardSlice = plan.triggerlessGuards.append(m_guards, [](auto const & guard){return guard.get();});
+  m_outputFunSlice = plan.triggerlessOutputFuns.append(m_outputFuns, [](auto const & outputFun){return outputFun.get();});
+  m_actionSlice = plan.triggerlessActions.append(m_actions, [](auto const & action){return action.get();});
 }
 
 ExecStat
 TriggerlessTransitionImpl
 ::exec()
 {
+  ExecutionPlan const & plan{topState()->plan()};
   {
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggerlessGuardSharable const *> shuffler{m_guards.size()};
-    populateShuffle(shuffler, m_guards);
-    for (auto const & guard : shuffler)
+    Scheduler::Sequence<TriggerlessGuardSharable const, true> const guards
+    {
+      topState()->scheduler()
+    , plan.triggerlessGuards[m_guardSlice]
+    };
+    for (auto const & guard : guards)
 #else
-    for (auto const & guard : m_guards)
-#endif // STATE_DIAGRAM_STRINGLESS
+    for (auto const & guard : plan.triggerlessGuards[m_guardSlice])
+#endif // STATE_DIAGRAM_NO_SHUFFLING
     {
-      if (!guard->triggerlessGuard())
+      if (!(*guard)())
       {
         return ExecStat{};
       }
     }
   }
   {
+    OutputEmitter const emit{outputScope()};
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggerlessOutputFunSharable const *> shuffler{m_outputFuns.size()};
-    populateShuffle(shuffler, m_outputFuns);
-    for (auto const & output : shuffler)
-#else
-    for (auto const & output : m_outputFuns)
-#endif // STATE_DIAGRAM_STRINGLESS
+    Scheduler::Sequence<TriggerlessOutputFunSharable const, true> const outputs
     {
-      auto const & outputEvents{output->triggerlessOutputsFun()};
-      for (auto const & outputEvent : outputEvents)
-      {
-#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-        // Check whether output signals, which must always be local, lie in scope.
-        if (!outputScope()->hasInScope(outputEvent.get().impl()))
-        {
-#ifndef STATE_DIAGRAM_STRINGLESS
-          throw Transition::ScopeError::Output(outputEvent.get().impl()->path(), outputScope()->parentRegion()->path());
+      topState()->scheduler()
+    , plan.triggerlessOutputFuns[m_outputFunSlice]
+    };
+    for (auto const & output : outputs)
 #else
-          STATE_DIAGRAM_HANDLE_ERROR(Transition::scopeError_output);
-#endif // STATE_DIAGRAM_STRINGLESS
-        }
-#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
-        outputEvent.get().impl()->activate();
-      }
+    for (auto const & output : plan.triggerlessOutputFuns[m_outputFunSlice])
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+    {
+      (*output)(emit);
     }
   }
   {
 #ifndef STATE_DIAGRAM_NO_SHUFFLING
-    vector<TriggerlessActionSharable const *> shuffler{m_actions.size()};
-    populateShuffle(shuffler, m_actions);
-    for (auto const & action : shuffler)
+    Scheduler::Sequence<TriggerlessActionSharable const, true> const actions
+    {
+      topState()->scheduler()
+    , plan.triggerlessActions[m_actionSlice]
+    };
+    for (auto const & action : actions)
 #else
-    for (auto const & action : m_actions)
-#endif // STATE_DIAGRAM_STRINGLESS
+    for (auto const & action : plan.triggerlessActions[m_actionSlice])
+#endif // STATE_DIAGRAM_NO_SHUFFLING
     {
-      action->triggerlessAction();
+      (*action)();
     }
     return ExecStat{UnwindCmd{}};
   }
@@ -19,7 +19,8 @@
 
 #include "state_diagram/state_diagram.h"
 
-#include "Util/ForwardList.hpp"
+#include "Util/SmallVector.hpp"
+#include "Util/Table.hpp"
 #include "TransitionImpl.h"
 
 namespace state_diagram
@@ -48,10 +49,14 @@ public:
 #endif
 
   void add(Trigger const * const trigger);
+  void add(After const * const after);
+  void add(At const * const at);
   void add(Guard const * const guard);
   void add(Output const * const output);
   void add(Action const * const action);
 
+  void compile(ExecutionPlan & plan) override;
+
 protected:
   virtual string transitionTypeIndicator() const = 0;
 
@@ -62,9 +67,13 @@ private:
   void throwTriggeredSpecOnTriggerlessTransitionError(string const & specTypeIndicator);
 #endif // STATE_DIAGRAM_STRINGLESS
 
-  ForwardList<TriggerlessGuard const> m_guards;
-  ForwardList<TriggerlessOutputFun const> m_outputFuns;
-  ForwardList<TriggerlessAction const> m_actions;
+  SmallVector<TriggerlessGuard const> m_guards;
+  SmallVector<TriggerlessOutputFun const> m_outputFuns;
+  SmallVector<TriggerlessAction const> m_actions;
+
+  TableSlice m_guardSlice;
+  TableSlice m_outputFunSlice;
+  TableSlice m_actionSlice;
 };
 
 }
@@ -18,14 +18,38 @@
 
 #include <cassert>
 
+#include "LocalScope.h"
+#include "TopStateImpl.h"
+
 namespace state_diagram
 {
 
+namespace
+{
+  // Bits of the runtime state of a variable as kept by a machine. Nothing is retrieved in between macro steps.
+  uint8_t constexpr isTouchedBit{1 << 0};
+  uint8_t constexpr isSetNxtBit{1 << 1};
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  uint8_t constexpr isValidBit{1 << 2};
+  uint8_t constexpr isSetBit{1 << 3};
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+}
+
 VarDelegateImpl
-::VarDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(_name) VarDelegate * const interfaceUpcast)
+::VarDelegateImpl
+(
+  STATE_DIAGRAM_STRING_PARAM_COMMA(_name)
+  VarDelegate * const interfaceUpcast
+, TopStateImpl * const topState
+, LocalScope * const localScope
+)
 :
-  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name)}
+  NamePathImpl{STATE_DIAGRAM_STRING_ARG_COMMA(_name) STATE_DIAGRAM_STRING_ARG(topState->namePool)}
+, planIdx{}
 , m_interfaceUpcast{interfaceUpcast}
+, m_topState{topState}
+, m_localScope{localScope}
+, m_isTouched{false}
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 , m_isValid{false}
 , m_isSet{false}
@@ -80,6 +104,7 @@ VarDelegateImpl
 ::markAsSet()
 {
   m_isSet = true;
+  touch();
 }
 
 bool
@@ -97,6 +122,7 @@ VarDelegateImpl
 ::markAsSetNxt()
 {
   m_isSetNxt = true;
+  touch();
 }
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -114,6 +140,7 @@ VarDelegateImpl
 ::markAsRetrieved()
 {
   m_hasBeenRetrieved = true;
+  touch();
 }
 
 void
@@ -132,6 +159,7 @@ VarDelegateImpl
   }
   m_isSetNxt = false;
   m_hasBeenRetrieved = false;
+  m_interfaceUpcast->unset();
 }
 
 #else
@@ -145,9 +173,136 @@ VarDelegateImpl
     m_interfaceUpcast->makeNxtCur();
   }
   m_isSetNxt = false;
+  m_interfaceUpcast->unset();
 }
 
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
+bool
+VarDelegateImpl
+::isTouched()
+const
+{
+  return m_isTouched;
+}
+
+void
+VarDelegateImpl
+::reload()
+{
+  untouch();
+  unset();
+}
+
+size_t
+VarDelegateImpl
+::runtimeDataSize()
+const
+{
+  return m_interfaceUpcast->dataSize();
+}
+
+size_t
+VarDelegateImpl
+::runtimeDataAlignment()
+const
+{
+  return m_interfaceUpcast->dataAlignment();
+}
+
+bool
+VarDelegateImpl
+::hasTrivialRuntimeData()
+const
+{
+  return m_interfaceUpcast->hasTrivialData();
+}
+
+void
+VarDelegateImpl
+::copyRuntimeData(void * const to, void const * const from)
+const
+{
+  m_interfaceUpcast->copyData(to, from);
+}
+
+void
+VarDelegateImpl
+::destroyRuntimeData(void * const data)
+const
+{
+  m_interfaceUpcast->destroyData(data);
+}
+
+uint8_t
+VarDelegateImpl
+::runtimeState()
+const
+{
+  return static_cast<uint8_t>
+  (
+    (m_isTouched ? isTouchedBit : 0)
+  | (m_isSetNxt ? isSetNxtBit : 0)
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  | (m_isValid ? isValidBit : 0)
+  | (m_isSet ? isSetBit : 0)
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  );
+}
+
+void
+VarDelegateImpl
+::swapRuntimeState(uint8_t & _runtimeState, void * const data)
+{
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  assert (!m_hasBeenRetrieved);
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  uint8_t const ownRuntimeState{runtimeState()};
+  m_isSetNxt = (_runtimeState & isSetNxtBit) != 0;
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  m_isValid = (_runtimeState & isValidBit) != 0;
+  m_isSet = (_runtimeState & isSetBit) != 0;
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  // The top state forgets what has been touched before swapping, so a touched variable is to be registered anew.
+  untouch();
+  if ((_runtimeState & isTouchedBit) != 0)
+  {
+    touch();
+  }
+  _runtimeState = ownRuntimeState;
+  m_interfaceUpcast->swapData(data);
+}
+
+void
+VarDelegateImpl
+::touch()
+{
+  if (m_isTouched)
+  {
+    return;
+  }
+  m_isTouched = true;
+  m_topState->touch(this);
+  if (m_localScope != nullptr)
+  {
+    m_localScope->touchLocalVar();
+  }
+}
+
+void
+VarDelegateImpl
+::untouch()
+{
+  if (!m_isTouched)
+  {
+    return;
+  }
+  m_isTouched = false;
+  if (m_localScope != nullptr)
+  {
+    m_localScope->untouchLocalVar();
+  }
+}
+
 }
 
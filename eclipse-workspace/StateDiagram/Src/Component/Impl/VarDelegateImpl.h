@@ -19,17 +19,28 @@
 
 #include "state_diagram/state_diagram.h"
 
+#include <cstdint>
+
 #include "NamePathImpl.h"
 
 namespace state_diagram
 {
 
+class LocalScope;
+class TopStateImpl;
+
 class VarDelegateImpl
 :
   public NamePathImpl
 {
 protected:
-  VarDelegateImpl(STATE_DIAGRAM_STRING_PARAM_COMMA(name) VarDelegate * const interfaceUpcast);
+  VarDelegateImpl
+  (
+    STATE_DIAGRAM_STRING_PARAM_COMMA(name)
+    VarDelegate * const interfaceUpcast
+  , TopStateImpl * const topState
+  , LocalScope * const localScope
+  );
 
 public:
   VarDelegateImpl(VarDelegateImpl const &) = delete;
@@ -72,10 +83,28 @@ public:
 #endif // STATE_DIAGRAM_STRINGLESS
 #endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
+  bool isTouched() const;
   virtual void unset();
+  void reload();
+
+  uint32_t planIdx;
+
+  size_t runtimeDataSize() const;
+  size_t runtimeDataAlignment() const;
+  bool hasTrivialRuntimeData() const;
+  void copyRuntimeData(void * const to, void const * const from) const;
+  void destroyRuntimeData(void * const data) const;
+  uint8_t runtimeState() const;
+  void swapRuntimeState(uint8_t & runtimeState, void * const data);
 
 private:
+  void touch();
+  void untouch();
+
   VarDelegate * const m_interfaceUpcast;
+  TopStateImpl * const m_topState;
+  LocalScope * const m_localScope;
+  bool m_isTouched;
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
   bool m_isValid;
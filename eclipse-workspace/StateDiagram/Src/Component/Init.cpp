@@ -46,7 +46,7 @@ Init
 Init
 ::~Init()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 string const
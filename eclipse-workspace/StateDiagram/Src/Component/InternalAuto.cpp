@@ -35,7 +35,7 @@ InternalAuto
 InternalAuto
 ::~InternalAuto()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
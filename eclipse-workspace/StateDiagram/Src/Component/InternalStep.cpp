@@ -35,7 +35,7 @@ InternalStep
 InternalStep
 ::~InternalStep()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
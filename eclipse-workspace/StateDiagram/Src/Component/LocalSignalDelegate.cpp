@@ -42,7 +42,7 @@ LocalSignalDelegate
 LocalSignalDelegate
 ::~LocalSignalDelegate()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
@@ -0,0 +1,105 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/MachineImpl.h"
+#include "Impl/SubStateImpl.h"
+#include "Impl/TopStateImpl.h"
+
+namespace state_diagram
+{
+
+Machine
+::Machine(Top const & top)
+:
+  PImpl<MachineImpl>{top.m_impl}
+{
+  // This space intentionally left empty
+}
+
+Machine
+::Machine(Machine const & other)
+:
+  PImpl<MachineImpl>{static_cast<MachineImpl const *>(other.m_impl)}
+{
+  // This space intentionally left empty
+}
+
+Machine
+::~Machine()
+{
+  deleteComponent(m_impl);
+}
+
+bool
+Machine
+::step()
+const
+{
+  load();
+  return execLoaded();
+}
+
+bool
+Machine
+::isCurrent(SubState const & subState)
+const
+{
+  return m_impl->isCurrent(subState.PImplUpcast<SubStateImpl>::m_implUpcast);
+}
+
+void
+Machine
+::load()
+const
+{
+  m_impl->load();
+}
+
+void
+Machine
+::activate()
+const
+{
+  // This space intentionally left empty
+}
+
+void
+Machine
+::activate(ExternalEvent const & trigger)
+const
+{
+  m_impl->activate(trigger.impl());
+}
+
+bool
+Machine
+::execLoaded()
+const
+{
+  return m_impl->execLoaded();
+}
+
+void const *
+Machine
+::data(VarDelegateImpl const * const var)
+const
+{
+  return m_impl->data(var);
+}
+
+} // namespace state_diagram
@@ -0,0 +1,121 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#include "Impl/MachinePoolImpl.h"
+#include "Impl/TopStateImpl.h"
+
+namespace state_diagram
+{
+
+MachinePool
+::MachinePool(vector<reference_wrapper<Top const>> const & tops)
+:
+  PImpl<MachinePoolImpl>
+  {
+    &tops.front().get()
+  , [&]
+    {
+      vector<TopStateImpl *> topStates{};
+      for (auto const & top : tops)
+      {
+        topStates.push_back(top.get().m_impl);
+      }
+      return topStates;
+    }()
+  }
+{
+  // This space intentionally left empty
+}
+
+MachinePool
+::~MachinePool()
+{
+  deleteComponent(m_impl);
+}
+
+size_t
+MachinePool
+::add()
+const
+{
+  return m_impl->add();
+}
+
+Machine const &
+MachinePool
+::operator[](size_t const machineIdx)
+const
+{
+  return m_impl->machine(machineIdx);
+}
+
+size_t
+MachinePool
+::size()
+const
+{
+  return m_impl->size();
+}
+
+void
+MachinePool
+::run()
+const
+{
+  m_impl->run();
+}
+
+size_t
+MachinePool
+::nrOfWorkers()
+const
+{
+  return m_impl->nrOfWorkers();
+}
+
+double
+MachinePool
+::utilization(size_t const workerIdx)
+const
+{
+  return m_impl->utilization(workerIdx);
+}
+
+size_t
+MachinePool
+::nrOfSteals(size_t const workerIdx)
+const
+{
+  return m_impl->nrOfSteals(workerIdx);
+}
+
+void
+MachinePool
+::submit(size_t const machineIdx, vector<ExternalEvent const *> const & triggers)
+const
+{
+  vector<ExternalSignalDelegateImpl const *> triggerImpls{};
+  triggerImpls.reserve(triggers.size());
+  for (auto const & trigger : triggers)
+  {
+    triggerImpls.push_back(trigger->impl());
+  }
+  m_impl->submit(machineIdx, triggerImpls);
+}
+
+} // namespace state_diagram
@@ -47,7 +47,7 @@ const
   m_implUpcast->path(to);
 }
 
-string
+string const &
 NamePath
 ::path()
 const
@@ -16,6 +16,8 @@
 
 #include "state_diagram/state_diagram.h"
 
+#include "Impl/LocalSignalDelegateImpl.h"
+#include "Impl/SubStateImpl.h"
 #include "Impl/TriggerlessTransitionImpl.h"
 #include "Impl/TriggeredTransitionImpl.h"
 #include "Impl/Spec_all.h"
@@ -23,6 +25,60 @@
 namespace state_diagram
 {
 
+namespace
+{
+  class StaticOutputs
+  {
+  public:
+    StaticOutputs(TriggerlessOutput const & outputs)
+    :
+      m_outputs{outputs}
+    {
+      // This space intentionally left empty
+    }
+
+    void
+    operator()(OutputEmitter const & emit)
+    const
+    {
+      for (auto const & output : m_outputs->triggerlessOutputs)
+      {
+        emit(output);
+      }
+    }
+
+  private:
+    TriggerlessOutput const m_outputs;
+  };
+}
+
+OutputEmitter
+::OutputEmitter(SubStateImpl const * const outputScope)
+:
+  m_outputScope{outputScope}
+{
+  // This space intentionally left empty
+}
+
+void
+OutputEmitter
+::operator()(LocalEvent const & output)
+const
+{
+#ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  // Check whether output signals, which must always be local, lie in scope.
+  if (!m_outputScope->hasInScope(output.impl()))
+  {
+#ifndef STATE_DIAGRAM_STRINGLESS
+    throw Transition::ScopeError::Output(output.impl()->path(), m_outputScope->parentRegion()->path());
+#else
+    STATE_DIAGRAM_HANDLE_ERROR(Transition::scopeError_output);
+#endif // STATE_DIAGRAM_STRINGLESS
+  }
+#endif // STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
+  output.impl()->activate();
+}
+
 Output
 ::Output(LocalEvent const & triggerlessOutput)
 :
@@ -34,9 +90,15 @@ Output
 Output
 ::Output(LocalEventVector const & triggerlessOutputs)
 :
-  triggerless{make_shared<TriggerlessOutputSharable>(triggerlessOutputs)}
-, triggerlessFun{make_shared<TriggerlessOutputFunSharable>([=]{return triggerlessOutputs;})}
-, triggered{make_shared<TriggeredOutputSharable>([=](Event const &){return triggerlessOutputs;})}
+  triggerless{makeSharedComponent<TriggerlessOutputSharable>(triggerlessOutputs)}
+, triggerlessFun{makeSpecFunction<void (OutputEmitter const &)>(StaticOutputs{triggerless})}
+, triggered
+  {
+    makeSpecFunction<void (Event const &, OutputEmitter const &)>
+    (
+      TriggerIgnoring<StaticOutputs>{StaticOutputs{triggerless}}
+    )
+  }
 {
   // This space intentionally left empty
 }
@@ -44,7 +106,7 @@ Output
 Output
 ::Output(function<LocalEvent const & ()> const & triggerlessOutputFun)
 :
-  Output{[=]{return LocalEventVector{triggerlessOutputFun()};}}
+  Output{[=](OutputEmitter const & emit){emit(triggerlessOutputFun());}}
 {
   // This space intentionally left empty
 }
@@ -52,24 +114,24 @@ Output
 Output
 ::Output(function<LocalEventVector ()> const & triggerlessOutputsFun)
 :
-  triggerless{nullptr}
-, triggerlessFun{new TriggerlessOutputFunSharable(triggerlessOutputsFun)}
-, triggered{make_shared<TriggeredOutputSharable>([=](Event const &){return triggerlessOutputsFun();})}
-{
-  if (triggerlessFun == nullptr)
+  Output
   {
-#ifndef STATE_DIAGRAM_STRINGLESS
-    throw MemoryError();
-#else
-    STATE_DIAGRAM_HANDLE_ERROR(memoryError);
-#endif // STATE_DIAGRAM_STRINGLESS
+    [=](OutputEmitter const & emit)
+    {
+      for (auto const & output : triggerlessOutputsFun())
+      {
+        emit(output);
+      }
+    }
   }
+{
+  // This space intentionally left empty
 }
 
 Output
 ::Output(function<LocalEvent const & (Event const &)> const & triggeredOutput)
 :
-  Output{[=](Event const & trigger){return LocalEventVector{triggeredOutput(trigger)};}}
+  Output{[=](Event const & trigger, OutputEmitter const & emit){emit(triggeredOutput(trigger));}}
 {
   // This space intentionally left empty
 }
@@ -77,18 +139,18 @@ Output
 Output
 ::Output(function<LocalEventVector (Event const &)> const & triggeredOutputs)
 :
-  triggerless{nullptr}
-, triggerlessFun{nullptr}
-, triggered{new TriggeredOutputSharable(triggeredOutputs)}
-{
-  if (triggered == nullptr)
+  Output
   {
-#ifndef STATE_DIAGRAM_STRINGLESS
-    throw MemoryError();
-#else
-    STATE_DIAGRAM_HANDLE_ERROR(memoryError);
-#endif // STATE_DIAGRAM_STRINGLESS
+    [=](Event const & trigger, OutputEmitter const & emit)
+    {
+      for (auto const & output : triggeredOutputs(trigger))
+      {
+        emit(output);
+      }
+    }
   }
+{
+  // This space intentionally left empty
 }
 
 void
@@ -14,16 +14,16 @@
    limitations under the License.
 */
 
-#include "StackSeq_all.h"
+
+#include "state_diagram/state_diagram.h"
 
 namespace state_diagram
 {
 
-StackSeq::
-~StackSeq()
+Post
+::~Post()
 {
   // This space intentionally left empty
 }
 
-} // namespace state_diagram
-
+}
@@ -44,7 +44,7 @@ Region
 Region
 ::~Region()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
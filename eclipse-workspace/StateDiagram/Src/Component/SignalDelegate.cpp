@@ -66,6 +66,22 @@ const
   implUpcast()->markAsSet();
 }
 
+bool
+SignalDelegate
+::isTaken()
+const
+{
+  return implUpcast()->isTaken();
+}
+
+void
+SignalDelegate
+::markAsTaken()
+const
+{
+  implUpcast()->markAsTaken();
+}
+
 bool
 SignalDelegate
 ::isUnderExecution()
@@ -50,7 +50,7 @@ State
 State
 ::~State()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 bool
@@ -35,7 +35,7 @@ Step
 Step
 ::~Step()
 {
-  delete m_impl;
+  deleteComponent(m_impl);
 }
 
 } // namespace state_diagram
@@ -0,0 +1,90 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "Impl/TextBindingsImpl.h"
+
+namespace state_diagram
+{
+
+TextBindings
+::TextBindings()
+:
+  PImpl<TextBindingsImpl>{}
+{
+  // This space intentionally left empty
+}
+
+TextBindings
+::~TextBindings()
+{
+  deleteComponent(m_impl);
+}
+
+void
+TextBindings
+::bind(string const & name, Guard const & guard)
+const
+{
+  m_impl->bind(name, guard);
+}
+
+void
+TextBindings
+::bind(string const & name, Action const & action)
+const
+{
+  m_impl->bind(name, action);
+}
+
+void
+TextBindings
+::bind(string const & name, Output const & output)
+const
+{
+  m_impl->bind(name, output);
+}
+
+ImageBindings const &
+TextBindings
+::imageBindings()
+const
+{
+  return m_impl->imageBindings;
+}
+
+uint32_t
+TextBindings
+::signalTypeId(string const & name)
+const
+{
+  return m_impl->bindSignalType(name);
+}
+
+uint32_t
+TextBindings
+::varTypeId(string const & name)
+const
+{
+  return m_impl->bindVarType(name);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
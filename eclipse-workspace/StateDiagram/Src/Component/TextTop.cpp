@@ -0,0 +1,82 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "state_diagram/state_diagram.h"
+
+#ifndef STATE_DIAGRAM_STRINGLESS
+
+#include "Impl/TextTopImpl.h"
+
+namespace state_diagram
+{
+
+TextTop
+::TextTop(string const & text, TextBindings const & bindings)
+:
+  PImpl<TextTopImpl>{text, static_cast<TextBindingsImpl const *>(bindings.m_impl)}
+{
+  // This space intentionally left empty
+}
+
+TextTop
+::~TextTop()
+{
+  deleteComponent(m_impl);
+}
+
+Top const &
+TextTop
+::top()
+const
+{
+  return loaded().top();
+}
+
+SubState const &
+TextTop
+::subState(string const & path)
+const
+{
+  return loaded().subState(idx("state", path));
+}
+
+ExternalEvent const &
+TextTop
+::externalEvent(string const & name)
+const
+{
+  return loaded().externalEvent(idx("signal", name));
+}
+
+ImageTop const &
+TextTop
+::loaded()
+const
+{
+  return m_impl->loaded();
+}
+
+Image::Idx
+TextTop
+::idx(string const & nameKind, string const & path)
+const
+{
+  return m_impl->idx(nameKind, path);
+}
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_STRINGLESS
@@ -35,7 +35,10 @@ Top
 Top
 ::~Top()
 {
-  delete m_impl;
+  // Components allocated from the arena may still be referred to while the top state itself is destructed.
+  Arena * const arena{m_impl->arena};
+  deleteComponent(m_impl);
+  delete arena;
 }
 
 void
@@ -51,9 +54,46 @@ Top
 ::step()
 const
 {
+  m_impl->drainPosts();
   return m_impl->exec();
 }
 
+void
+Top
+::setRegionScheduling(RegionScheduling const regionScheduling)
+const
+{
+  m_impl->setRegionScheduling(regionScheduling);
+}
+
+bool
+Top
+::advanceTime(TimePoint const now)
+const
+{
+  return m_impl->advanceTime(now);
+}
+
+#ifndef STATE_DIAGRAM_NO_SHUFFLING
+
+void
+Top
+::setSchedulingPolicy(SchedulingPolicy const schedulingPolicy)
+const
+{
+  m_impl->scheduler().setPolicy(schedulingPolicy);
+}
+
+void
+Top
+::seedScheduling(unsigned const seed)
+const
+{
+  m_impl->scheduler().seed(seed);
+}
+
+#endif // STATE_DIAGRAM_NO_SHUFFLING
+
 void
 Top
 ::activate(ExternalEvent const & trigger)
@@ -62,4 +102,20 @@ const
   return m_impl->activate(trigger.impl());
 }
 
+bool
+Top
+::post(ExternalSignal<void> & signal)
+const
+{
+  return enqueue(signal, nullptr);
+}
+
+bool
+Top
+::enqueue(ExternalEvent const & signal, Post * const post)
+const
+{
+  return m_impl->post(signal.impl(), post);
+}
+
 } // namespace state_diagram
@@ -47,6 +47,62 @@ const
   m_delegator->makeNxtCur();
 }
 
+void
+VarDelegate
+::unset()
+const
+{
+  m_delegator->unset();
+}
+
+size_t
+VarDelegate
+::dataSize()
+const
+{
+  return m_delegator->dataSize();
+}
+
+size_t
+VarDelegate
+::dataAlignment()
+const
+{
+  return m_delegator->dataAlignment();
+}
+
+bool
+VarDelegate
+::hasTrivialData()
+const
+{
+  return m_delegator->hasTrivialData();
+}
+
+void
+VarDelegate
+::copyData(void * const to, void const * const from)
+const
+{
+  m_delegator->copyData(to, from);
+}
+
+void
+VarDelegate
+::destroyData(void * const data)
+const
+{
+  m_delegator->destroyData(data);
+}
+
+void
+VarDelegate
+::swapData(void * const data)
+const
+{
+  m_delegator->swapData(data);
+}
+
 #ifndef STATE_DIAGRAM_NO_CHECKS_WHILE_STEPPING
 
 bool
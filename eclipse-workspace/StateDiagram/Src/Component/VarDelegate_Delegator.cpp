@@ -25,5 +25,12 @@ VarDelegate::Delegator
   // This space intentionally left empty
 }
 
+void
+VarDelegate::Delegator
+::unset()
+{
+  // This space intentionally left empty
+}
+
 } // namespace state_diagram
 
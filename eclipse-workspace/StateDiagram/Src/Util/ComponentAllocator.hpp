@@ -0,0 +1,48 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_UTIL_COMPONENTALLOCATOR_HPP_
+#define STATE_DIAGRAM_UTIL_COMPONENTALLOCATOR_HPP_
+
+#include "state_diagram/state_diagram_internal.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace state_diagram
+{
+
+using namespace std;
+
+class ComponentDeleter
+{
+public:
+  template<class Impl>
+  void
+  operator()(Impl * const impl)
+  const
+  {
+    deleteComponent(impl);
+  }
+};
+
+template<class Impl>
+using ComponentPtr = unique_ptr<Impl, ComponentDeleter>;
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_UTIL_COMPONENTALLOCATOR_HPP_
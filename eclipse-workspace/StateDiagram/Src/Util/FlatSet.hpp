@@ -0,0 +1,134 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_UTIL_FLATSET_HPP_
+#define STATE_DIAGRAM_UTIL_FLATSET_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace state_diagram
+{
+
+using namespace std;
+
+// Hash set with open addressing that keeps all of its keys in a single array, so that inserting a key does not
+// allocate a node of its own. A default constructed key marks an empty slot, which is why it must never be inserted.
+template<typename Key, class Hash>
+class FlatSet
+{
+public:
+  FlatSet()
+  :
+    m_slots{}
+  , m_size{0}
+  {
+    // This space intentionally left empty
+  }
+
+  FlatSet(FlatSet const &) = delete;
+
+  void operator=(FlatSet const &) = delete;
+
+  bool
+  insert(Key const & key)
+  {
+    assert (!(key == Key{}));
+    // Keeping the load factor at one half at most keeps probe sequences short.
+    if (2 * (m_size + 1) > m_slots.size())
+    {
+      grow();
+    }
+    if (!place(m_slots, key))
+    {
+      return false;
+    }
+    ++m_size;
+    return true;
+  }
+
+  Key const *
+  find(Key const & key)
+  const
+  {
+    if (m_slots.empty())
+    {
+      return nullptr;
+    }
+    size_t const mask{m_slots.size() - 1};
+    for (size_t idx{Hash{}(key) & mask}; ; idx = (idx + 1) & mask)
+    {
+      if (m_slots[idx] == Key{})
+      {
+        return nullptr;
+      }
+      if (m_slots[idx] == key)
+      {
+        return &m_slots[idx];
+      }
+    }
+  }
+
+  size_t
+  size()
+  const
+  {
+    return m_size;
+  }
+
+private:
+  static
+  bool
+  place(vector<Key> & slots, Key const & key)
+  {
+    size_t const mask{slots.size() - 1};
+    for (size_t idx{Hash{}(key) & mask}; ; idx = (idx + 1) & mask)
+    {
+      if (slots[idx] == Key{})
+      {
+        slots[idx] = key;
+        return true;
+      }
+      if (slots[idx] == key)
+      {
+        return false;
+      }
+    }
+  }
+
+  void
+  grow()
+  {
+    vector<Key> slots(max(size_t{16}, 2 * m_slots.size()), Key{});
+    for (auto const & key : m_slots)
+    {
+      if (!(key == Key{}))
+      {
+        place(slots, key);
+      }
+    }
+    m_slots.swap(slots);
+  }
+
+  vector<Key> m_slots;
+  size_t m_size;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_UTIL_FLATSET_HPP_
@@ -19,7 +19,7 @@
 
 #include <functional>
 
-#include "ForwardList.hpp"
+#include "SmallVector.hpp"
 
 namespace state_diagram
 {
@@ -32,7 +32,7 @@ namespace
   void
   forEachItem
   (
-    ForwardList<Item * const> const & list
+    SmallVector<Item * const> const & list
   , function<void (conditional_t<isConstFunc, Item const, Item> * const)> const & f
   )
   {
@@ -50,7 +50,7 @@ namespace
   void
   forEachItemExcept
   (
-    ForwardList<Item * const> const & list
+    SmallVector<Item * const> const & list
   , function<void (conditional_t<isConstFunc, Item const, Item> * const)> const & f
   , Item const * const exceptee
   )
@@ -63,7 +63,7 @@ namespace
   bool
   containsItem
   (
-    ForwardList<conditional_t<isConstFunc, Item const, Item> * const> const & list
+    SmallVector<conditional_t<isConstFunc, Item const, Item> * const> const & list
   , Item const * const searchItem
   )
   {
@@ -80,7 +80,7 @@ namespace
 
 template<class Item>
 void
-forEachItem(ForwardList<Item * const> const & list, function<void (Item * const)> const & f)
+forEachItem(SmallVector<Item * const> const & list, function<void (Item * const)> const & f)
 {
   forEachItem<Item, false>(list, f);
 }
@@ -89,7 +89,7 @@ template<class Item>
 void
 forEachItemExcept
 (
-  ForwardList<Item * const> const & list
+  SmallVector<Item * const> const & list
 , function<void (Item * const)> const & f
 , Item const * const exceptee
 )
@@ -99,7 +99,7 @@ forEachItemExcept
 
 template<class Item>
 void
-forEachCItem(ForwardList<Item * const> const & list, function<void (Item const * const)> const & f)
+forEachCItem(SmallVector<Item * const> const & list, function<void (Item const * const)> const & f)
 {
   forEachItem<Item, true>(list, f);
 }
@@ -108,7 +108,7 @@ template<class Item>
 void
 forEachCItemExcept
 (
-  ForwardList<Item * const> const & list
+  SmallVector<Item * const> const & list
 , function<void (Item const * const)> const & f
 , Item const * const exceptee
 )
@@ -118,97 +118,18 @@ forEachCItemExcept
 
 template<class Item>
 bool
-containsItem(ForwardList<Item * const> const & list, Item const * const item)
+containsItem(SmallVector<Item * const> const & list, Item const * const item)
 {
   return containsItem<Item, false>(list, item);
 }
 
 template<class Item>
 bool
-containsItem(ForwardList<Item const * const> const & list, Item const * const item)
+containsItem(SmallVector<Item const * const> const & list, Item const * const item)
 {
   return containsItem<Item, true>(list, item);
 }
 
-#ifndef STATE_DIAGRAM_NO_SHUFFLING
-
-namespace
-{
-  template<class Item, bool isConstFunc>
-  void
-  forEachItemRandomly
-  (
-    ForwardList<Item * const> const & list
-  , function<void (conditional_t<isConstFunc, Item const, Item> * const)> const & f
-  )
-  {
-    vector<conditional_t<isConstFunc, Item const, Item> *> shuffler{size(list)};
-    {
-      size_t idx{0};
-      for (auto const & item : list)
-      {
-        shuffler[idx] = item;
-        ++idx;
-      }
-    }
-    random_shuffle(shuffler.begin(), shuffler.end());
-    for_each(shuffler.cbegin(), shuffler.cend(), [&](auto const & item){f(item);});
-  }
-
-  template<class Item, bool isConstFunc>
-  void
-  forEachItemRandomlyExcept
-  (
-    ForwardList<Item * const> const & list
-  , function<void (conditional_t<isConstFunc, Item const, Item> * const)> const & f
-  , Item const * const exceptee
-  )
-  {
-    auto const g{[&](conditional_t<isConstFunc, Item const, Item> * const item){if (item != exceptee) f(item);}};
-    forEachItemRandomly<Item, isConstFunc>(list, g);
-  }
-}
-
-template<class Item>
-void
-forEachItemRandomly(ForwardList<Item * const> const & list, function<void (Item * const)> const & f)
-{
-  forEachItemRandomly<Item, false>(list, f);
-}
-
-template<class Item>
-void
-forEachItemRandomlyExcept
-(
-  ForwardList<Item * const> const & list
-, function<void (Item * const)> const & f
-, Item const * const exceptee
-)
-{
-  forEachItemRandomlyExcept<Item, false>(list, f, exceptee);
-}
-
-template<class Item>
-void
-forEachCItemRandomly(ForwardList<Item * const> const & list, function<void (Item const * const)> const & f)
-{
-  forEachItemRandomly<Item, true>(list, f);
-}
-
-template<class Item>
-void
-forEachCItemRandomlyExcept
-(
-  ForwardList<Item * const> const & list
-, function<void (Item const * const)> const & f
-, Item const * const exceptee
-)
-{
-  forEachItemRandomlyExcept<Item, true>(list, f, exceptee);
-}
-
-#endif // STATE_DIAGRAM_NO_SHUFFLING
-
 } // namespace state_diagram
 
 #endif // STATE_DIAGRAM_UTIL_LISTALGORITHM_HPP_
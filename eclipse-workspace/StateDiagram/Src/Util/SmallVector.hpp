@@ -0,0 +1,174 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifndef STATE_DIAGRAM_UTIL_SMALLVECTOR_HPP_
+#define STATE_DIAGRAM_UTIL_SMALLVECTOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "state_diagram/state_diagram_internal.h"
+
+namespace state_diagram
+{
+
+using namespace std;
+
+// Contiguous storage for the children of a component. Up to inlineCapacity items are held in place, more spill
+// over into a buffer allocated like components are. Items are iterated from the most recently emplaced one
+// onwards, just as if the container were a list populated at the front, which the scheduler relies on.
+template<typename Item, size_t inlineCapacity = 4>
+class SmallVector
+{
+private:
+  using StoredItem = remove_const_t<Item>;
+
+public:
+  using iterator = reverse_iterator<Item *>;
+  using const_iterator = reverse_iterator<Item const *>;
+
+  SmallVector()
+  :
+    m_items{inlineItems()}
+  , m_size{0}
+  , m_capacity{inlineCapacity}
+  {
+    // This space intentionally left empty
+  }
+
+  SmallVector(SmallVector const &) = delete;
+
+  ~SmallVector()
+  {
+    for (uint32_t idx{0}; idx < m_size; ++idx)
+    {
+      m_items[idx].~StoredItem();
+    }
+    if (m_items != inlineItems())
+    {
+      releaseComponent(m_items);
+    }
+  }
+
+  void operator=(SmallVector const &) = delete;
+
+  template<class... Args>
+  void
+  emplace_front(Args &&... args)
+  {
+    if (m_size == m_capacity)
+    {
+      grow();
+    }
+    new (m_items + m_size) StoredItem{forward<Args>(args)...};
+    ++m_size;
+  }
+
+  iterator
+  begin()
+  const
+  {
+    return iterator{items() + m_size};
+  }
+
+  iterator
+  end()
+  const
+  {
+    return iterator{items()};
+  }
+
+  const_iterator
+  cbegin()
+  const
+  {
+    return const_iterator{items() + m_size};
+  }
+
+  const_iterator
+  cend()
+  const
+  {
+    return const_iterator{items()};
+  }
+
+  size_t
+  size()
+  const noexcept
+  {
+    return m_size;
+  }
+
+  bool
+  empty()
+  const noexcept
+  {
+    return m_size == 0;
+  }
+
+private:
+  StoredItem *
+  inlineItems()
+  {
+    return reinterpret_cast<StoredItem *>(m_inlineItems);
+  }
+
+  StoredItem const *
+  inlineItems()
+  const
+  {
+    return reinterpret_cast<StoredItem const *>(m_inlineItems);
+  }
+
+  Item *
+  items()
+  const
+  {
+    return m_items;
+  }
+
+  void
+  grow()
+  {
+    uint32_t const capacity{2 * m_capacity};
+    auto const items{static_cast<StoredItem *>(allocateComponent(capacity * sizeof(StoredItem), alignof(StoredItem)))};
+    for (uint32_t idx{0}; idx < m_size; ++idx)
+    {
+      new (items + idx) StoredItem{move(m_items[idx])};
+      m_items[idx].~StoredItem();
+    }
+    if (m_items != inlineItems())
+    {
+      releaseComponent(m_items);
+    }
+    m_items = items;
+    m_capacity = capacity;
+  }
+
+  StoredItem * m_items;
+  uint32_t m_size;
+  uint32_t m_capacity;
+  alignas(StoredItem) unsigned char m_inlineItems[inlineCapacity * sizeof(StoredItem)];
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_UTIL_SMALLVECTOR_HPP_
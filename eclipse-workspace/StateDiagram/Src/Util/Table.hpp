@@ -0,0 +1,159 @@
+/*   
+   (c) Copyright 2019-2021 State Diagram Contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifndef STATE_DIAGRAM_UTIL_TABLE_HPP_
+#define STATE_DIAGRAM_UTIL_TABLE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace state_diagram
+{
+
+using namespace std;
+
+struct TableSlice
+{
+  uint32_t begin;
+  uint32_t end;
+};
+
+template<typename Item>
+class Table
+{
+public:
+  class Range
+  {
+  public:
+    Range(Item const * const _begin, Item const * const _end)
+    :
+      m_begin{_begin}
+    , m_end{_end}
+    {
+      // This space intentionally left empty
+    }
+
+    Item const *
+    begin()
+    const
+    {
+      return m_begin;
+    }
+
+    Item const *
+    end()
+    const
+    {
+      return m_end;
+    }
+
+    size_t
+    size()
+    const
+    {
+      return m_end - m_begin;
+    }
+
+    bool
+    empty()
+    const
+    {
+      return m_begin == m_end;
+    }
+
+  private:
+    Item const * m_begin;
+    Item const * m_end;
+  };
+
+  Table()
+  :
+    m_items{}
+  {
+    // This space intentionally left empty
+  }
+
+  Table(Table const &) = delete;
+
+  void operator=(Table const &) = delete;
+
+  template<class List, class Lower>
+  TableSlice
+  append(List const & list, Lower const & lower)
+  {
+    auto const begin{static_cast<uint32_t>(m_items.size())};
+    for (auto const & item : list)
+    {
+      m_items.push_back(lower(item));
+    }
+    return TableSlice{begin, static_cast<uint32_t>(m_items.size())};
+  }
+
+  template<class List>
+  TableSlice
+  append(List const & list)
+  {
+    return append(list, [](Item const & item){return item;});
+  }
+
+  uint32_t
+  push(Item const & item)
+  {
+    m_items.push_back(item);
+    return static_cast<uint32_t>(m_items.size() - 1);
+  }
+
+  Range
+  operator[](TableSlice const slice)
+  const
+  {
+    return Range{m_items.data() + slice.begin, m_items.data() + slice.end};
+  }
+
+  Item const &
+  operator[](uint32_t const idx)
+  const
+  {
+    return m_items[idx];
+  }
+
+  Range
+  all()
+  const
+  {
+    return Range{m_items.data(), m_items.data() + m_items.size()};
+  }
+
+  uint32_t
+  size()
+  const
+  {
+    return static_cast<uint32_t>(m_items.size());
+  }
+
+  void
+  clear()
+  {
+    m_items.clear();
+  }
+
+private:
+  vector<Item> m_items;
+};
+
+} // namespace state_diagram
+
+#endif // STATE_DIAGRAM_UTIL_TABLE_HPP_